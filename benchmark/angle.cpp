@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath> // for std::sin
+#include <cstdint> // for std::int32_t
+#include <vector>
+
+#include <realnumb/angle.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 1024u;
+
+/// @brief Gets angles in radians spread over a few turns in both directions.
+template <class T>
+auto make_radians() -> std::vector<T>
+{
+    auto result = std::vector<T>{};
+    result.reserve(NumValues);
+    for (auto i = 0u; i < NumValues; ++i) {
+        result.push_back(T((static_cast<double>(i) - NumValues / 2.0) * 0.0371));
+    }
+    return result;
+}
+
+void sin_angle32(benchmark::State& state)
+{
+    auto values = std::vector<angle32>{};
+    for (const auto& radians: make_radians<fixed32>()) {
+        values.push_back(angle32(radians));
+    }
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(sin(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+void sincos_angle32(benchmark::State& state)
+{
+    auto values = std::vector<angle32>{};
+    for (const auto& radians: make_radians<fixed32>()) {
+        values.push_back(angle32(radians));
+    }
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(sincos(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+void sin_fixed32(benchmark::State& state)
+{
+    const auto values = make_radians<fixed32>();
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(sin(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+void sin_float(benchmark::State& state)
+{
+    const auto values = make_radians<float>();
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(std::sin(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+void add_angle32(benchmark::State& state)
+{
+    const auto step = angle32(fixed32(0.0371));
+    auto value = angle32{};
+    for (auto _: state) {
+        value += step;
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+void add_normalize_fixed32(benchmark::State& state)
+{
+    const auto step = fixed32(0.0371);
+    auto value = fixed32{};
+    for (auto _: state) {
+        value = detail::angular_normalize(value + step);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+}
+
+BENCHMARK(sin_angle32);
+BENCHMARK(sincos_angle32);
+BENCHMARK(sin_fixed32);
+BENCHMARK(sin_float);
+BENCHMARK(add_angle32);
+BENCHMARK(add_normalize_fixed32);
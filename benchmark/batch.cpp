@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int64_t, std::uint32_t
+#include <vector>
+
+#include <realnumb/batch.hpp>
+#include <realnumb/fixed_math.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 4096u;
+
+/// @brief Gets values scattered between about -16 and +16, or between 0 and +16.
+/// @note These keep most results of the exponential function finite.
+auto make_values(bool positive) -> std::vector<fixed32>
+{
+    auto result = std::vector<fixed32>{};
+    result.reserve(NumValues);
+    auto state = std::uint32_t{12345u};
+    for (auto i = 0u; i < NumValues; ++i) {
+        state = state * 1664525u + 1013904223u; // LCG from Numerical Recipes
+        const auto fraction = static_cast<double>(state) / 4294967296.0;
+        result.push_back(fixed32(positive? fraction * 16.0: fraction * 32.0 - 16.0));
+    }
+    return result;
+}
+
+template <fixed32 (*Function)(fixed32), bool Positive = false>
+void scalar(benchmark::State& state)
+{
+    const auto values = make_values(Positive);
+    auto results = std::vector<fixed32>(values.size());
+    for (auto _: state) {
+        for (auto i = 0u; i < NumValues; ++i) {
+            results[i] = Function(values[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <void (*Function)(const fixed32*, std::size_t, fixed32*), bool Positive = false>
+void batched(benchmark::State& state)
+{
+    const auto values = make_values(Positive);
+    auto results = std::vector<fixed32>(values.size());
+    for (auto _: state) {
+        Function(values.data(), values.size(), results.data());
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <fixed32 (*Function)(fixed32, fixed32)>
+void scalar_pairs(benchmark::State& state)
+{
+    const auto ys = make_values(false);
+    const auto xs = std::vector<fixed32>(ys.rbegin(), ys.rend());
+    auto results = std::vector<fixed32>(ys.size());
+    for (auto _: state) {
+        for (auto i = 0u; i < NumValues; ++i) {
+            results[i] = Function(ys[i], xs[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <void (*Function)(const fixed32*, const fixed32*, std::size_t, fixed32*)>
+void batched_pairs(benchmark::State& state)
+{
+    const auto ys = make_values(false);
+    const auto xs = std::vector<fixed32>(ys.rbegin(), ys.rend());
+    auto results = std::vector<fixed32>(ys.size());
+    for (auto _: state) {
+        Function(ys.data(), xs.data(), ys.size(), results.data());
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+}
+
+BENCHMARK_TEMPLATE(scalar, &sin);
+BENCHMARK_TEMPLATE(batched, &batch::sin);
+BENCHMARK_TEMPLATE(scalar, &exp);
+BENCHMARK_TEMPLATE(batched, &batch::exp);
+BENCHMARK_TEMPLATE(scalar, &log, true);
+BENCHMARK_TEMPLATE(batched, &batch::log, true);
+BENCHMARK_TEMPLATE(scalar, &sqrt, true);
+BENCHMARK_TEMPLATE(batched, &batch::sqrt, true);
+BENCHMARK_TEMPLATE(scalar_pairs, &atan2);
+BENCHMARK_TEMPLATE(batched_pairs, &batch::atan2);
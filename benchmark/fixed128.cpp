@@ -0,0 +1,192 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath> // for std::sqrt, std::exp, std::log, std::sin, std::atan
+#include <cstdint> // for std::int64_t
+#include <vector>
+
+#include <realnumb/fixed_math.hpp>
+
+#ifdef REALNUMB_HAVE_QUADMATH
+#include <quadmath.h>
+#endif
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 1024u;
+
+/// @brief Fixed type on four limbs having 192 fraction bits.
+using fixed256 = fixed<limbs<4>, 192u>;
+
+// Makes the standard overloads for long double visible to the benchmarks below. The fixed
+// types' functions are still found through argument dependent lookup.
+using std::sqrt;
+using std::exp;
+using std::log;
+using std::sin;
+using std::atan;
+
+#ifdef REALNUMB_HAVE_QUADMATH
+/// @brief Quadruple precision floating point type.
+using float128 = __float128;
+
+auto sqrt(float128 value) -> float128
+{
+    return sqrtq(value);
+}
+
+auto exp(float128 value) -> float128
+{
+    return expq(value);
+}
+
+auto log(float128 value) -> float128
+{
+    return logq(value);
+}
+
+auto sin(float128 value) -> float128
+{
+    return sinq(value);
+}
+
+auto atan(float128 value) -> float128
+{
+    return atanq(value);
+}
+#endif
+
+/// @brief Gets values spread evenly between the given bounds.
+template <class T>
+auto make_values(double lo, double hi) -> std::vector<T>
+{
+    auto result = std::vector<T>{};
+    result.reserve(NumValues);
+    const auto step = (hi - lo) / NumValues;
+    for (auto i = 0u; i < NumValues; ++i) {
+        result.push_back(T(lo + i * step));
+    }
+    return result;
+}
+
+template <class T>
+void multiply_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1000.0, 1000.0);
+    const auto factor = T(1.0009765625);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(value * factor);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void divide_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1000.0, 1000.0);
+    const auto divisor = T(3.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(value / divisor);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void sqrt_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(0.0, 1000.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(sqrt(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void exp_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 12.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(exp(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void log_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(0.01, 4000000.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(log(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void sin_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(sin(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void atan_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(atan(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+}
+
+#ifdef REALNUMB_INT128
+BENCHMARK_TEMPLATE(multiply_values, fixed128);
+BENCHMARK_TEMPLATE(divide_values, fixed128);
+BENCHMARK_TEMPLATE(sqrt_values, fixed128);
+BENCHMARK_TEMPLATE(exp_values, fixed128);
+BENCHMARK_TEMPLATE(log_values, fixed128);
+BENCHMARK_TEMPLATE(sin_values, fixed128);
+BENCHMARK_TEMPLATE(atan_values, fixed128);
+#endif
+BENCHMARK_TEMPLATE(multiply_values, fixed256);
+BENCHMARK_TEMPLATE(divide_values, fixed256);
+BENCHMARK_TEMPLATE(sqrt_values, fixed256);
+BENCHMARK_TEMPLATE(exp_values, fixed256);
+BENCHMARK_TEMPLATE(log_values, fixed256);
+BENCHMARK_TEMPLATE(sin_values, fixed256);
+BENCHMARK_TEMPLATE(atan_values, fixed256);
+BENCHMARK_TEMPLATE(multiply_values, long double);
+BENCHMARK_TEMPLATE(divide_values, long double);
+BENCHMARK_TEMPLATE(sqrt_values, long double);
+BENCHMARK_TEMPLATE(exp_values, long double);
+BENCHMARK_TEMPLATE(log_values, long double);
+BENCHMARK_TEMPLATE(sin_values, long double);
+BENCHMARK_TEMPLATE(atan_values, long double);
+#ifdef REALNUMB_HAVE_QUADMATH
+BENCHMARK_TEMPLATE(multiply_values, float128);
+BENCHMARK_TEMPLATE(divide_values, float128);
+BENCHMARK_TEMPLATE(sqrt_values, float128);
+BENCHMARK_TEMPLATE(exp_values, float128);
+BENCHMARK_TEMPLATE(log_values, float128);
+BENCHMARK_TEMPLATE(sin_values, float128);
+BENCHMARK_TEMPLATE(atan_values, float128);
+#endif
@@ -0,0 +1,485 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath> // for std::log, std::exp, std::pow, std::tan, etc.
+#include <cstdint> // for std::int64_t
+#include <vector>
+
+#include <realnumb/fixed_math.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 1024u;
+
+/// @brief Gets positive values spread logarithmically between the given bounds.
+template <class T>
+auto make_positives(double lo, double hi) -> std::vector<T>
+{
+    auto result = std::vector<T>{};
+    result.reserve(NumValues);
+    const auto factor = std::pow(hi / lo, 1.0 / NumValues);
+    auto v = lo;
+    for (auto i = 0u; i < NumValues; ++i, v *= factor) {
+        result.push_back(T(v));
+    }
+    return result;
+}
+
+/// @brief Gets values spread evenly between the given bounds.
+template <class T>
+auto make_values(double lo, double hi) -> std::vector<T>
+{
+    auto result = std::vector<T>{};
+    result.reserve(NumValues);
+    const auto step = (hi - lo) / NumValues;
+    for (auto i = 0u; i < NumValues; ++i) {
+        result.push_back(T(lo + i * step));
+    }
+    return result;
+}
+
+template <class T>
+void log_small(benchmark::State& state)
+{
+    const auto values = make_positives<T>(0.01, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(log(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void log_large(benchmark::State& state)
+{
+    const auto values = make_positives<T>(8.0, 4000000.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(log(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void log2_large(benchmark::State& state)
+{
+    const auto values = make_positives<T>(8.0, 4000000.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(log2(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void exp_range(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 12.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(exp(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void exp2_range(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 12.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(exp2(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void intpow_runtime(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1.5, 1.5);
+    const auto n = static_cast<int>(state.range(0));
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(pow(value, n));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, int N>
+void intpow_compile_time(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1.5, 1.5);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(pow<N>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void round_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-100.0, 100.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(round(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void floor_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-100.0, 100.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(floor(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void atan_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(atan(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void tan_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1.5, 1.5);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(tan(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void asin_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1.0, 1.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(asin(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void acos_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1.0, 1.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(acos(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void sinh_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(sinh(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void cosh_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(cosh(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void tanh_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(tanh(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void cbrt_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1000.0, 1000.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(cbrt(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void log1p_values(benchmark::State& state)
+{
+    const auto values = make_values<T>(-0.5, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(log1p(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, class Tier>
+void sin_tier(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(sin<Tier>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, class Tier>
+void atan_tier(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(atan<Tier>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, class Tier>
+void log_tier(benchmark::State& state)
+{
+    const auto values = make_positives<T>(0.01, 4000000.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(log<Tier>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, class Tier>
+void exp_tier(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 12.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(exp<Tier>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, class Tier>
+void tanh_tier(benchmark::State& state)
+{
+    const auto values = make_values<T>(-8.0, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(tanh<Tier>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+/// @brief Fraction bits that the bounded functions' kernels of the given type are accurate to.
+template <class T>
+constexpr auto ResultBits = detail::ResultBits<typename T::value_type, T::fraction_bits>;
+
+/// @brief All the working bits of the given type for comparing against @c ResultBits.
+template <class T>
+constexpr auto WorkingBits = detail::WorkingBits<typename T::value_type, T::fraction_bits>;
+
+template <class T, unsigned int Bits>
+void sin_kernel(benchmark::State& state)
+{
+    using quadrant_angle = detail::quadrant_angle<typename T::value_type, T::fraction_bits>;
+    auto values = std::vector<quadrant_angle>{};
+    for (const auto& value: make_values<T>(-8.0, 8.0)) {
+        values.push_back(detail::quadrant_reduce(value));
+    }
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(detail::sin<typename T::value_type, T::fraction_bits, Bits>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, unsigned int Bits>
+void log_kernel(benchmark::State& state)
+{
+    constexpr auto scale = detail::log_scale<typename T::value_type, T::fraction_bits>(detail::OneBits);
+    const auto values = make_positives<T>(0.01, 4000000.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(detail::log<typename T::value_type, T::fraction_bits, Bits>(value, scale));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, unsigned int Bits>
+void atan_kernel(benchmark::State& state)
+{
+    using wider_type = typename detail::wider<typename T::value_type>::type;
+    auto values = std::vector<wider_type>{};
+    for (const auto& value: make_values<T>(0.0, 8.0)) {
+        values.push_back(wider_type{value.get_value()} << (WorkingBits<T> - T::fraction_bits));
+    }
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(detail::atan_scaled<typename T::value_type, T::fraction_bits, Bits>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+/// @brief 64-bit fixed type with a Q number-format of <code>Q16.48</code>.
+using fixed_16_48 = fixed<std::int64_t, 48>;
+
+/// @brief 64-bit fixed type with a Q number-format of <code>Q8.56</code>.
+using fixed_8_56 = fixed<std::int64_t, 56>;
+
+}
+
+BENCHMARK_TEMPLATE(log_small, fixed32);
+BENCHMARK_TEMPLATE(log_large, fixed32);
+BENCHMARK_TEMPLATE(log2_large, fixed32);
+BENCHMARK_TEMPLATE(exp_range, fixed32);
+BENCHMARK_TEMPLATE(exp2_range, fixed32);
+BENCHMARK_TEMPLATE(intpow_runtime, fixed32)->Arg(15)->Arg(1000);
+BENCHMARK_TEMPLATE(intpow_compile_time, fixed32, 15);
+BENCHMARK_TEMPLATE(round_values, fixed32);
+BENCHMARK_TEMPLATE(floor_values, fixed32);
+BENCHMARK_TEMPLATE(atan_values, fixed32);
+BENCHMARK_TEMPLATE(sin_kernel, fixed32, ResultBits<fixed32>);
+BENCHMARK_TEMPLATE(sin_kernel, fixed32, WorkingBits<fixed32>);
+BENCHMARK_TEMPLATE(log_kernel, fixed32, ResultBits<fixed32>);
+BENCHMARK_TEMPLATE(log_kernel, fixed32, WorkingBits<fixed32>);
+BENCHMARK_TEMPLATE(atan_kernel, fixed32, ResultBits<fixed32>);
+BENCHMARK_TEMPLATE(atan_kernel, fixed32, WorkingBits<fixed32>);
+BENCHMARK_TEMPLATE(tan_values, fixed32);
+BENCHMARK_TEMPLATE(asin_values, fixed32);
+BENCHMARK_TEMPLATE(acos_values, fixed32);
+BENCHMARK_TEMPLATE(sinh_values, fixed32);
+BENCHMARK_TEMPLATE(cosh_values, fixed32);
+BENCHMARK_TEMPLATE(tanh_values, fixed32);
+BENCHMARK_TEMPLATE(cbrt_values, fixed32);
+BENCHMARK_TEMPLATE(log1p_values, fixed32);
+BENCHMARK_TEMPLATE(sin_tier, fixed32, precise);
+BENCHMARK_TEMPLATE(sin_tier, fixed32, balanced);
+BENCHMARK_TEMPLATE(sin_tier, fixed32, fast);
+BENCHMARK_TEMPLATE(atan_tier, fixed32, precise);
+BENCHMARK_TEMPLATE(atan_tier, fixed32, balanced);
+BENCHMARK_TEMPLATE(atan_tier, fixed32, fast);
+BENCHMARK_TEMPLATE(log_tier, fixed32, precise);
+BENCHMARK_TEMPLATE(log_tier, fixed32, balanced);
+BENCHMARK_TEMPLATE(log_tier, fixed32, fast);
+BENCHMARK_TEMPLATE(exp_tier, fixed32, precise);
+BENCHMARK_TEMPLATE(exp_tier, fixed32, balanced);
+BENCHMARK_TEMPLATE(exp_tier, fixed32, fast);
+BENCHMARK_TEMPLATE(tanh_tier, fixed32, precise);
+BENCHMARK_TEMPLATE(tanh_tier, fixed32, balanced);
+BENCHMARK_TEMPLATE(tanh_tier, fixed32, fast);
+BENCHMARK_TEMPLATE(log_small, fixed64);
+BENCHMARK_TEMPLATE(log_large, fixed64);
+BENCHMARK_TEMPLATE(log2_large, fixed64);
+BENCHMARK_TEMPLATE(exp_range, fixed64);
+BENCHMARK_TEMPLATE(exp2_range, fixed64);
+BENCHMARK_TEMPLATE(atan_values, fixed64);
+BENCHMARK_TEMPLATE(sin_kernel, fixed64, ResultBits<fixed64>);
+BENCHMARK_TEMPLATE(sin_kernel, fixed64, WorkingBits<fixed64>);
+BENCHMARK_TEMPLATE(log_kernel, fixed64, ResultBits<fixed64>);
+BENCHMARK_TEMPLATE(log_kernel, fixed64, WorkingBits<fixed64>);
+BENCHMARK_TEMPLATE(atan_kernel, fixed64, ResultBits<fixed64>);
+BENCHMARK_TEMPLATE(atan_kernel, fixed64, WorkingBits<fixed64>);
+BENCHMARK_TEMPLATE(tan_values, fixed64);
+BENCHMARK_TEMPLATE(asin_values, fixed64);
+BENCHMARK_TEMPLATE(acos_values, fixed64);
+BENCHMARK_TEMPLATE(sinh_values, fixed64);
+BENCHMARK_TEMPLATE(cosh_values, fixed64);
+BENCHMARK_TEMPLATE(tanh_values, fixed64);
+BENCHMARK_TEMPLATE(cbrt_values, fixed64);
+BENCHMARK_TEMPLATE(log1p_values, fixed64);
+BENCHMARK_TEMPLATE(sin_tier, fixed64, precise);
+BENCHMARK_TEMPLATE(sin_tier, fixed64, balanced);
+BENCHMARK_TEMPLATE(sin_tier, fixed64, fast);
+BENCHMARK_TEMPLATE(atan_tier, fixed64, precise);
+BENCHMARK_TEMPLATE(atan_tier, fixed64, balanced);
+BENCHMARK_TEMPLATE(atan_tier, fixed64, fast);
+BENCHMARK_TEMPLATE(log_tier, fixed64, precise);
+BENCHMARK_TEMPLATE(log_tier, fixed64, balanced);
+BENCHMARK_TEMPLATE(log_tier, fixed64, fast);
+BENCHMARK_TEMPLATE(exp_tier, fixed64, precise);
+BENCHMARK_TEMPLATE(exp_tier, fixed64, balanced);
+BENCHMARK_TEMPLATE(exp_tier, fixed64, fast);
+BENCHMARK_TEMPLATE(tanh_tier, fixed64, precise);
+BENCHMARK_TEMPLATE(tanh_tier, fixed64, balanced);
+BENCHMARK_TEMPLATE(tanh_tier, fixed64, fast);
+BENCHMARK_TEMPLATE(log_small, fixed_16_48);
+BENCHMARK_TEMPLATE(exp_range, fixed_16_48);
+BENCHMARK_TEMPLATE(atan_values, fixed_16_48);
+BENCHMARK_TEMPLATE(tan_values, fixed_16_48);
+BENCHMARK_TEMPLATE(asin_values, fixed_16_48);
+BENCHMARK_TEMPLATE(tanh_values, fixed_16_48);
+BENCHMARK_TEMPLATE(cbrt_values, fixed_16_48);
+BENCHMARK_TEMPLATE(log1p_values, fixed_16_48);
+BENCHMARK_TEMPLATE(sin_tier, fixed_16_48, precise);
+BENCHMARK_TEMPLATE(log_small, fixed_8_56);
+BENCHMARK_TEMPLATE(exp_range, fixed_8_56);
+BENCHMARK_TEMPLATE(atan_values, fixed_8_56);
+BENCHMARK_TEMPLATE(tan_values, fixed_8_56);
+BENCHMARK_TEMPLATE(asin_values, fixed_8_56);
+BENCHMARK_TEMPLATE(tanh_values, fixed_8_56);
+BENCHMARK_TEMPLATE(log1p_values, fixed_8_56);
+BENCHMARK_TEMPLATE(sin_tier, fixed_8_56, precise);
+BENCHMARK_TEMPLATE(log_small, float);
+BENCHMARK_TEMPLATE(log_large, float);
+BENCHMARK_TEMPLATE(exp_range, float);
+BENCHMARK_TEMPLATE(exp2_range, float);
+BENCHMARK_TEMPLATE(round_values, float);
+BENCHMARK_TEMPLATE(floor_values, float);
+BENCHMARK_TEMPLATE(atan_values, float);
+BENCHMARK_TEMPLATE(tan_values, float);
+BENCHMARK_TEMPLATE(asin_values, float);
+BENCHMARK_TEMPLATE(acos_values, float);
+BENCHMARK_TEMPLATE(sinh_values, float);
+BENCHMARK_TEMPLATE(cosh_values, float);
+BENCHMARK_TEMPLATE(tanh_values, float);
+BENCHMARK_TEMPLATE(cbrt_values, float);
+BENCHMARK_TEMPLATE(log1p_values, float);
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int64_t, std::uint32_t
+#include <vector>
+
+#include <realnumb/fixed.hpp>
+#include <realnumb/fixed_simd.hpp>
+#include <realnumb/fractional.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 4096u;
+
+/// @brief Gets values scattered between the given type's lowest and max values.
+/// @note A few of the sums and products of these saturate to the infinities.
+template <class T>
+auto make_values(std::uint32_t seed) -> std::vector<T>
+{
+    auto result = std::vector<T>{};
+    result.reserve(NumValues);
+    const auto range = static_cast<double>(T::get_max());
+    auto state = seed;
+    for (auto i = 0u; i < NumValues; ++i) {
+        state = state * 1664525u + 1013904223u; // LCG from Numerical Recipes
+        const auto fraction = static_cast<double>(state) / 4294967296.0;
+        result.push_back(T((fraction * 2.0 - 1.0) * range));
+    }
+    return result;
+}
+
+struct add {
+    template <class T>
+    auto operator()(const T& a, const T& b) const noexcept { return a + b; }
+};
+
+struct multiply {
+    template <class T>
+    auto operator()(const T& a, const T& b) const noexcept { return a * b; }
+};
+
+template <class T, class Op>
+void scalar(benchmark::State& state)
+{
+    const auto as = make_values<T>(12345u);
+    const auto bs = make_values<T>(54321u);
+    auto results = std::vector<T>(NumValues);
+    for (auto _: state) {
+        for (auto i = 0u; i < NumValues; ++i) {
+            results[i] = Op{}(as[i], bs[i]);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, std::size_t N, class Op>
+void lanes(benchmark::State& state)
+{
+    using simd = fixed_simd<T, N>;
+    const auto as = make_values<T>(12345u);
+    const auto bs = make_values<T>(54321u);
+    auto results = std::vector<T>(NumValues);
+    for (auto _: state) {
+        for (auto i = std::size_t{0}; i < NumValues; i += N) {
+            Op{}(simd::load(as.data() + i), simd::load(bs.data() + i)).store(results.data() + i);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+}
+
+BENCHMARK_TEMPLATE(scalar, fixed8, add);
+BENCHMARK_TEMPLATE(lanes, fixed8, 32, add);
+BENCHMARK_TEMPLATE(scalar, fixed8, multiply);
+BENCHMARK_TEMPLATE(lanes, fixed8, 32, multiply);
+BENCHMARK_TEMPLATE(scalar, fixed16, add);
+BENCHMARK_TEMPLATE(lanes, fixed16, 16, add);
+BENCHMARK_TEMPLATE(scalar, fixed16, multiply);
+BENCHMARK_TEMPLATE(lanes, fixed16, 16, multiply);
+BENCHMARK_TEMPLATE(scalar, fixed32, add);
+BENCHMARK_TEMPLATE(lanes, fixed32, 8, add);
+BENCHMARK_TEMPLATE(scalar, fixed32, multiply);
+BENCHMARK_TEMPLATE(lanes, fixed32, 8, multiply);
+BENCHMARK_TEMPLATE(scalar, q15, add);
+BENCHMARK_TEMPLATE(lanes, q15, 16, add);
+BENCHMARK_TEMPLATE(scalar, q15, multiply);
+BENCHMARK_TEMPLATE(lanes, q15, 16, multiply);
+BENCHMARK_TEMPLATE(scalar, q31, add);
+BENCHMARK_TEMPLATE(lanes, q31, 8, add);
+BENCHMARK_TEMPLATE(scalar, q31, multiply);
+BENCHMARK_TEMPLATE(lanes, q31, 8, multiply);
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint> // for std::int64_t
+#include <vector>
+
+#include <realnumb/fixed_math.hpp>
+#include <realnumb/interpolated_function.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 1024u;
+
+/// @brief Gets values spread evenly between the given bounds.
+template <class T>
+auto make_values(double lo, double hi) -> std::vector<T>
+{
+    auto result = std::vector<T>{};
+    result.reserve(NumValues);
+    const auto step = (hi - lo) / NumValues;
+    for (auto i = 0u; i < NumValues; ++i) {
+        result.push_back(T(lo + i * step));
+    }
+    return result;
+}
+
+template <class T, T (*Function)(T)>
+void direct(benchmark::State& state)
+{
+    const auto values = make_values<T>(0.5, 8.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(Function(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, T (*Function)(T), class Interpolation>
+void interpolated(benchmark::State& state)
+{
+    const auto values = make_values<T>(0.5, 8.0);
+    const auto function = interpolated_function<T, Function, Interpolation>{T(0.5), T(8.0)};
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(function(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+}
+
+BENCHMARK_TEMPLATE(direct, fixed32, &exp);
+BENCHMARK_TEMPLATE(interpolated, fixed32, &exp, linear_interpolation);
+BENCHMARK_TEMPLATE(interpolated, fixed32, &exp, cubic_interpolation);
+BENCHMARK_TEMPLATE(direct, fixed32, &log);
+BENCHMARK_TEMPLATE(interpolated, fixed32, &log, linear_interpolation);
+BENCHMARK_TEMPLATE(interpolated, fixed32, &log, cubic_interpolation);
+BENCHMARK_TEMPLATE(direct, fixed32, &atan);
+BENCHMARK_TEMPLATE(interpolated, fixed32, &atan, linear_interpolation);
+BENCHMARK_TEMPLATE(interpolated, fixed32, &atan, cubic_interpolation);
+
+BENCHMARK_TEMPLATE(direct, fixed64, &exp);
+BENCHMARK_TEMPLATE(interpolated, fixed64, &exp, linear_interpolation);
+BENCHMARK_TEMPLATE(interpolated, fixed64, &exp, cubic_interpolation);
+BENCHMARK_TEMPLATE(direct, fixed64, &atan);
+BENCHMARK_TEMPLATE(interpolated, fixed64, &atan, linear_interpolation);
+BENCHMARK_TEMPLATE(interpolated, fixed64, &atan, cubic_interpolation);
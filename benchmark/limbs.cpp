@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint> // for std::int64_t, std::uint32_t
+#include <vector>
+
+#include <realnumb/fixed.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 4096u;
+
+/// @brief Fraction bits of the products and quotients, like fixed64 has.
+constexpr auto FractionBits = 24u;
+
+/// @brief Gets pseudo random 64-bit values with magnitudes of up to the given bits.
+auto make_values(std::uint32_t seed, unsigned int bits) -> std::vector<std::int64_t>
+{
+    auto result = std::vector<std::int64_t>{};
+    result.reserve(NumValues);
+    auto state = std::uint64_t{seed};
+    for (auto i = 0u; i < NumValues; ++i) {
+        state = state * 6364136223846793005u + 1442695040888963407u; // LCG from Knuth's MMIX
+        const auto value = static_cast<std::int64_t>(state) >> (64u - bits);
+        result.push_back((value == 0)? 1: value);
+    }
+    return result;
+}
+
+/// @brief Multiplies 64-bit values into the wider type then rounds off the fraction bits.
+/// @note This is the work of the fixed64 multiplication operator.
+template <class T>
+void multiply_shift(benchmark::State& state)
+{
+    const auto as = make_values(12345u, 48u);
+    const auto bs = make_values(54321u, 48u);
+    auto results = std::vector<std::int64_t>(NumValues);
+    for (auto _: state) {
+        for (auto i = 0u; i < NumValues; ++i) {
+            const auto product = T{as[i]} * T{bs[i]};
+            results[i] = static_cast<std::int64_t>((product + (T{1} << (FractionBits - 1u))) >> FractionBits);
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+/// @brief Divides scaled up 64-bit values in the wider type by 64-bit values.
+/// @note This is the work of the fixed64 division operator.
+template <class T>
+void divide(benchmark::State& state)
+{
+    const auto as = make_values(12345u, 48u);
+    const auto bs = make_values(54321u, 40u);
+    auto results = std::vector<std::int64_t>(NumValues);
+    for (auto _: state) {
+        for (auto i = 0u; i < NumValues; ++i) {
+            results[i] = static_cast<std::int64_t>((T{as[i]} << FractionBits) / T{bs[i]});
+        }
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+}
+
+#ifdef REALNUMB_INT128
+BENCHMARK_TEMPLATE(multiply_shift, REALNUMB_INT128);
+BENCHMARK_TEMPLATE(divide, REALNUMB_INT128);
+#endif
+BENCHMARK_TEMPLATE(multiply_shift, limbs<2>);
+BENCHMARK_TEMPLATE(divide, limbs<2>);
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint> // for std::int64_t, std::uint32_t
+#include <vector>
+
+#include <realnumb/fixed_math.hpp>
+#include <realnumb/tabulated.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 1024u;
+
+/// @brief Gets values scattered over the whole domain of the given 16-bit type.
+/// @note These are scattered so lookups touch the whole table like arbitrary data would.
+template <class T>
+auto make_scattered() -> std::vector<T>
+{
+    auto result = std::vector<T>{};
+    result.reserve(NumValues);
+    auto state = std::uint32_t{12345u};
+    for (auto i = 0u; i < NumValues; ++i) {
+        state = state * 1664525u + 1013904223u; // LCG from Numerical Recipes
+        result.push_back(T::from_value(static_cast<decltype(T{}.get_value())>(state >> 16u)));
+    }
+    return result;
+}
+
+template <class T, T (*Function)(T)>
+void direct(benchmark::State& state)
+{
+    const auto values = make_scattered<T>();
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(Function(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, T (*Function)(T)>
+void lookup(benchmark::State& state)
+{
+    const auto values = make_scattered<T>();
+    const auto function = tabulated<T, Function>{};
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(function(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+}
+
+BENCHMARK_TEMPLATE(direct, fixed16, &sin);
+BENCHMARK_TEMPLATE(lookup, fixed16, &sin);
+BENCHMARK_TEMPLATE(direct, fixed16, &exp);
+BENCHMARK_TEMPLATE(lookup, fixed16, &exp);
+BENCHMARK_TEMPLATE(direct, fixed16, &log);
+BENCHMARK_TEMPLATE(lookup, fixed16, &log);
+BENCHMARK_TEMPLATE(direct, fixed16, &atan);
+BENCHMARK_TEMPLATE(lookup, fixed16, &atan);
+BENCHMARK_TEMPLATE(direct, fixed16, &sqrt);
+BENCHMARK_TEMPLATE(lookup, fixed16, &sqrt);
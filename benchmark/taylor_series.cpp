@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int64_t
+#include <vector>
+
+#include <realnumb/fixed.hpp>
+#include <realnumb/fixed_simd.hpp>
+#include <realnumb/taylor_series.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+constexpr auto NumValues = 1024u;
+
+/// @brief Gets values spread evenly between the given bounds.
+template <class T>
+auto make_values(double lo, double hi) -> std::vector<T>
+{
+    auto result = std::vector<T>{};
+    result.reserve(NumValues);
+    const auto step = (hi - lo) / NumValues;
+    for (auto i = 0u; i < NumValues; ++i) {
+        result.push_back(T(lo + i * step));
+    }
+    return result;
+}
+
+template <class T>
+void sin_scalar(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1.5, 1.5);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(taylor_series::sin<8>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, std::size_t N>
+void sin_lanes(benchmark::State& state)
+{
+    const auto values = make_values<T>(-1.5, 1.5);
+    for (auto _: state) {
+        for (auto i = std::size_t{0}; i < NumValues; i += N) {
+            benchmark::DoNotOptimize(taylor_series::sin<8>(fixed_simd<T, N>::load(values.data() + i)));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T>
+void exp_scalar(benchmark::State& state)
+{
+    const auto values = make_values<T>(0.0, 4.0);
+    for (auto _: state) {
+        for (const auto& value: values) {
+            benchmark::DoNotOptimize(taylor_series::exp<20>(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+template <class T, std::size_t N>
+void exp_lanes(benchmark::State& state)
+{
+    const auto values = make_values<T>(0.0, 4.0);
+    for (auto _: state) {
+        for (auto i = std::size_t{0}; i < NumValues; i += N) {
+            benchmark::DoNotOptimize(taylor_series::exp<20>(fixed_simd<T, N>::load(values.data() + i)));
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * NumValues));
+}
+
+}
+
+BENCHMARK_TEMPLATE(sin_scalar, fixed32);
+BENCHMARK_TEMPLATE(sin_lanes, fixed32, 8);
+BENCHMARK_TEMPLATE(sin_lanes, fixed32, 16);
+BENCHMARK_TEMPLATE(exp_scalar, fixed32);
+BENCHMARK_TEMPLATE(exp_lanes, fixed32, 8);
+BENCHMARK_TEMPLATE(exp_lanes, fixed32, 16);
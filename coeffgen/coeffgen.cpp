@@ -0,0 +1,370 @@
+/// @file
+/// @brief Minimax polynomial coefficient generator.
+/// @details Runs the Remez exchange algorithm for the polynomial kernels of the fixed math
+///   functions and writes a header of their coefficients. The coefficients are quantized
+///   to each working precision that the kernels evaluate in, and each table comes with the
+///   maximum error measured for those quantized coefficients. Tables of lower degrees are
+///   written too for kernels whose results don't need all of the working precision.
+/// @see https://en.wikipedia.org/wiki/Remez_algorithm
+
+#include <algorithm> // for std::max
+#include <array>
+#include <cmath>
+#include <cstdint> // for std::int64_t
+#include <fstream>
+#include <functional> // for std::function
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility> // for std::swap
+#include <vector>
+
+#if defined(REALNUMB_COEFFGEN_QUADMATH)
+extern "C" {
+#include <quadmath.h>
+}
+#endif
+
+namespace {
+
+#if defined(REALNUMB_COEFFGEN_QUADMATH)
+using real = __float128;
+constexpr auto precision_name = "__float128";
+auto real_sin(real x) -> real { return sinq(x); }
+auto real_cos(real x) -> real { return cosq(x); }
+auto real_exp(real x) -> real { return expq(x); }
+auto real_atan(real x) -> real { return atanq(x); }
+auto real_atanh(real x) -> real { return atanhq(x); }
+auto real_sqrt(real x) -> real { return sqrtq(x); }
+auto real_abs(real x) -> real { return fabsq(x); }
+auto real_round(real x) -> real { return roundq(x); }
+auto real_ldexp(real x, int e) -> real { return ldexpq(x, e); }
+const auto real_pi = M_PIq;
+#else
+using real = long double;
+constexpr auto precision_name = "long double";
+auto real_sin(real x) -> real { return std::sin(x); }
+auto real_cos(real x) -> real { return std::cos(x); }
+auto real_exp(real x) -> real { return std::exp(x); }
+auto real_atan(real x) -> real { return std::atan(x); }
+auto real_atanh(real x) -> real { return std::atanh(x); }
+auto real_sqrt(real x) -> real { return std::sqrt(x); }
+auto real_abs(real x) -> real { return std::fabs(x); }
+auto real_round(real x) -> real { return std::round(x); }
+auto real_ldexp(real x, int e) -> real { return std::ldexp(x, e); }
+const auto real_pi = 3.141592653589793238462643383279502884L;
+#endif
+
+/// @brief Working precisions to generate tables for.
+/// @note These are the numbers of fraction bits that the kernels evaluate in for the
+///   32-bit and 64-bit base types.
+constexpr auto WorkingBitsList = std::array<int, 2>{30, 62};
+
+/// @brief Fewest fraction bits of accuracy to write a table for.
+constexpr auto MinAccuracyBits = 8;
+
+/// @brief Number of points the error is sampled at between each pair of reference points.
+constexpr auto SamplesPerSegment = 64;
+
+/// @brief Maximum number of exchange iterations.
+constexpr auto MaxIterations = 40;
+
+/// @brief Polynomial kernel to generate coefficients for.
+struct kernel
+{
+    std::string name; ///< Name of the table.
+    std::string description; ///< Description of the approximated function.
+    std::function<real(real)> function; ///< Function to approximate.
+    real lo; ///< Lower bound of the interval.
+    real hi; ///< Upper bound of the interval.
+};
+
+/// @brief Evaluates the polynomial of the given coefficients at the given value.
+auto evaluate(const std::vector<real>& coefficients, real x) -> real
+{
+    auto result = real{0};
+    for (auto i = coefficients.size(); i > 0u; --i)
+    {
+        result = result * x + coefficients[i - 1u];
+    }
+    return result;
+}
+
+/// @brief Solves the given linear system in place by Gaussian elimination.
+auto solve(std::vector<std::vector<real>> a, std::vector<real> b) -> std::vector<real>
+{
+    const auto n = b.size();
+    for (auto col = std::size_t{0}; col < n; ++col)
+    {
+        auto pivot = col;
+        for (auto row = col + 1u; row < n; ++row)
+        {
+            if (real_abs(a[row][col]) > real_abs(a[pivot][col]))
+            {
+                pivot = row;
+            }
+        }
+        std::swap(a[col], a[pivot]);
+        std::swap(b[col], b[pivot]);
+        for (auto row = col + 1u; row < n; ++row)
+        {
+            const auto factor = a[row][col] / a[col][col];
+            for (auto k = col; k < n; ++k)
+            {
+                a[row][k] -= factor * a[col][k];
+            }
+            b[row] -= factor * b[col];
+        }
+    }
+    auto x = std::vector<real>(n);
+    for (auto row = n; row > 0u; --row)
+    {
+        auto sum = b[row - 1u];
+        for (auto k = row; k < n; ++k)
+        {
+            sum -= a[row - 1u][k] * x[k];
+        }
+        x[row - 1u] = sum / a[row - 1u][row - 1u];
+    }
+    return x;
+}
+
+/// @brief Finds the point of largest error magnitude within the given interval.
+auto find_extremum(const kernel& k, const std::vector<real>& coefficients, real lo, real hi) -> real
+{
+    const auto error = [&](real x) { return real_abs(evaluate(coefficients, x) - k.function(x)); };
+    auto best = lo;
+    auto best_error = error(lo);
+    for (auto i = 1; i <= SamplesPerSegment; ++i)
+    {
+        const auto x = lo + (hi - lo) * i / SamplesPerSegment;
+        if (const auto e = error(x); e > best_error)
+        {
+            best = x;
+            best_error = e;
+        }
+    }
+    // Golden section refinement around the best sample...
+    auto a = std::max(lo, best - (hi - lo) / SamplesPerSegment);
+    auto b = std::min(hi, best + (hi - lo) / SamplesPerSegment);
+    const auto ratio = (real_sqrt(real{5}) - 1) / 2;
+    for (auto i = 0; i < 100; ++i)
+    {
+        const auto c = b - ratio * (b - a);
+        const auto d = a + ratio * (b - a);
+        if (error(c) > error(d))
+        {
+            b = d;
+        }
+        else
+        {
+            a = c;
+        }
+    }
+    const auto refined = (a + b) / 2;
+    return (error(refined) > best_error)? refined: best;
+}
+
+/// @brief Finds a zero of the error between the given points where the error's sign differs.
+auto find_zero(const kernel& k, const std::vector<real>& coefficients, real lo, real hi) -> real
+{
+    const auto error = [&](real x) { return evaluate(coefficients, x) - k.function(x); };
+    const auto lo_sign = error(lo) < 0;
+    for (auto i = 0; i < 200; ++i)
+    {
+        const auto mid = (lo + hi) / 2;
+        if ((error(mid) < 0) == lo_sign)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return (lo + hi) / 2;
+}
+
+/// @brief Gets the minimax polynomial coefficients of the given degree for the given kernel.
+auto remez(const kernel& k, std::size_t degree) -> std::vector<real>
+{
+    const auto n = degree + 2u;
+    auto reference = std::vector<real>(n);
+    for (auto i = std::size_t{0}; i < n; ++i)
+    {
+        // Chebyshev extrema as initial reference...
+        const auto t = -real_cos(real_pi * static_cast<real>(i) / static_cast<real>(n - 1u));
+        reference[i] = (k.lo + k.hi) / 2 + (k.hi - k.lo) / 2 * t;
+    }
+    auto coefficients = std::vector<real>(degree + 1u);
+    for (auto iteration = 0; iteration < MaxIterations; ++iteration)
+    {
+        auto a = std::vector<std::vector<real>>(n, std::vector<real>(n));
+        auto b = std::vector<real>(n);
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            auto power = real{1};
+            for (auto j = std::size_t{0}; j <= degree; ++j)
+            {
+                a[i][j] = power;
+                power *= reference[i];
+            }
+            a[i][n - 1u] = (i % 2u == 0u)? real{1}: real{-1};
+            b[i] = k.function(reference[i]);
+        }
+        const auto solution = solve(a, b);
+        coefficients.assign(solution.begin(), solution.begin() + static_cast<std::ptrdiff_t>(degree + 1u));
+
+        // Exchange: split the interval at the error's zeros and take each part's extremum.
+        auto bounds = std::vector<real>{k.lo};
+        for (auto i = std::size_t{0}; i + 1u < n; ++i)
+        {
+            bounds.push_back(find_zero(k, coefficients, reference[i], reference[i + 1u]));
+        }
+        bounds.push_back(k.hi);
+        auto min_error = real{0};
+        auto max_error = real{0};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            reference[i] = find_extremum(k, coefficients, bounds[i], bounds[i + 1u]);
+            const auto e = real_abs(evaluate(coefficients, reference[i]) - k.function(reference[i]));
+            min_error = (i == 0u)? e: std::min(min_error, e);
+            max_error = std::max(max_error, e);
+        }
+        if (max_error - min_error <= max_error / 1000000)
+        {
+            break;
+        }
+    }
+    return coefficients;
+}
+
+/// @brief Gets the maximum error of the given quantized coefficients over the kernel's interval.
+auto measure(const kernel& k, const std::vector<std::int64_t>& quantized, int working_bits) -> real
+{
+    auto coefficients = std::vector<real>{};
+    for (const auto c: quantized)
+    {
+        coefficients.push_back(real_ldexp(static_cast<real>(c), -working_bits));
+    }
+    constexpr auto samples = 20000;
+    auto result = real{0};
+    for (auto i = 0; i <= samples; ++i)
+    {
+        const auto x = k.lo + (k.hi - k.lo) * i / samples;
+        result = std::max(result, real_abs(evaluate(coefficients, x) - k.function(x)));
+    }
+    return result;
+}
+
+/// @brief Gets the base two logarithm of the given positive value as a double.
+auto log2_of(real value) -> double
+{
+    return std::log2(static_cast<double>(value));
+}
+
+/// @brief Writes the tables of the given kernel.
+/// @details For each working precision this writes a table for each degree, from the
+///   lowest degree meeting @c MinAccuracyBits up to the one whose error is within the
+///   working precision's resolution. Each table is keyed by the number of fraction bits
+///   it's accurate to. Degrees not adding any accuracy bits over the previous degree are
+///   skipped.
+void write_kernel(std::ostream& os, const kernel& k)
+{
+    os << "/// @brief Minimax coefficients for " << k.description << ".\n";
+    os << "/// @note Primary template for working and accuracy precisions without a table.\n";
+    os << "template <unsigned int WorkingBits, unsigned int AccuracyBits>\n";
+    os << "struct " << k.name << "\n";
+    os << "{\n";
+    os << "    static constexpr auto available = false; ///< Whether there's a table.\n";
+    os << "};\n\n";
+    for (const auto working_bits: WorkingBitsList)
+    {
+        const auto target = real_ldexp(real{1}, -working_bits);
+        auto last_accuracy = 0;
+        auto error = target * 2;
+        for (auto degree = std::size_t{1}; (degree < 30u) && (error > target); ++degree)
+        {
+            auto quantized = std::vector<std::int64_t>{};
+            for (const auto c: remez(k, degree))
+            {
+                quantized.push_back(static_cast<std::int64_t>(real_round(real_ldexp(c, working_bits))));
+            }
+            error = measure(k, quantized, working_bits);
+            const auto accuracy = static_cast<int>(std::floor(-log2_of(error)));
+            if ((accuracy < MinAccuracyBits) || (accuracy <= last_accuracy))
+            {
+                continue;
+            }
+            last_accuracy = accuracy;
+            os << "/// @brief Minimax coefficients for " << k.description << " with "
+               << working_bits << " fraction bits,\n";
+            os << "///   accurate to " << accuracy << " fraction bits.\n";
+            os << "/// @note Maximum measured error is 2^" << log2_of(error) << ".\n";
+            os << "template <>\n";
+            os << "struct " << k.name << "<" << working_bits << "u, " << accuracy << "u>\n";
+            os << "{\n";
+            os << "    static constexpr auto available = true; ///< Whether there's a table.\n";
+            os << "    /// @brief Coefficients in order of increasing power.\n";
+            os << "    static constexpr auto coefficients = std::array<std::int64_t, "
+               << quantized.size() << ">{\n";
+            for (auto i = std::size_t{0}; i < quantized.size(); ++i)
+            {
+                os << "        " << quantized[i] << "ll" << ((i + 1u < quantized.size())? ",": "") << "\n";
+            }
+            os << "    };\n";
+            os << "};\n\n";
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const auto kernels = std::vector<kernel>{
+        {"minimax_exp", "e^r for r in [-0.35, 0.35]",
+            [](real x) { return real_exp(x); }, real{-0.35L}, real{0.35L}},
+        {"minimax_sin", "sin(r) / r in z = r^2 for r in [-0.79, 0.79]",
+            [](real z) { return (z == 0)? real{1}: real_sin(real_sqrt(z)) / real_sqrt(z); },
+            real{0}, real{0.79L} * real{0.79L}},
+        {"minimax_cos", "cos(r) in z = r^2 for r in [-0.79, 0.79]",
+            [](real z) { return real_cos(real_sqrt(z)); },
+            real{0}, real{0.79L} * real{0.79L}},
+        {"minimax_atanh", "atanh(s) / s in z = s^2 for s in [-0.172, 0.172]",
+            [](real z) { return (z == 0)? real{1}: real_atanh(real_sqrt(z)) / real_sqrt(z); },
+            real{0}, real{0.172L} * real{0.172L}},
+        {"minimax_atan", "atan(t) / t in z = t^2 for t in [-0.268, 0.268]",
+            [](real z) { return (z == 0)? real{1}: real_atan(real_sqrt(z)) / real_sqrt(z); },
+            real{0}, real{0.268L} * real{0.268L}},
+    };
+    auto os = std::ostringstream{};
+    os << "#ifndef REALNUMB_MINIMAX_HPP\n";
+    os << "#define REALNUMB_MINIMAX_HPP\n\n";
+    os << "/// @file\n";
+    os << "/// @brief Minimax polynomial coefficients for the kernels of the fixed math functions.\n";
+    os << "/// @note Generated by the realnumb_coeffgen tool using " << precision_name << ".\n";
+    os << "///   Don't edit this by hand, regenerate it instead.\n\n";
+    os << "#include <array> // for std::array\n";
+    os << "#include <cstdint> // for std::int64_t\n\n";
+    os << "namespace realnumb::detail {\n\n";
+    for (const auto& k: kernels)
+    {
+        write_kernel(os, k);
+    }
+    os << "} // namespace realnumb::detail\n\n";
+    os << "#endif // REALNUMB_MINIMAX_HPP\n";
+    if (argc > 1)
+    {
+        auto file = std::ofstream{argv[1]};
+        if (!file)
+        {
+            std::cerr << "unable to open " << argv[1] << "\n";
+            return 1;
+        }
+        file << os.str();
+        return 0;
+    }
+    std::cout << os.str();
+    return 0;
+}
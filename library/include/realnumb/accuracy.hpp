@@ -0,0 +1,43 @@
+#ifndef REALNUMB_ACCURACY_HPP
+#define REALNUMB_ACCURACY_HPP
+
+/// @file
+/// @brief Accuracy tiers of the math functions.
+/// @details The math functions for the fixed types take one of these as an optional first
+///   template parameter, like <code>sin<fast>(x)</code>. Each tier sets how many fraction
+///   bits beyond the fixed type's that the functions' polynomial kernels are accurate to.
+///   That's what their term counts derive from. Functions having no polynomial kernel,
+///   like @c sqrt and @c cbrt, take these too but are correctly rounded for every tier.
+
+namespace realnumb {
+
+/// @brief Accuracy tier of the math functions that's the default.
+/// @details Results are correctly rounded except when they're within about
+///   <code>2^-12</code> of an ulp of a tie. So they're within half an ulp and a little.
+///   The exponential functions are within an ulp across their whole range.
+struct precise
+{
+    /// @brief Fraction bits beyond the fixed type's that the kernels are accurate to.
+    static constexpr auto guard_bits = 12;
+};
+
+/// @brief Accuracy tier of the math functions for results within an ulp of the
+///   @c precise tier's results.
+struct balanced
+{
+    /// @brief Fraction bits beyond the fixed type's that the kernels are accurate to.
+    static constexpr auto guard_bits = 2;
+};
+
+/// @brief Accuracy tier of the math functions for results within four ulps of the
+///   @c precise tier's results.
+struct fast
+{
+    /// @brief Fraction bits beyond the fixed type's that the kernels are accurate to.
+    /// @note This is negative since the kernels can be off by a couple of ulps.
+    static constexpr auto guard_bits = -1;
+};
+
+}
+
+#endif /* REALNUMB_ACCURACY_HPP */
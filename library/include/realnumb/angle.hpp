@@ -0,0 +1,305 @@
+#ifndef REALNUMB_ANGLE_HPP
+#define REALNUMB_ANGLE_HPP
+
+/// @file
+/// @brief Definition of the @c angle class template and closely related code.
+
+#include <cstdint> // for std::int32_t
+#include <type_traits> // for std::make_unsigned_t
+#include <utility> // for std::pair
+
+#include <realnumb/fixed.hpp>
+#include <realnumb/fixed_math.hpp>
+
+namespace realnumb {
+
+/// @brief Template class for binary angle measurement (BAM) values.
+/// @details This is an angle type for which the full range of the given integral base type
+///   represents exactly one turn. So adding, subtracting, or scaling these values wraps
+///   around the circle for free through two's complement arithmetic without any need for
+///   renormalizing. Moreover, the quadrant of the angle is simply the top two bits of its
+///   value so the trigonometric functions don't need any range reduction.
+/// @note Like @c fixed, this satisfies the <code>LiteralType</code> named requirement.
+/// @see https://en.wikipedia.org/wiki/Binary_angular_measurement
+/// @see fixed
+template <typename BaseType>
+class angle
+{
+public:
+
+    /// @brief Value type.
+    using value_type = BaseType;
+
+    /// @brief Bits per byte.
+    static constexpr auto bits_per_byte = 8u;
+
+    /// @brief Total number of bits.
+    static constexpr auto total_bits = static_cast<unsigned int>(sizeof(BaseType) * bits_per_byte);
+
+    /// @brief Gets the value for the given angle in radians.
+    /// @note Non-finite values are treated as zero.
+    template <unsigned int FB>
+    static constexpr auto to_value(fixed<BaseType, FB> radians) noexcept -> value_type
+    {
+        if (!radians.isfinite())
+        {
+            return 0;
+        }
+        // q = 2n - 2 - FB fractional bits for 2/pi keeps r * (2/pi) within the wider type.
+        constexpr auto shift = total_bits;
+        constexpr auto two_over_pi = detail::scaled_constant<wider_type>(
+            detail::TwoOverPiBits, 2u * total_bits - 2u - FB);
+        const auto reduced = detail::quadrant_reduce(radians);
+        const auto offset = (wider_type{reduced.angle.get_value()} * two_over_pi
+                             + (wider_type{1} << (shift - 1u))) >> shift;
+        return static_cast<value_type>(static_cast<unsigned_type>(
+            (static_cast<unsigned_type>(reduced.quadrant) << (total_bits - 2u))
+            + static_cast<unsigned_type>(offset)));
+    }
+
+    /// @brief Gets the angle for the given value in internal form.
+    /// @see get_value.
+    static constexpr auto from_value(value_type val) noexcept -> angle
+    {
+        auto result = angle{};
+        result.m_value = val;
+        return result;
+    }
+
+    angle() = default;
+
+    /// @brief Initializing constructor from an angle in radians.
+    /// @note Non-finite values are treated as zero.
+    template <unsigned int FB>
+    explicit constexpr angle(fixed<BaseType, FB> radians) noexcept:
+        m_value{to_value(radians)}
+    {
+        // Intentionally empty.
+    }
+
+    // Methods
+
+    /// @brief Gets this value in its internal form.
+    constexpr auto get_value() const noexcept -> value_type
+    {
+        return m_value;
+    }
+
+    /// @brief Gets the nearest quadrant index from 0 to 3.
+    /// @details This is the top two bits of the value after rounding to the nearest
+    ///   quarter turn.
+    constexpr auto quadrant() const noexcept -> unsigned int
+    {
+        constexpr auto shift = total_bits - 2u;
+        const auto rounded = static_cast<unsigned_type>(static_cast<unsigned_type>(m_value)
+                                                        + (unsigned_type{1} << (shift - 1u)));
+        return static_cast<unsigned int>(rounded >> shift) & 3u;
+    }
+
+    /// @brief Gets the signed remainder of this angle from its nearest quadrant.
+    /// @return Value from <code>-2^(total_bits - 3)</code> to <code>+2^(total_bits - 3)</code>.
+    constexpr auto quadrant_offset() const noexcept -> value_type
+    {
+        const auto base = static_cast<unsigned_type>(quadrant()) << (total_bits - 2u);
+        return static_cast<value_type>(static_cast<unsigned_type>(
+            static_cast<unsigned_type>(m_value) - base));
+    }
+
+    /// @brief Converts this angle to radians within <code>-pi</code> and <code>+pi</code>.
+    template <unsigned int FB>
+    constexpr auto to_radians() const noexcept -> fixed<BaseType, FB>
+    {
+        static_assert(FB + 3u <= total_bits, "fixed type must be able to hold +/- pi");
+        // q = n - 1 fractional bits for pi/2 keeps value * (pi/2) within the wider type.
+        constexpr auto q = total_bits - 1u;
+        constexpr auto shift = q + total_bits - 2u - FB;
+        constexpr auto half_pi = detail::scaled_constant<wider_type>(detail::HalfPiBits, q);
+        const auto result = (wider_type{m_value} * half_pi + (wider_type{1} << (shift - 1u))) >> shift;
+        return fixed<BaseType, FB>::from_value(static_cast<value_type>(result));
+    }
+
+    /// @brief To radians operator.
+    template <unsigned int FB>
+    explicit constexpr operator fixed<BaseType, FB>() const noexcept
+    {
+        return to_radians<FB>();
+    }
+
+    /// @brief Negation operator.
+    constexpr auto operator- () const noexcept -> angle
+    {
+        return from_value(static_cast<value_type>(
+            static_cast<unsigned_type>(unsigned_type{0} - static_cast<unsigned_type>(m_value))));
+    }
+
+    /// @brief Positive operator.
+    constexpr auto operator+ () const noexcept -> angle
+    {
+        return *this;
+    }
+
+    /// @brief Addition assignment operator.
+    /// @note This wraps around the circle.
+    constexpr auto operator+= (angle val) noexcept -> angle&
+    {
+        m_value = static_cast<value_type>(static_cast<unsigned_type>(
+            static_cast<unsigned_type>(m_value) + static_cast<unsigned_type>(val.m_value)));
+        return *this;
+    }
+
+    /// @brief Subtraction assignment operator.
+    /// @note This wraps around the circle.
+    constexpr auto operator-= (angle val) noexcept -> angle&
+    {
+        m_value = static_cast<value_type>(static_cast<unsigned_type>(
+            static_cast<unsigned_type>(m_value) - static_cast<unsigned_type>(val.m_value)));
+        return *this;
+    }
+
+    /// @brief Multiplication assignment operator.
+    /// @note This wraps around the circle.
+    constexpr auto operator*= (value_type val) noexcept -> angle&
+    {
+        // Multiplies in at least unsigned int to avoid promotion to signed int...
+        using promoted_type = decltype(unsigned_type{} + 0u);
+        m_value = static_cast<value_type>(static_cast<unsigned_type>(
+            static_cast<promoted_type>(static_cast<unsigned_type>(m_value))
+            * static_cast<promoted_type>(static_cast<unsigned_type>(val))));
+        return *this;
+    }
+
+private:
+
+    /// @brief Widened type alias.
+    using wider_type = typename detail::wider<value_type>::type;
+
+    /// @brief Unsigned type alias.
+    using unsigned_type = std::make_unsigned_t<value_type>;
+
+    value_type m_value; ///< Value in internal form.
+};
+
+/// @brief Equality operator.
+template <typename BT>
+constexpr bool operator== (angle<BT> lhs, angle<BT> rhs) noexcept
+{
+    return lhs.get_value() == rhs.get_value();
+}
+
+/// @brief Inequality operator.
+template <typename BT>
+constexpr bool operator!= (angle<BT> lhs, angle<BT> rhs) noexcept
+{
+    return lhs.get_value() != rhs.get_value();
+}
+
+/// @brief Addition operator.
+template <typename BT>
+constexpr angle<BT> operator+ (angle<BT> lhs, angle<BT> rhs) noexcept
+{
+    lhs += rhs;
+    return lhs;
+}
+
+/// @brief Subtraction operator.
+template <typename BT>
+constexpr angle<BT> operator- (angle<BT> lhs, angle<BT> rhs) noexcept
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+/// @brief Multiplication operator.
+template <typename BT>
+constexpr angle<BT> operator* (angle<BT> lhs, BT rhs) noexcept
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+/// @brief Multiplication operator.
+template <typename BT>
+constexpr angle<BT> operator* (BT lhs, angle<BT> rhs) noexcept
+{
+    rhs *= lhs;
+    return rhs;
+}
+
+/// @brief Computes the sine of the given angle.
+/// @details The quadrant comes straight from the top bits of the angle so no range
+///   reduction is needed.
+/// @return Value between -1 and +1 in the requested fixed point format.
+template <unsigned int FB, typename BT>
+constexpr auto sin(angle<BT> arg) noexcept -> fixed<BT, FB>
+{
+    const auto offset = angle<BT>::from_value(arg.quadrant_offset());
+    const auto reduced = detail::quadrant_angle<BT, FB>{
+        arg.quadrant(), offset.template to_radians<FB>()
+    };
+    return detail::sin(reduced);
+}
+
+/// @brief Computes the sine of the given angle for the default fixed type of the base type.
+template <typename BT>
+constexpr auto sin(angle<BT> arg) noexcept
+    -> fixed<BT, detail::fixed_default<BT>::fraction_bits>
+{
+    return sin<detail::fixed_default<BT>::fraction_bits>(arg);
+}
+
+/// @brief Computes the cosine of the given angle.
+/// @return Value between -1 and +1 in the requested fixed point format.
+template <unsigned int FB, typename BT>
+constexpr auto cos(angle<BT> arg) noexcept -> fixed<BT, FB>
+{
+    // cos(x) is sin(x + 1/4 turn)...
+    constexpr auto quarter_turn = static_cast<BT>(BT{1} << (angle<BT>::total_bits - 2u));
+    return sin<FB>(arg + angle<BT>::from_value(quarter_turn));
+}
+
+/// @brief Computes the cosine of the given angle for the default fixed type of the base type.
+template <typename BT>
+constexpr auto cos(angle<BT> arg) noexcept
+    -> fixed<BT, detail::fixed_default<BT>::fraction_bits>
+{
+    return cos<detail::fixed_default<BT>::fraction_bits>(arg);
+}
+
+/// @brief Computes both the sine and cosine of the given angle.
+/// @return Pair whose first value is the sine and whose second value is the cosine.
+template <unsigned int FB, typename BT>
+constexpr auto sincos(angle<BT> arg) noexcept -> std::pair<fixed<BT, FB>, fixed<BT, FB>>
+{
+    return {sin<FB>(arg), cos<FB>(arg)};
+}
+
+/// @brief Computes both the sine and cosine of the given angle for the default fixed
+///   type of the base type.
+template <typename BT>
+constexpr auto sincos(angle<BT> arg) noexcept
+    -> std::pair<fixed<BT, detail::fixed_default<BT>::fraction_bits>,
+                 fixed<BT, detail::fixed_default<BT>::fraction_bits>>
+{
+    return sincos<detail::fixed_default<BT>::fraction_bits>(arg);
+}
+
+/// @brief 32-bit binary angle type.
+/// @details One turn is 2^32 units, or about 1.46e-9 radians per unit.
+/// @see angle, fixed32
+using angle32 = angle<std::int32_t>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<angle32>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<angle32>); // trivially copyable & trivial default ctor
+
+/// @brief 64-bit binary angle type.
+/// @see angle, fixed64
+using angle64 = angle<std::int64_t>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<angle64>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<angle64>); // trivially copyable & trivial default ctor
+
+} // namespace realnumb
+
+#endif // REALNUMB_ANGLE_HPP
@@ -0,0 +1,781 @@
+#ifndef REALNUMB_BATCH_HPP
+#define REALNUMB_BATCH_HPP
+
+/// @file
+/// @brief Math functions of whole arrays of fixed values.
+/// @details Each function works through its arguments a block at a time in separate
+///   passes. The first pass saves the block's arguments and replaces the special values,
+///   like the infinities and not-a-number, with harmless ones so the kernel doesn't need
+///   to branch on them. The second pass evaluates the kernel on those, and a last pass
+///   fixes up the results of the special values. So the loops of the first two passes are
+///   free of data-dependent branches and the compiler vectorizes them.
+/// @details The kernels of the trigonometric, exponential and logarithmic functions do
+///   their range reductions and evaluate their polynomials in @c double lanes, since
+///   their counterparts for a single value multiply in the wider type and most targets
+///   have no vector multiply for that. So these are only for base types of up to 32 bits,
+///   like that of @c fixed32.
+/// @note The square root functions' results are the same as those of the corresponding
+///   math functions of a single value, bit for bit. The other functions' kernels are
+///   accurate to two more bits than the accuracy tier's. So for the @c precise tier, their
+///   results are correctly rounded except where the exact value is within
+///   <code>2^-KernelGuardBits</code> of an ulp of a rounding boundary. So they can differ
+///   from the results of the math functions of a single value where those round an
+///   intermediate value, like the reduced angle of @c sin or the ratio of @c atan2, or
+///   where those are only within an ulp, like @c exp for large results.
+/// @note The results may be written over the arguments.
+
+#include <algorithm> // for std::min, std::max
+#include <array> // for std::array
+#include <cassert> // for assert
+#include <cmath> // for std::sqrt, std::abs
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int32_t, std::uint64_t
+#include <cstring> // for std::memcpy
+#include <iterator> // for std::data, std::size
+#include <limits> // for std::numeric_limits
+
+#include <realnumb/fixed.hpp>
+#include <realnumb/fixed_math.hpp>
+#include <realnumb/poly.hpp>
+
+namespace realnumb {
+
+namespace batch {
+
+/// @brief Number of values the functions work on per pass.
+/// @details The block's intermediate values fit in the first level data cache with room
+///   to spare.
+constexpr auto block_size = std::size_t{64};
+
+namespace detail {
+
+/// @brief Whether the trigonometric, exponential and logarithmic functions have kernels
+///   for the given base type.
+/// @details Their kernels need the internal values, and the products of the quadrant
+///   counts with the leading part of <code>pi / 2</code>, to be exact in @c double.
+template <typename BT>
+constexpr auto has_double_kernels = std::numeric_limits<BT>::digits <= 31;
+
+/// @brief Value that rounds doubles of smaller magnitudes to integers when added to them.
+constexpr auto RoundingBias = 0x1.8p52;
+
+/// @brief Mask of the significand bits of a @c double, without its leading one.
+constexpr auto MantissaMask = (std::uint64_t{1} << 52u) - 1u;
+
+/// @brief Parts of <code>pi / 2</code>.
+/// @details The first two parts have 21 significant bits each, so their products with
+///   quadrant counts of up to 31 bits are exact. The last part has the next 53 bits.
+constexpr auto HalfPiParts = std::array<double, 3u>{
+    0x1.921fb00000000p+0, 0x1.5110b00000000p-22, 0x1.18469898cc517p-44
+};
+
+/// @brief Parts of <code>ln(2)</code>.
+/// @details The first part has 31 significant bits, so its products with powers of two
+///   of up to 22 bits are exact.
+constexpr auto Ln2Parts = std::array<double, 2u>{0x1.62e42fee00000p-1, 0x1.a39ef35793c76p-33};
+
+constexpr auto Ln2 = 0x1.62e42fefa39efp-1; ///< <code>ln(2)</code>.
+constexpr auto Pi = 0x1.921fb54442d18p+1; ///< <code>pi</code>.
+constexpr auto HalfPi = 0x1.921fb54442d18p+0; ///< <code>pi / 2</code>.
+constexpr auto SixthPi = 0x1.0c152382d7366p-1; ///< <code>pi / 6</code>.
+constexpr auto TwoOverPi = 0x1.45f306dc9c883p-1; ///< <code>2 / pi</code>.
+constexpr auto Log2E = 0x1.71547652b82fep+0; ///< <code>log2(e)</code>.
+constexpr auto Sqrt2 = 0x1.6a09e667f3bcdp+0; ///< Square root of two.
+constexpr auto Sqrt3 = 0x1.bb67ae8584caap+0; ///< Square root of three.
+constexpr auto TwoMinusSqrt3 = 0x1.126145e9ecd56p-2; ///< <code>2 - sqrt(3)</code>.
+
+/// @brief Calls the given function for every block of the given number of values.
+/// @param function Function taking the offset of a block and its number of values.
+template <typename Function>
+void for_each_block(std::size_t count, Function function)
+{
+    for (auto offset = std::size_t{0}; offset < count; offset += block_size)
+    {
+        function(offset, std::min(block_size, count - offset));
+    }
+}
+
+/// @brief Gets the bits of the given double.
+inline auto to_bits(double value) noexcept -> std::uint64_t
+{
+    auto result = std::uint64_t{};
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+/// @brief Gets the double having the given bits.
+inline auto from_bits(std::uint64_t bits) noexcept -> double
+{
+    auto result = double{};
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+/// @brief Rounds the given value to the nearest integer, with halfway cases to even.
+/// @note Unlike <code>std::nearbyint</code>, this is just two additions. So loops of it
+///   vectorize.
+/// @pre The value's magnitude is less than <code>2^51</code>.
+constexpr auto round_to_integer(double value) noexcept -> double
+{
+    return (value + RoundingBias) - RoundingBias;
+}
+
+/// @brief Gets two to the power of the given integral value.
+/// @pre The value is integral and from -1022 to 1023.
+inline auto power_of_two(double value) noexcept -> double
+{
+    // The low bits of the biased value are the integer's in two's complement...
+    return from_bits((to_bits(value + RoundingBias) + 1023u) << 52u);
+}
+
+/// @brief Raises the given value to the given non-negative power.
+constexpr auto power(double value, std::size_t n) noexcept -> double
+{
+    auto result = 1.0;
+    for (auto i = std::size_t{0}; i < n; ++i)
+    {
+        result *= value;
+    }
+    return result;
+}
+
+/// @brief Gets the reciprocal of the factorial of the given number.
+constexpr auto reciprocal_factorial(std::size_t n) noexcept -> double
+{
+    auto result = 1.0L;
+    for (auto i = std::size_t{2}; i <= n; ++i)
+    {
+        result /= static_cast<long double>(i);
+    }
+    return static_cast<double>(result);
+}
+
+/// @brief Gets the number of terms of a series that's accurate to the given bits.
+/// @param bound Function of a number of terms that bounds the error of that many.
+template <typename Bound>
+constexpr auto series_terms(unsigned int bits, Bound bound) noexcept -> std::size_t
+{
+    const auto limit = power(0.5, bits);
+    auto n = std::size_t{1};
+    while (!(bound(n) < limit))
+    {
+        ++n;
+    }
+    return n;
+}
+
+/// @brief Gets the given number of coefficients of a series.
+/// @param coefficient Function of the index of a coefficient that gets it.
+template <std::size_t N, typename Coefficient>
+constexpr auto series_coefficients(Coefficient coefficient) noexcept -> std::array<double, N>
+{
+    auto result = std::array<double, N>{};
+    for (auto i = std::size_t{0}; i < N; ++i)
+    {
+        result[i] = coefficient(i);
+    }
+    return result;
+}
+
+/// @brief Number of fraction bits that the kernels of the functions having bounded
+///   results are accurate to for the given accuracy tier and fixed type.
+/// @details That's the tier's bits beyond the fraction bits and two more for the rounding
+///   errors of the range reductions and of the polynomials. Unlike for the functions of a
+///   single value, this isn't limited by the working bits of the fixed type.
+/// @see precise, balanced, fast.
+template <typename Tier, typename BT, unsigned int FB>
+constexpr auto KernelBits =
+    static_cast<unsigned int>(std::max(static_cast<int>(FB) + Tier::guard_bits, 1)) + 2u;
+
+/// @brief Gets the internal value of the given fixed type nearest to the given value.
+/// @pre The value is within the fixed type's range.
+template <typename BT, unsigned int FB>
+auto to_fixed(double value) noexcept -> fixed<BT, FB>
+{
+    constexpr auto scale = static_cast<double>(std::uint64_t{1} << FB);
+    return fixed<BT, FB>::from_value(static_cast<BT>(static_cast<std::int32_t>(round_to_integer(value * scale))));
+}
+
+/// @brief Computes the sines of the given finite internal values turned by the given
+///   number of quarter turns.
+/// @details Takes the half turn count <code>k = round((x + q pi / 2) / pi)</code>,
+///   subtracts <code>(2 k - q) pi / 2</code> in parts, and evaluates the Maclaurin series
+///   of the sine of the remainder. The parity of the count gives the sign.
+/// @note This is the cosine for one quarter turn. Evaluating the one series over the
+///   wider remainder takes fewer operations than evaluating both series over the quarter
+///   as <code>sincos_kernel</code> does.
+template <typename Tier, typename BT, unsigned int FB>
+void sin_kernel(const BT* values, std::size_t count, unsigned int quarter_turns,
+                fixed<BT, FB>* results) noexcept
+{
+    constexpr auto bits = KernelBits<Tier, BT, FB>;
+    constexpr auto half_pi = 1.58;
+    constexpr auto terms = series_terms(bits, [](std::size_t n) {
+        return power(half_pi, 2u * n + 1u) * reciprocal_factorial(2u * n + 1u);
+    });
+    constexpr auto coefficients = series_coefficients<terms>([](std::size_t i) {
+        return ((i % 2u)? -1.0: 1.0) * reciprocal_factorial(2u * i + 1u);
+    });
+    constexpr auto unscale = 1.0 / static_cast<double>(std::uint64_t{1} << FB);
+    const auto offset = 0.5 * quarter_turns;
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto x = static_cast<double>(values[i]) * unscale;
+        const auto biased = (x * (0.5 * TwoOverPi) + offset) + RoundingBias;
+        const auto m = 2.0 * (biased - RoundingBias) - quarter_turns;
+        const auto r = ((x - m * HalfPiParts[0]) - m * HalfPiParts[1]) - m * HalfPiParts[2];
+        // The lowest bit of the biased count is its own, so it's the sign bit...
+        const auto sign = (to_bits(biased) & 1u) << 63u;
+        results[i] = to_fixed<BT, FB>(from_bits(to_bits(r * poly::horner(r * r, coefficients)) ^ sign));
+    }
+}
+
+/// @brief Computes the sines and the cosines of the given finite internal values.
+/// @details Takes the quadrant count <code>k = round(x 2 / pi)</code>, subtracts
+///   <code>k pi / 2</code> in parts, and evaluates the Maclaurin series of the sine and of
+///   the cosine of the remainder. The quadrant selects which of those and their signs.
+template <typename Tier, typename BT, unsigned int FB>
+void sincos_kernel(const BT* values, std::size_t count,
+                   fixed<BT, FB>* sines, fixed<BT, FB>* cosines) noexcept
+{
+    constexpr auto bits = KernelBits<Tier, BT, FB>;
+    constexpr auto quarter_pi = 0.79;
+    constexpr auto sin_terms = series_terms(bits, [](std::size_t n) {
+        return power(quarter_pi, 2u * n + 1u) * reciprocal_factorial(2u * n + 1u);
+    });
+    constexpr auto cos_terms = series_terms(bits, [](std::size_t n) {
+        return power(quarter_pi, 2u * n) * reciprocal_factorial(2u * n);
+    });
+    constexpr auto sin_coefficients = series_coefficients<sin_terms>([](std::size_t i) {
+        return ((i % 2u)? -1.0: 1.0) * reciprocal_factorial(2u * i + 1u);
+    });
+    constexpr auto cos_coefficients = series_coefficients<cos_terms>([](std::size_t i) {
+        return ((i % 2u)? -1.0: 1.0) * reciprocal_factorial(2u * i);
+    });
+    constexpr auto unscale = 1.0 / static_cast<double>(std::uint64_t{1} << FB);
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto x = static_cast<double>(values[i]) * unscale;
+        const auto biased = x * TwoOverPi + RoundingBias;
+        const auto k = biased - RoundingBias;
+        const auto r = ((x - k * HalfPiParts[0]) - k * HalfPiParts[1]) - k * HalfPiParts[2];
+        const auto z = r * r;
+        const auto s = to_bits(r * poly::horner(z, sin_coefficients));
+        const auto c = to_bits(poly::horner(z, cos_coefficients));
+        // The low bits of the biased count are its own, so they select the results and
+        // their sign bits...
+        const auto quadrant = to_bits(biased);
+        const auto odd = std::uint64_t{0} - (quadrant & 1u);
+        sines[i] = to_fixed<BT, FB>(from_bits(((s & ~odd) | (c & odd)) ^ ((quadrant & 2u) << 62u)));
+        cosines[i] = to_fixed<BT, FB>(from_bits(((c & ~odd) | (s & odd)) ^ (((quadrant + 1u) & 2u) << 62u)));
+    }
+}
+
+/// @brief Internal value of the given fixed type below which the exponential rounds to
+///   zero.
+/// @details That's where it's less than a quarter of the fixed type's resolution.
+template <typename BT, unsigned int FB>
+constexpr auto ExpLowest = static_cast<BT>(std::max(-(FB + 2.0) * Ln2Parts[0] * (std::uint64_t{1} << FB),
+                                                    static_cast<double>(std::numeric_limits<BT>::min())));
+
+/// @brief Internal value of the given fixed type above which the exponential saturates
+///   to positive infinity.
+/// @details That's where it's at least half an ulp more than the fixed type's largest
+///   value, which is one ulp less than two to the power of the fixed type's integer bits.
+///   So the exponentials of the values up to this fit the base type.
+template <typename BT, unsigned int FB>
+constexpr auto ExpHighest = static_cast<BT>(std::min(
+    (std::numeric_limits<BT>::digits - static_cast<int>(FB)) * Ln2 * (std::uint64_t{1} << FB) -
+        1.5 * (std::uint64_t{1} << FB) / (std::uint64_t{1} << std::numeric_limits<BT>::digits),
+    static_cast<double>(std::numeric_limits<BT>::max())));
+
+/// @brief Computes Euler's number raised to the powers of the given internal values.
+/// @details Takes <code>k = round(x / ln(2))</code>, subtracts <code>k ln(2)</code> in
+///   parts, and evaluates the Maclaurin series of the exponential of the remainder. That's
+///   scaled by two to the power of @c k.
+/// @pre The values are from @c ExpLowest to @c ExpHighest.
+template <typename Tier, typename BT, unsigned int FB>
+void exp_kernel(const BT* values, std::size_t count, fixed<BT, FB>* results) noexcept
+{
+    // Results can have all of the fixed type's bits, so this is relative to those...
+    constexpr auto total_bits = static_cast<int>(fixed<BT, FB>::total_bits);
+    constexpr auto bits = static_cast<unsigned int>(std::max(total_bits + 1 + Tier::guard_bits, 1));
+    constexpr auto terms = series_terms(bits, [](std::size_t n) {
+        return 2.0 * power(0.35, n) * reciprocal_factorial(n);
+    });
+    constexpr auto coefficients = series_coefficients<terms>(reciprocal_factorial);
+    constexpr auto unscale = 1.0 / static_cast<double>(std::uint64_t{1} << FB);
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto x = static_cast<double>(values[i]) * unscale;
+        const auto k = round_to_integer(x * Log2E);
+        const auto r = (x - k * Ln2Parts[0]) - k * Ln2Parts[1];
+        results[i] = to_fixed<BT, FB>(poly::horner(r, coefficients) * power_of_two(k));
+    }
+}
+
+/// @brief Computes the natural logarithms of the given positive finite internal values.
+/// @details Splits each value into <code>2^e m</code> with @c m from about
+///   <code>sqrt(2) / 2</code> to <code>sqrt(2)</code>, and evaluates the series of
+///   <code>2 atanh(s)</code> for <code>s = (m - 1) / (m + 1)</code>. That's added to
+///   <code>e ln(2)</code> in parts.
+template <typename Tier, typename BT, unsigned int FB>
+void log_kernel(const BT* values, std::size_t count, fixed<BT, FB>* results) noexcept
+{
+    // The magnitude of s is at most 3 - 2 sqrt(2)...
+    constexpr auto terms = series_terms(KernelBits<Tier, BT, FB>, [](std::size_t n) {
+        return 2.1 * power(0.1716, 2u * n + 1u) / static_cast<double>(2u * n + 1u);
+    });
+    constexpr auto coefficients = series_coefficients<terms>([](std::size_t i) {
+        return 2.0 / static_cast<double>(2u * i + 1u);
+    });
+    constexpr auto one_exponent = std::uint64_t{1023u} << 52u;
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto bits = to_bits(static_cast<double>(values[i]));
+        // The sign of the difference says whether the significand is above sqrt(2), and
+        // moving one from its exponent field to the value's halves it. That takes neither
+        // 64-bit integer compares nor branches...
+        const auto significand = from_bits((bits & MantissaMask) | one_exponent);
+        const auto step = (to_bits(Sqrt2 - significand) >> 63u) << 52u;
+        const auto mantissa = from_bits(to_bits(significand) - step);
+        const auto biased = from_bits(((bits + step) >> 52u) | to_bits(0x1p52)) - 0x1p52;
+        const auto e = biased - (1023.0 + FB);
+        const auto s = (mantissa - 1.0) / (mantissa + 1.0);
+        const auto sum = s * poly::horner(s * s, coefficients);
+        results[i] = to_fixed<BT, FB>(e * Ln2Parts[0] + (e * Ln2Parts[1] + sum));
+    }
+}
+
+/// @brief Computes the multi-valued inverse tangents of the given pairs of finite
+///   internal values.
+/// @details Gets the arctangent of the ratio of the magnitudes from
+///   <code>pi / 2 - atan(1 / t)</code> for @c t greater than one, then from
+///   <code>pi / 6 + atan((sqrt(3) t - 1) / (sqrt(3) + t))</code> for @c t greater than
+///   <code>2 - sqrt(3)</code>, and from the Maclaurin series of that. The signs of the
+///   values select the quadrant.
+/// @pre None of the @c x values are zero.
+template <typename Tier, typename BT, unsigned int FB>
+void atan2_kernel(const BT* ys, const BT* xs, std::size_t count, fixed<BT, FB>* results) noexcept
+{
+    constexpr auto terms = series_terms(KernelBits<Tier, BT, FB>, [](std::size_t n) {
+        return power(TwoMinusSqrt3, 2u * n + 1u) / static_cast<double>(2u * n + 1u);
+    });
+    constexpr auto coefficients = series_coefficients<terms>([](std::size_t i) {
+        return ((i % 2u)? -1.0: 1.0) / static_cast<double>(2u * i + 1u);
+    });
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto y = static_cast<double>(ys[i]);
+        const auto x = static_cast<double>(xs[i]);
+        const auto t = std::abs(y) / std::abs(x);
+        // Selects only between values that the conditions depend on or constants so the
+        // compiler doesn't move the arithmetic into branches...
+        const auto inverse = 1.0 / t;
+        const auto reciprocal = inverse < t;
+        const auto u = reciprocal? inverse: t;
+        const auto shifted = (Sqrt3 * u - 1.0) / (Sqrt3 + u);
+        const auto reduce = shifted > -TwoMinusSqrt3;
+        const auto v = reduce? shifted: u;
+        const auto angle = (reduce? SixthPi: 0.0) + v * poly::horner(v * v, coefficients);
+        const auto first = (reciprocal? HalfPi: 0.0) + (reciprocal? -angle: angle);
+        const auto magnitude = ((x < 0.0)? Pi: 0.0) + ((x < 0.0)? -first: first);
+        results[i] = to_fixed<BT, FB>((y < 0.0)? -magnitude: magnitude);
+    }
+}
+
+/// @brief Gets the square root of the given non-negative value rounded down.
+/// @details For values having no more bits than a @c double has, this corrects the
+///   floating point estimate of the root by at most one either way. That gives the same
+///   result as @c isqrt without its loop.
+/// @see realnumb::detail::isqrt.
+template <typename T>
+auto isqrt(T value) noexcept -> T
+{
+    if constexpr (std::numeric_limits<T>::digits <= 63)
+    {
+        auto root = static_cast<T>(std::sqrt(static_cast<double>(value)));
+        root -= static_cast<T>(root * root > value);
+        root += static_cast<T>((root + 1) * (root + 1) <= value);
+        return root;
+    }
+    else
+    {
+        return realnumb::detail::isqrt(value);
+    }
+}
+
+/// @brief Computes the square roots of the given non-negative internal values.
+/// @details This is the same as @c realnumb::sqrt for positive finite values.
+template <typename BT, unsigned int FB>
+void sqrt_kernel(const BT* values, std::size_t count, fixed<BT, FB>* results) noexcept
+{
+    using wider_type = typename realnumb::detail::wider<BT>::type;
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto scaled = wider_type{values[i]} << FB;
+        const auto root = isqrt(scaled);
+        results[i] = fixed<BT, FB>::from_value(static_cast<BT>((scaled - root * root > root)? root + 1: root));
+    }
+}
+
+/// @brief Gets the internal value of the given value if it's positive and finite, or
+///   of zero otherwise.
+template <typename BT, unsigned int FB>
+constexpr auto positive_or_zero(BT value) noexcept -> BT
+{
+    return ((value > 0) && (value != fixed<BT, FB>::get_positive_infinity().get_value()))? value: BT{0};
+}
+
+/// @brief Fixes up the square roots of the given internal values that aren't positive
+///   and finite.
+template <typename BT, unsigned int FB>
+void sqrt_fix_up(const BT* values, std::size_t count, fixed<BT, FB>* results) noexcept
+{
+    constexpr auto nan = fixed<BT, FB>::get_nan();
+    constexpr auto infinity = fixed<BT, FB>::get_positive_infinity();
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto value = values[i];
+        results[i] = (value < 0)? nan: (value == infinity.get_value())? infinity: results[i];
+    }
+}
+
+/// @brief Gets the internal value of the given value if it's finite, or of zero otherwise.
+template <typename BT, unsigned int FB>
+constexpr auto finite_or_zero(BT value) noexcept -> BT
+{
+    constexpr auto lowest = fixed<BT, FB>::get_lowest().get_value();
+    constexpr auto max = fixed<BT, FB>::get_max().get_value();
+    return ((value >= lowest) && (value <= max))? value: BT{0};
+}
+
+/// @brief Fixes up the sines or the cosines of the given internal values that aren't
+///   finite.
+template <typename BT, unsigned int FB>
+void sin_fix_up(const BT* values, std::size_t count, fixed<BT, FB>* results) noexcept
+{
+    constexpr auto nan = fixed<BT, FB>::get_nan().get_value();
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto value = values[i];
+        const auto result = results[i].get_value();
+        results[i] = fixed<BT, FB>::from_value((value != finite_or_zero<BT, FB>(value))? nan: result);
+    }
+}
+
+/// @brief Gets the given internal value if the exponential kernel takes it, or zero
+///   otherwise.
+template <typename BT, unsigned int FB>
+constexpr auto exp_operand(BT value) noexcept -> BT
+{
+    return ((value >= ExpLowest<BT, FB>) && (value <= ExpHighest<BT, FB>))? value: BT{0};
+}
+
+/// @brief Fixes up the exponentials of the given internal values that the exponential
+///   kernel doesn't take.
+template <typename BT, unsigned int FB>
+void exp_fix_up(const BT* values, std::size_t count, fixed<BT, FB>* results) noexcept
+{
+    constexpr auto nan = fixed<BT, FB>::get_nan().get_value();
+    constexpr auto infinity = fixed<BT, FB>::get_positive_infinity().get_value();
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto value = values[i];
+        const auto result = results[i].get_value();
+        results[i] = fixed<BT, FB>::from_value((value == nan)? nan: (value > ExpHighest<BT, FB>)? infinity:
+                                               (value < ExpLowest<BT, FB>)? BT{0}: result);
+    }
+}
+
+/// @brief Fixes up the natural logarithms of the given internal values that aren't
+///   positive and finite.
+template <typename BT, unsigned int FB>
+void log_fix_up(const BT* values, std::size_t count, fixed<BT, FB>* results) noexcept
+{
+    constexpr auto nan = fixed<BT, FB>::get_nan().get_value();
+    constexpr auto infinity = fixed<BT, FB>::get_positive_infinity().get_value();
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto value = values[i];
+        const auto result = results[i].get_value();
+        results[i] = fixed<BT, FB>::from_value((value < 0)? nan: (value == 0)? static_cast<BT>(-infinity):
+                                               (value == infinity)? infinity: result);
+    }
+}
+
+/// @brief Fixes up the inverse tangents of the given pairs of internal values that aren't
+///   both finite or whose @c x value is zero.
+/// @details Those get the results of the function of a single pair of values. So this
+///   pass isn't free of branches, but they're rarely taken.
+template <typename Tier, typename BT, unsigned int FB>
+void atan2_fix_up(const BT* ys, const BT* xs, std::size_t count, fixed<BT, FB>* results)
+{
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        const auto y = ys[i];
+        const auto x = xs[i];
+        if ((x == 0) || (x != finite_or_zero<BT, FB>(x)) || (y != finite_or_zero<BT, FB>(y)))
+        {
+            results[i] = realnumb::atan2<Tier>(fixed<BT, FB>::from_value(y), fixed<BT, FB>::from_value(x));
+        }
+    }
+}
+
+} // namespace detail
+
+/// @defgroup BatchMath Math Functions Of Arrays Of fixed Values
+/// @brief Math functions of arrays of @c fixed values.
+/// @details Each function takes its arguments, their number, and where to write the
+///   results. Overloads take contiguous ranges like @c std::vector, @c std::array, or
+///   C++20's @c std::span instead. The results are within the accuracy tier's bounds of
+///   the corresponding functions of @c fixed_math.hpp.
+/// @see FixedMath
+/// @{
+
+/// @brief Computes the sines of the given angles.
+/// @see realnumb::sin.
+template <typename Tier = precise, typename BT, unsigned int FB>
+void sin(const fixed<BT, FB>* args, std::size_t count, fixed<BT, FB>* results)
+{
+    static_assert(detail::has_double_kernels<BT>, "base type has too many bits");
+    detail::for_each_block(count, [=](std::size_t offset, std::size_t n) {
+        auto values = std::array<BT, block_size>{};
+        auto operands = std::array<BT, block_size>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            values[i] = args[offset + i].get_value();
+            operands[i] = detail::finite_or_zero<BT, FB>(values[i]);
+        }
+        detail::sin_kernel<Tier>(operands.data(), n, 0u, results + offset);
+        detail::sin_fix_up(values.data(), n, results + offset);
+    });
+}
+
+/// @brief Computes the cosines of the given angles.
+/// @see realnumb::cos.
+template <typename Tier = precise, typename BT, unsigned int FB>
+void cos(const fixed<BT, FB>* args, std::size_t count, fixed<BT, FB>* results)
+{
+    static_assert(detail::has_double_kernels<BT>, "base type has too many bits");
+    detail::for_each_block(count, [=](std::size_t offset, std::size_t n) {
+        auto values = std::array<BT, block_size>{};
+        auto operands = std::array<BT, block_size>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            values[i] = args[offset + i].get_value();
+            operands[i] = detail::finite_or_zero<BT, FB>(values[i]);
+        }
+        detail::sin_kernel<Tier>(operands.data(), n, 1u, results + offset);
+        detail::sin_fix_up(values.data(), n, results + offset);
+    });
+}
+
+/// @brief Computes the sines and the cosines of the given angles.
+/// @details This takes less time than computing both separately since the kernel shares
+///   the range reduction.
+template <typename Tier = precise, typename BT, unsigned int FB>
+void sincos(const fixed<BT, FB>* args, std::size_t count, fixed<BT, FB>* sines, fixed<BT, FB>* cosines)
+{
+    static_assert(detail::has_double_kernels<BT>, "base type has too many bits");
+    detail::for_each_block(count, [=](std::size_t offset, std::size_t n) {
+        auto values = std::array<BT, block_size>{};
+        auto operands = std::array<BT, block_size>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            values[i] = args[offset + i].get_value();
+            operands[i] = detail::finite_or_zero<BT, FB>(values[i]);
+        }
+        detail::sincos_kernel<Tier>(operands.data(), n, sines + offset, cosines + offset);
+        detail::sin_fix_up(values.data(), n, sines + offset);
+        detail::sin_fix_up(values.data(), n, cosines + offset);
+    });
+}
+
+/// @brief Computes Euler's number raised to the powers of the given arguments.
+/// @see realnumb::exp.
+template <typename Tier = precise, typename BT, unsigned int FB>
+void exp(const fixed<BT, FB>* args, std::size_t count, fixed<BT, FB>* results)
+{
+    static_assert(detail::has_double_kernels<BT>, "base type has too many bits");
+    detail::for_each_block(count, [=](std::size_t offset, std::size_t n) {
+        auto values = std::array<BT, block_size>{};
+        auto operands = std::array<BT, block_size>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            values[i] = args[offset + i].get_value();
+            operands[i] = detail::exp_operand<BT, FB>(values[i]);
+        }
+        detail::exp_kernel<Tier>(operands.data(), n, results + offset);
+        detail::exp_fix_up(values.data(), n, results + offset);
+    });
+}
+
+/// @brief Computes the natural logarithms of the given arguments.
+/// @see realnumb::log.
+template <typename Tier = precise, typename BT, unsigned int FB>
+void log(const fixed<BT, FB>* args, std::size_t count, fixed<BT, FB>* results)
+{
+    static_assert(detail::has_double_kernels<BT>, "base type has too many bits");
+    detail::for_each_block(count, [=](std::size_t offset, std::size_t n) {
+        auto values = std::array<BT, block_size>{};
+        auto operands = std::array<BT, block_size>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            values[i] = args[offset + i].get_value();
+            operands[i] = std::max(detail::positive_or_zero<BT, FB>(values[i]), BT{1});
+        }
+        detail::log_kernel<Tier>(operands.data(), n, results + offset);
+        detail::log_fix_up(values.data(), n, results + offset);
+    });
+}
+
+/// @brief Computes the square roots of the given arguments.
+/// @see realnumb::sqrt.
+template <typename Tier = precise, typename BT, unsigned int FB>
+void sqrt(const fixed<BT, FB>* args, std::size_t count, fixed<BT, FB>* results)
+{
+    detail::for_each_block(count, [=](std::size_t offset, std::size_t n) {
+        auto values = std::array<BT, block_size>{};
+        auto operands = std::array<BT, block_size>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            values[i] = args[offset + i].get_value();
+            operands[i] = detail::positive_or_zero<BT, FB>(values[i]);
+        }
+        detail::sqrt_kernel(operands.data(), n, results + offset);
+        detail::sqrt_fix_up(values.data(), n, results + offset);
+    });
+}
+
+/// @brief Computes the square roots of the sums of the squares of the given arguments.
+/// @note The sums of the squares come from the @c fixed operators like they do for
+///   @c realnumb::hypot, which saturate to infinity.
+/// @see realnumb::hypot.
+template <typename Tier = precise, typename BT, unsigned int FB>
+void hypot(const fixed<BT, FB>* xs, const fixed<BT, FB>* ys, std::size_t count, fixed<BT, FB>* results)
+{
+    detail::for_each_block(count, [=](std::size_t offset, std::size_t n) {
+        auto values = std::array<BT, block_size>{};
+        auto operands = std::array<BT, block_size>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            const auto x = xs[offset + i];
+            const auto y = ys[offset + i];
+            values[i] = (x * x + y * y).get_value();
+            operands[i] = detail::positive_or_zero<BT, FB>(values[i]);
+        }
+        detail::sqrt_kernel(operands.data(), n, results + offset);
+        detail::sqrt_fix_up(values.data(), n, results + offset);
+    });
+}
+
+/// @brief Computes the multi-valued inverse tangents of the given pairs of values.
+/// @see realnumb::atan2.
+template <typename Tier = precise, typename BT, unsigned int FB>
+void atan2(const fixed<BT, FB>* ys, const fixed<BT, FB>* xs, std::size_t count, fixed<BT, FB>* results)
+{
+    static_assert(detail::has_double_kernels<BT>, "base type has too many bits");
+    detail::for_each_block(count, [=](std::size_t offset, std::size_t n) {
+        auto y_values = std::array<BT, block_size>{};
+        auto x_values = std::array<BT, block_size>{};
+        auto y_operands = std::array<BT, block_size>{};
+        auto x_operands = std::array<BT, block_size>{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            y_values[i] = ys[offset + i].get_value();
+            x_values[i] = xs[offset + i].get_value();
+            y_operands[i] = detail::finite_or_zero<BT, FB>(y_values[i]);
+            const auto x = detail::finite_or_zero<BT, FB>(x_values[i]);
+            x_operands[i] = (x == 0)? BT{1}: x;
+        }
+        detail::atan2_kernel<Tier>(y_operands.data(), x_operands.data(), n, results + offset);
+        detail::atan2_fix_up<Tier>(y_values.data(), x_values.data(), n, results + offset);
+    });
+}
+
+/// @brief Computes the sines of the given range of angles.
+/// @pre The results have room for as many values as there are arguments.
+template <typename Tier = precise, typename Args, typename Results>
+auto sin(const Args& args, Results&& results) -> decltype(std::data(results), void())
+{
+    assert(std::size(results) >= std::size(args));
+    sin<Tier>(std::data(args), std::size(args), std::data(results));
+}
+
+/// @brief Computes the cosines of the given range of angles.
+/// @pre The results have room for as many values as there are arguments.
+template <typename Tier = precise, typename Args, typename Results>
+auto cos(const Args& args, Results&& results) -> decltype(std::data(results), void())
+{
+    assert(std::size(results) >= std::size(args));
+    cos<Tier>(std::data(args), std::size(args), std::data(results));
+}
+
+/// @brief Computes the sines and the cosines of the given range of angles.
+/// @pre The results have room for as many values as there are arguments.
+template <typename Tier = precise, typename Args, typename Sines, typename Cosines>
+auto sincos(const Args& args, Sines&& sines, Cosines&& cosines)
+    -> decltype(std::data(sines), std::data(cosines), void())
+{
+    assert(std::size(sines) >= std::size(args));
+    assert(std::size(cosines) >= std::size(args));
+    sincos<Tier>(std::data(args), std::size(args), std::data(sines), std::data(cosines));
+}
+
+/// @brief Computes Euler's number raised to the powers of the given range of arguments.
+/// @pre The results have room for as many values as there are arguments.
+template <typename Tier = precise, typename Args, typename Results>
+auto exp(const Args& args, Results&& results) -> decltype(std::data(results), void())
+{
+    assert(std::size(results) >= std::size(args));
+    exp<Tier>(std::data(args), std::size(args), std::data(results));
+}
+
+/// @brief Computes the natural logarithms of the given range of arguments.
+/// @pre The results have room for as many values as there are arguments.
+template <typename Tier = precise, typename Args, typename Results>
+auto log(const Args& args, Results&& results) -> decltype(std::data(results), void())
+{
+    assert(std::size(results) >= std::size(args));
+    log<Tier>(std::data(args), std::size(args), std::data(results));
+}
+
+/// @brief Computes the square roots of the given range of arguments.
+/// @pre The results have room for as many values as there are arguments.
+template <typename Tier = precise, typename Args, typename Results>
+auto sqrt(const Args& args, Results&& results) -> decltype(std::data(results), void())
+{
+    assert(std::size(results) >= std::size(args));
+    sqrt<Tier>(std::data(args), std::size(args), std::data(results));
+}
+
+/// @brief Computes the square roots of the sums of the squares of the given ranges.
+/// @pre The ranges of arguments have the same size and the results have room for as
+///   many values.
+template <typename Tier = precise, typename Xs, typename Ys, typename Results>
+auto hypot(const Xs& xs, const Ys& ys, Results&& results) -> decltype(std::data(results), void())
+{
+    assert(std::size(ys) == std::size(xs));
+    assert(std::size(results) >= std::size(xs));
+    hypot<Tier>(std::data(xs), std::data(ys), std::size(xs), std::data(results));
+}
+
+/// @brief Computes the multi-valued inverse tangents of the given ranges.
+/// @pre The ranges of arguments have the same size and the results have room for as
+///   many values.
+template <typename Tier = precise, typename Ys, typename Xs, typename Results>
+auto atan2(const Ys& ys, const Xs& xs, Results&& results) -> decltype(std::data(results), void())
+{
+    assert(std::size(xs) == std::size(ys));
+    assert(std::size(results) >= std::size(ys));
+    atan2<Tier>(std::data(ys), std::data(xs), std::size(ys), std::data(results));
+}
+
+/// @}
+
+} // namespace batch
+
+} // namespace realnumb
+
+#endif /* REALNUMB_BATCH_HPP */
@@ -11,6 +11,8 @@
 #include <iostream>
 #include <utility> // for std::forward
 
+#include <realnumb/limbs.hpp> // for limbs, REALNUMB_INT128, REALNUMB_UINT128
+
 namespace realnumb {
 namespace detail {
 
@@ -19,6 +21,22 @@ namespace detail {
 template <typename BaseType>
 struct fixed_default {};
 
+/// @brief Defaults for 8-bit integer instantiation of the <code>fixed</code> class template.
+template <>
+struct fixed_default<std::int8_t>
+{
+    /// @brief Fraction bits for the type this is specialized for.
+    static constexpr auto fraction_bits = 4u;
+};
+
+/// @brief Defaults for 16-bit integer instantiation of the <code>fixed</code> class template.
+template <>
+struct fixed_default<std::int16_t>
+{
+    /// @brief Fraction bits for the type this is specialized for.
+    static constexpr auto fraction_bits = 8u;
+};
+
 /// @brief Defaults for 32-bit integer instantiation of the <code>fixed</code> class template.
 template <>
 struct fixed_default<std::int32_t>
@@ -35,6 +53,16 @@ struct fixed_default<std::int64_t>
     static constexpr auto fraction_bits = 24u;
 };
 
+#ifdef REALNUMB_INT128
+/// @brief Defaults for 128-bit integer instantiation of the <code>fixed</code> class template.
+template <>
+struct fixed_default<REALNUMB_INT128>
+{
+    /// @brief Fraction bits for the type this is specialized for.
+    static constexpr auto fraction_bits = 64u;
+};
+#endif
+
 /// @brief wider data type obtainer.
 /// @details Widens a data type to the data type that's twice its original size.
 template <typename T>
@@ -89,26 +117,61 @@ struct wider<double> {
     using type = long double; ///< wider type.
 };
 
-#ifdef __SIZEOF_INT128__
-#define REALNUMB_INT128 __int128_t
-#define REALNUMB_UINT128 __uint128_t
-#endif
-
-#ifdef REALNUMB_INT128
 /// @brief Specialization of the wider trait for signed 64-bit integers.
+/// @note Where there's no built-in 128-bit integer type, this is the @c limbs type of
+///   that many bits.
 template <>
 struct wider<std::int64_t> {
+#ifdef REALNUMB_INT128
     using type = REALNUMB_INT128; ///< wider type.
+#else
+    using type = limbs<2>; ///< wider type.
+#endif
+};
+
+#ifdef REALNUMB_INT128
+/// @brief Specialization of the wider trait for signed 128-bit integers.
+/// @note There's no built-in 256-bit integer type so this is the @c limbs type of that
+///   many bits.
+template <>
+struct wider<REALNUMB_INT128> {
+    using type = limbs<4>; ///< wider type.
 };
 #endif
 
-#ifdef REALNUMB_UINT128
 /// @brief Specialization of the wider trait for unsigned 64-bit integers.
+/// @note Where there's no built-in 128-bit unsigned integer type, this is the signed
+///   @c limbs type of 192 bits. That's the narrowest one that holds every product of two
+///   of these values.
 template <>
 struct wider<std::uint64_t> {
+#ifdef REALNUMB_UINT128
     using type = REALNUMB_UINT128; ///< wider type.
-};
+#else
+    using type = limbs<3>; ///< wider type.
 #endif
+};
+
+/// @brief Specialization of the wider trait for the @c limbs types.
+template <std::size_t N>
+struct wider<limbs<N>> {
+    using type = limbs<N * 2u>; ///< wider type.
+};
+
+/// @brief Unsigned type obtainer.
+/// @details This is <code>std::make_unsigned</code> for the built-in integral types. The
+///   @c limbs types are signed only, so they're their own unsigned type. That's fine for
+///   the bits below the binary point that this is used for.
+template <typename T>
+struct unsigned_type {
+    using type = std::make_unsigned_t<T>; ///< unsigned type.
+};
+
+/// @brief Specialization of the unsigned type trait for the @c limbs types.
+template <std::size_t N>
+struct unsigned_type<limbs<N>> {
+    using type = limbs<N>; ///< unsigned type.
+};
 
 } // namespace detail
 
@@ -124,6 +187,8 @@ enum class ordering
 /// @brief Template class for fixed-point real-like numbers.
 /// @details This is a fixed point type template for a given base type using a given number
 ///   of fraction bits that satisfies the <code>LiteralType</code> named requirement.
+///   Besides the built-in signed integral types, the base type can be any of the @c limbs
+///   types, like <code>fixed<limbs<4>, 192></code>, for precision beyond 128 bits.
 /// @see https://en.wikipedia.org/wiki/Fixed-point_arithmetic
 /// @see https://en.cppreference.com/w/cpp/named_req/LiteralType
 template <typename BaseType, unsigned int FractionBits>
@@ -147,7 +212,12 @@ public:
     static constexpr auto whole_bits = total_bits - fraction_bits;
 
     /// @brief Scale factor.
-    static constexpr auto scale_factor = static_cast<value_type>(1u << fraction_bits);
+    /// @note This is of the wider type for formats whose only whole bit is the sign bit,
+    ///   like <code>fixed<std::int16_t, 15></code>, since the value type can't hold it.
+    static constexpr auto scale_factor = [] {
+        using type = std::conditional_t<(whole_bits > 1u), value_type, typename detail::wider<value_type>::type>;
+        return static_cast<type>(type{1} << fraction_bits);
+    }();
 
     /// @brief Gets the min value this type is capable of expressing.
     static constexpr auto get_min() noexcept -> fixed
@@ -201,7 +271,7 @@ public:
                 ? get_positive_infinity().m_value // newline!
                 : (static_cast<long double>(val) < static_cast<long double>(get_lowest())) // newline!
                     ? get_negative_infinity().m_value // newline!
-                    : static_cast<value_type>(val * scale_factor);
+                    : scale(val);
     }
 
     /// @brief Gets the value from a signed integral value.
@@ -219,7 +289,7 @@ public:
     static constexpr auto to_value(T val) noexcept
         -> std::enable_if_t<std::is_integral_v<T> && !std::is_signed_v<T>, value_type>
     {
-        const auto max = static_cast<unsigned_wider_type>(get_max().m_value / scale_factor);
+        const auto max = static_cast<typename detail::unsigned_type<value_type>::type>(get_max().m_value / scale_factor);
         return (val > max)? get_positive_infinity().m_value: static_cast<value_type>(val) * scale_factor;
     }
 
@@ -234,8 +304,10 @@ public:
     }
 
     /// @brief Initializing constructor.
-    constexpr fixed(value_type val, unsigned int fraction) noexcept:
-        m_value{static_cast<value_type>(static_cast<std::uint32_t>(val * scale_factor) | fraction)}
+    /// @details Initializes this value from the given whole part and the given bits below
+    ///   the binary point.
+    constexpr fixed(value_type val, typename detail::unsigned_type<value_type>::type fraction) noexcept:
+        m_value{static_cast<value_type>(static_cast<typename detail::unsigned_type<value_type>::type>(val * scale_factor) | fraction)}
     {
         // Intentionally empty.
     }
@@ -261,6 +333,22 @@ public:
                 : static_cast<T>(m_value) / static_cast<T>(scale_factor);
     }
 
+    /// @brief Gets this value in its internal form.
+    /// @see from_value.
+    constexpr auto get_value() const noexcept -> value_type
+    {
+        return m_value;
+    }
+
+    /// @brief Gets the fixed value for the given value in internal form.
+    /// @note This is the inverse of <code>get_value</code> and is intended for code that
+    ///   operates directly on the internal representation.
+    /// @see get_value.
+    static constexpr auto from_value(value_type val) noexcept -> fixed
+    {
+        return fixed{val, scalar_type{1}};
+    }
+
     /// @brief Compares this value to the given one.
     constexpr auto compare(const fixed other) const noexcept -> ordering
     {
@@ -291,13 +379,13 @@ public:
     /// @brief Long long operator.
     explicit constexpr operator long long() const noexcept
     {
-        return m_value / scale_factor;
+        return static_cast<long long>(m_value / scale_factor);
     }
 
     /// @brief Long operator.
     explicit constexpr operator long() const noexcept
     {
-        return m_value / scale_factor;
+        return static_cast<long>(m_value / scale_factor);
     }
 
     /// @brief Unsigned long long operator.
@@ -333,7 +421,7 @@ public:
     /// @brief Negation operator.
     constexpr auto operator- () const noexcept -> fixed
     {
-        return (isnan())? *this: fixed{-m_value, scalar_type{1}};
+        return (isnan())? *this: fixed{static_cast<value_type>(-m_value), scalar_type{1}};
     }
 
     /// @brief Positive operator.
@@ -492,10 +580,27 @@ public:
         return *this;
     }
 
+    /// @brief Left shift assignment operator.
+    /// @details Multiplies this value by two to the given power. This is exact unless the
+    ///   result saturates to infinity. Negative amounts shift right instead.
+    constexpr auto operator<<= (int n) noexcept -> fixed&
+    {
+        return (n < 0)? shift_right(0u - static_cast<unsigned int>(n)): shift_left(static_cast<unsigned int>(n));
+    }
+
+    /// @brief Right shift assignment operator.
+    /// @details Divides this value by two to the given power with rounding to nearest like
+    ///   the division operator does. So <code>x >> 1</code> equals <code>x / 2</code>.
+    ///   Negative amounts shift left instead.
+    constexpr auto operator>>= (int n) noexcept -> fixed&
+    {
+        return (n < 0)? shift_left(0u - static_cast<unsigned int>(n)): shift_right(static_cast<unsigned int>(n));
+    }
+
     /// @brief Is finite.
     constexpr auto isfinite() const noexcept -> bool
     {
-        return (*this > get_negative_infinity()) && (*this < get_positive_infinity());
+        return (m_value > get_negative_infinity().m_value) && (m_value < get_positive_infinity().m_value);
     }
 
     /// @brief Is NaN.
@@ -515,9 +620,6 @@ private:
     /// @brief Widened type alias.
     using wider_type = typename detail::wider<value_type>::type;
 
-    /// @brief Unsigned widened type alias.
-    using unsigned_wider_type = std::make_unsigned_t<wider_type>;
-
     /// @brief Scalar type.
     struct scalar_type
     {
@@ -527,13 +629,59 @@ private:
     /// @brief Numeric limits type alias.
     using numeric_limits = std::numeric_limits<value_type>;
 
+    /// @brief Scales the given floating point value into the value type.
+    /// @note The @c limbs value types don't mix with floating point values, so this scales
+    ///   in long double for those. Scaling by a power of two is exact either way.
+    template <typename T>
+    static constexpr auto scale(T val) noexcept -> value_type
+    {
+        if constexpr (std::is_arithmetic_v<value_type>)
+        {
+            return static_cast<value_type>(val * scale_factor);
+        }
+        else
+        {
+            return static_cast<value_type>(static_cast<long double>(val) * static_cast<long double>(scale_factor));
+        }
+    }
+
     /// @brief Initializing constructor.
     constexpr fixed(value_type val, scalar_type scalar) noexcept:
-        m_value{val * scalar.value}
+        m_value{static_cast<value_type>(val * scalar.value)}
     {
         // Intentionally empty.
     }
 
+    /// @brief Shifts this value left by the given amount, saturating to infinity.
+    constexpr auto shift_left(unsigned int n) noexcept -> fixed&
+    {
+        if (isfinite() && (m_value != 0) && (n != 0u))
+        {
+            const auto magnitude = static_cast<value_type>((m_value < 0)? -m_value: m_value);
+            const auto limit = (n < total_bits)? static_cast<value_type>(get_max().m_value >> n): value_type{0};
+            m_value = (magnitude > limit) // newline!
+                ? ((m_value < 0)? get_negative_infinity().m_value: get_positive_infinity().m_value) // newline!
+                : static_cast<value_type>(m_value * static_cast<value_type>(value_type{1} << n));
+        }
+        return *this;
+    }
+
+    /// @brief Shifts this value right by the given amount, rounding half away from zero.
+    constexpr auto shift_right(unsigned int n) noexcept -> fixed&
+    {
+        if (isfinite() && (n != 0u))
+        {
+            // Shifts out all but the highest of the dropped bits before adding the half,
+            // so the sum can't overflow even for value types that are signed only...
+            const auto magnitude = static_cast<value_type>((m_value < 0)? -m_value: m_value);
+            const auto result = (n < total_bits) // newline!
+                ? static_cast<value_type>((static_cast<value_type>(magnitude >> (n - 1u)) + 1) >> 1u) // newline!
+                : value_type{0};
+            m_value = static_cast<value_type>((m_value < 0)? -result: result);
+        }
+        return *this;
+    }
+
     value_type m_value; ///< Value in internal form.
 };
 
@@ -621,6 +769,169 @@ constexpr fixed<BT, FB> operator% (fixed<BT, FB> lhs, fixed<BT, FB> rhs) noexcep
     return lhs;
 }
 
+// Mixed operand operators.
+// These convert the arithmetic operand to the fixed type, like the non-template operators
+// of the named fixed types do implicitly, so every instantiation of the fixed class
+// template can be used with literals like <code>x == 0</code> or <code>x * 2</code>.
+
+/// @brief Equality operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator== (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs == fixed<BT, FB>(rhs);
+}
+
+/// @brief Equality operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator== (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) == rhs;
+}
+
+/// @brief Inequality operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator!= (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs != fixed<BT, FB>(rhs);
+}
+
+/// @brief Inequality operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator!= (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) != rhs;
+}
+
+/// @brief Less-than operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator< (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs < fixed<BT, FB>(rhs);
+}
+
+/// @brief Less-than operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator< (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) < rhs;
+}
+
+/// @brief Greater-than operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator> (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs > fixed<BT, FB>(rhs);
+}
+
+/// @brief Greater-than operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator> (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) > rhs;
+}
+
+/// @brief Less-than or equal-to operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator<= (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs <= fixed<BT, FB>(rhs);
+}
+
+/// @brief Less-than or equal-to operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator<= (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) <= rhs;
+}
+
+/// @brief Greater-than or equal-to operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator>= (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs >= fixed<BT, FB>(rhs);
+}
+
+/// @brief Greater-than or equal-to operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr bool operator>= (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) >= rhs;
+}
+
+/// @brief Addition operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr fixed<BT, FB> operator+ (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs + fixed<BT, FB>(rhs);
+}
+
+/// @brief Addition operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr fixed<BT, FB> operator+ (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) + rhs;
+}
+
+/// @brief Subtraction operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr fixed<BT, FB> operator- (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs - fixed<BT, FB>(rhs);
+}
+
+/// @brief Subtraction operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr fixed<BT, FB> operator- (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) - rhs;
+}
+
+/// @brief Multiplication operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr fixed<BT, FB> operator* (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs * fixed<BT, FB>(rhs);
+}
+
+/// @brief Multiplication operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr fixed<BT, FB> operator* (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) * rhs;
+}
+
+/// @brief Division operator for a fixed value and an arithmetic value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr fixed<BT, FB> operator/ (fixed<BT, FB> lhs, U rhs) noexcept
+{
+    return lhs / fixed<BT, FB>(rhs);
+}
+
+/// @brief Division operator for an arithmetic value and a fixed value.
+template <typename BT, unsigned int FB, typename U, std::enable_if_t<std::is_arithmetic_v<U>, int> = 0>
+constexpr fixed<BT, FB> operator/ (U lhs, fixed<BT, FB> rhs) noexcept
+{
+    return fixed<BT, FB>(lhs) / rhs;
+}
+
+/// @brief Left shift operator.
+/// @see fixed::operator<<=.
+template <typename BT, unsigned int FB>
+constexpr fixed<BT, FB> operator<< (fixed<BT, FB> lhs, int rhs) noexcept
+{
+    lhs <<= rhs;
+    return lhs;
+}
+
+/// @brief Right shift operator.
+/// @see fixed::operator>>=.
+template <typename BT, unsigned int FB>
+constexpr fixed<BT, FB> operator>> (fixed<BT, FB> lhs, int rhs) noexcept
+{
+    lhs >>= rhs;
+    return lhs;
+}
+
 /// @brief Output stream operator.
 template <typename BT, unsigned int FB>
 inline ::std::ostream& operator<<(::std::ostream& os, const fixed<BT, FB>& value)
@@ -628,6 +939,190 @@ inline ::std::ostream& operator<<(::std::ostream& os, const fixed<BT, FB>& value
     return os << static_cast<double>(value);
 }
 
+/// @brief 8-bit fixed precision type.
+/// @details This is an 8-bit fixed precision type with a Q number-format of
+///   <code>Q4.4</code>.
+/// @note Its whole domain is only 256 values, so functions of it can be checked
+///   exhaustively.
+/// @note Maximum value (with 4 fraction bits) is 7.875.
+/// @note Minimum value (with 4 fraction bits) is 0.0625.
+/// @see fixed
+/// @see https://en.wikipedia.org/wiki/Q_(number_format)
+using fixed8 = fixed<std::int8_t, detail::fixed_default<std::int8_t>::fraction_bits>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<fixed8>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<fixed8>); // trivially copyable & trivial default ctor
+
+// fixed8 free functions.
+
+/// @brief Addition operator.
+constexpr fixed8 operator+ (fixed8 lhs, fixed8 rhs) noexcept
+{
+    lhs += rhs;
+    return lhs;
+}
+
+/// @brief Subtraction operator.
+constexpr fixed8 operator- (fixed8 lhs, fixed8 rhs) noexcept
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+/// @brief Multiplication operator.
+constexpr fixed8 operator* (fixed8 lhs, fixed8 rhs) noexcept
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+/// @brief Division operator.
+constexpr fixed8 operator/ (fixed8 lhs, fixed8 rhs) noexcept
+{
+    lhs /= rhs;
+    return lhs;
+}
+
+/// @brief Modulo operator.
+constexpr fixed8 operator% (fixed8 lhs, fixed8 rhs) noexcept
+{
+    lhs %= rhs;
+    return lhs;
+}
+
+/// @brief Equality operator.
+constexpr bool operator== (fixed8 lhs, fixed8 rhs) noexcept
+{
+    return lhs.compare(rhs) == ordering::equivalent;
+}
+
+/// @brief Inequality operator.
+constexpr bool operator!= (fixed8 lhs, fixed8 rhs) noexcept
+{
+    return lhs.compare(rhs) != ordering::equivalent;
+}
+
+/// @brief Less-than or equal-to operator.
+constexpr bool operator <= (fixed8 lhs, fixed8 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return (result == ordering::less) || (result == ordering::equivalent);
+}
+
+/// @brief Greater-than or equal-to operator.
+constexpr bool operator >= (fixed8 lhs, fixed8 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return (result == ordering::greater) || (result == ordering::equivalent);
+}
+
+/// @brief Less-than operator.
+constexpr bool operator < (fixed8 lhs, fixed8 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return result == ordering::less;
+}
+
+/// @brief Greater-than operator.
+constexpr bool operator > (fixed8 lhs, fixed8 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return result == ordering::greater;
+}
+
+/// @brief 16-bit fixed precision type.
+/// @details This is a 16-bit fixed precision type with a Q number-format of
+///   <code>Q8.8</code>.
+/// @note Its whole input domain is only 65536 values, so unary functions of it can be
+///   exhaustively tabulated.
+/// @note Maximum value (with 8 fraction bits) is approximately 127.9921875.
+/// @note Minimum value (with 8 fraction bits) is approximately 0.00390625.
+/// @see fixed, tabulated
+/// @see https://en.wikipedia.org/wiki/Q_(number_format)
+using fixed16 = fixed<std::int16_t, detail::fixed_default<std::int16_t>::fraction_bits>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<fixed16>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<fixed16>); // trivially copyable & trivial default ctor
+
+// fixed16 free functions.
+
+/// @brief Addition operator.
+constexpr fixed16 operator+ (fixed16 lhs, fixed16 rhs) noexcept
+{
+    lhs += rhs;
+    return lhs;
+}
+
+/// @brief Subtraction operator.
+constexpr fixed16 operator- (fixed16 lhs, fixed16 rhs) noexcept
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+/// @brief Multiplication operator.
+constexpr fixed16 operator* (fixed16 lhs, fixed16 rhs) noexcept
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+/// @brief Division operator.
+constexpr fixed16 operator/ (fixed16 lhs, fixed16 rhs) noexcept
+{
+    lhs /= rhs;
+    return lhs;
+}
+
+/// @brief Modulo operator.
+constexpr fixed16 operator% (fixed16 lhs, fixed16 rhs) noexcept
+{
+    lhs %= rhs;
+    return lhs;
+}
+
+/// @brief Equality operator.
+constexpr bool operator== (fixed16 lhs, fixed16 rhs) noexcept
+{
+    return lhs.compare(rhs) == ordering::equivalent;
+}
+
+/// @brief Inequality operator.
+constexpr bool operator!= (fixed16 lhs, fixed16 rhs) noexcept
+{
+    return lhs.compare(rhs) != ordering::equivalent;
+}
+
+/// @brief Less-than or equal-to operator.
+constexpr bool operator <= (fixed16 lhs, fixed16 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return (result == ordering::less) || (result == ordering::equivalent);
+}
+
+/// @brief Greater-than or equal-to operator.
+constexpr bool operator >= (fixed16 lhs, fixed16 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return (result == ordering::greater) || (result == ordering::equivalent);
+}
+
+/// @brief Less-than operator.
+constexpr bool operator < (fixed16 lhs, fixed16 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return result == ordering::less;
+}
+
+/// @brief Greater-than operator.
+constexpr bool operator > (fixed16 lhs, fixed16 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return result == ordering::greater;
+}
+
 /// @brief 32-bit fixed precision type.
 /// @details This is a 32-bit fixed precision type with a Q number-format of
 ///   <code>Q23.9</code>.
@@ -721,7 +1216,6 @@ constexpr bool operator > (fixed32 lhs, fixed32 rhs) noexcept
     return result == ordering::greater;
 }
 
-#ifdef REALNUMB_INT128
 // fixed64 free functions.
 
 /// @brief 64-bit fixed precision type.
@@ -817,6 +1311,103 @@ template<> struct detail::wider<fixed32> {
     using type = fixed64; ///< wider type.
 };
 
+#ifdef REALNUMB_INT128
+// fixed128 free functions.
+
+/// @brief 128-bit fixed precision type.
+/// @details This is a 128-bit fixed precision type with a Q number-format of
+///   <code>Q64.64</code>. Its wider type is the 256-bit @c limbs type. So its
+///   multiplication and division, and its math functions, are done in software.
+///
+/// @note Minimum value (with 64 fraction bits) is approximately
+///   <code>5.42101086242752217e-20</code>.
+/// @note Maximum value (with 64 fraction bits) is approximately
+///   <code>9223372036854775808</code>.
+///
+/// @see fixed, limbs
+/// @see https://en.wikipedia.org/wiki/Q_(number_format)
+///
+using fixed128 = fixed<REALNUMB_INT128, detail::fixed_default<REALNUMB_INT128>::fraction_bits>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<fixed128>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<fixed128>); // trivially copyable & trivial default ctor
+
+/// @brief Addition operator.
+constexpr fixed128 operator+ (fixed128 lhs, fixed128 rhs) noexcept
+{
+    lhs += rhs;
+    return lhs;
+}
+
+/// @brief Subtraction operator.
+constexpr fixed128 operator- (fixed128 lhs, fixed128 rhs) noexcept
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+/// @brief Multiplication operator.
+constexpr fixed128 operator* (fixed128 lhs, fixed128 rhs) noexcept
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+/// @brief Division operator.
+constexpr fixed128 operator/ (fixed128 lhs, fixed128 rhs) noexcept
+{
+    lhs /= rhs;
+    return lhs;
+}
+
+constexpr fixed128 operator% (fixed128 lhs, fixed128 rhs) noexcept
+{
+    lhs %= rhs;
+    return lhs;
+}
+
+/// @brief Equality operator.
+constexpr bool operator== (fixed128 lhs, fixed128 rhs) noexcept
+{
+    return lhs.compare(rhs) == ordering::equivalent;
+}
+
+/// @brief Inequality operator.
+constexpr bool operator!= (fixed128 lhs, fixed128 rhs) noexcept
+{
+    return lhs.compare(rhs) != ordering::equivalent;
+}
+
+constexpr bool operator <= (fixed128 lhs, fixed128 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return (result == ordering::less) || (result == ordering::equivalent);
+}
+
+constexpr bool operator >= (fixed128 lhs, fixed128 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return (result == ordering::greater) || (result == ordering::equivalent);
+}
+
+constexpr bool operator < (fixed128 lhs, fixed128 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return result == ordering::less;
+}
+
+constexpr bool operator > (fixed128 lhs, fixed128 rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return result == ordering::greater;
+}
+
+/// @brief Specialization of the wider trait for the <code>fixed64</code> type.
+template<> struct detail::wider<fixed64> {
+    using type = fixed128; ///< wider type.
+};
+
 #endif /* REALNUMB_INT128 */
 
 } // namespace realnumb
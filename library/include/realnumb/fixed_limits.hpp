@@ -38,13 +38,17 @@ public:
     static constexpr bool is_signed = true; ///< Identifies signed types.
     static constexpr bool is_integer = false; ///< Identifies integer types.
     static constexpr bool is_exact = true; ///< Identifies exact type.
-    static constexpr int radix = 0; ///< Radix used by the type.
+    static constexpr int radix = 2; ///< Radix used by the type.
 
     /// @brief Gets the epsilon value for the type.
-    static constexpr realnumb::fixed32 epsilon() noexcept { return realnumb::fixed<BT,FB>{0}; } // TODO(lou)
+    /// @details This is the difference between one and the next value, which for a fixed
+    ///   type is the same as its smallest positive value.
+    static constexpr realnumb::fixed<BT,FB> epsilon() noexcept { return realnumb::fixed<BT,FB>::get_min(); }
 
     /// @brief Gets the round error value for the type.
-    static constexpr realnumb::fixed32 round_error() noexcept { return realnumb::fixed<BT,FB>{0}; } // TODO(lou)
+    /// @details This is the largest rounding error in units of <code>epsilon</code>, which
+    ///   is a half since the arithmetic operators round to nearest.
+    static constexpr realnumb::fixed<BT,FB> round_error() noexcept { return realnumb::fixed<BT,FB>{0.5}; }
 
     /// @brief One more than smallest negative power of the radix that's a valid
     ///    normalized floating-point value.
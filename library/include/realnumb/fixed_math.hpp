@@ -4,39 +4,440 @@
 /// @file
 /// @brief Conventional math functions for the @c fixed class template.
 
+#include <algorithm> // for std::min
+#include <array> // for std::array
 #include <cmath>
+#include <cstddef> // for std::size_t
 
+#include <realnumb/accuracy.hpp>
 #include <realnumb/numbers.hpp>
 #include <realnumb/fixed.hpp>
 #include <realnumb/math.hpp>
-#include <realnumb/taylor_series.hpp>
+#include <realnumb/minimax.hpp>
+#include <realnumb/poly.hpp>
 
 namespace realnumb {
 
 namespace detail {
 
+/// @brief Binary expansion of a non-negative constant less than two.
+/// @note Holds 512 bits of the constant's fraction which is enough for scaling the
+///   constant into the wider type of any of the supported base types up to 256 bits. The
+///   512-bit wider type of the 256-bit <code>limbs<4></code> base type needs more than 256
+///   of these bits. Bits past these are taken to be zero.
+struct binary_constant
+{
+    unsigned int whole; ///< Whole part - either 0 or 1.
+    std::array<std::uint64_t, 8> fraction; ///< Bits after the binary point, 64 at a time.
+};
+
+/// @brief Binary expansion of <code>pi / 2</code>.
+constexpr auto HalfPiBits = binary_constant{1u, {
+    0x921FB54442D18469u, 0x898CC51701B839A2u, 0x52049C1114CF98E8u, 0x04177D4C76273644u,
+    0xA29410F31C6809BBu, 0xDF2A33679A748636u, 0x605614DBE4BE286Eu, 0x9FC26ADADAA3848Bu}};
+
+/// @brief Binary expansion of <code>2 / pi</code>.
+constexpr auto TwoOverPiBits = binary_constant{0u, {
+    0xA2F9836E4E441529u, 0xFC2757D1F534DDC0u, 0xDB6295993C439041u, 0xFE5163ABDEBBC561u,
+    0xB7246E3A424DD2E0u, 0x06492EEA09D1921Cu, 0xFE1DEB1CB129A73Eu, 0xE88235F52EBB4484u}};
+
+/// @brief Binary expansion of one.
+constexpr auto OneBits = binary_constant{1u, {}};
+
+/// @brief Binary expansion of <code>ln(2)</code>.
+constexpr auto Ln2Bits = binary_constant{0u, {
+    0xB17217F7D1CF79ABu, 0xC9E3B39803F2F6AFu, 0x40F343267298B62Du, 0x8A0D175B8BAAFA2Bu,
+    0xE7B876206DEBAC98u, 0x559552FB4AFA1B10u, 0xED2EAE35C1382144u, 0x27573B291169B825u}};
+
+/// @brief Binary expansion of <code>log2(e)</code>, i.e. <code>1 / ln(2)</code>.
+constexpr auto Log2EBits = binary_constant{1u, {
+    0x71547652B82FE177u, 0x7D0FFDA0D23A7D11u, 0xD6AEF551BAD2B4B1u, 0x164A2CD9A342648Fu,
+    0xBC3887EEAA2ED9ACu, 0x49B25EEB82D7C167u, 0xD52173CC1895213Fu, 0x897F5E06A7BE7366u}};
+
+/// @brief Binary expansion of <code>log10(e)</code>, i.e. <code>1 / ln(10)</code>.
+constexpr auto Log10EBits = binary_constant{0u, {
+    0x6F2DEC549B9438CAu, 0x9AADD557D699EE19u, 0x1F71A30122E4D101u, 0x1D1F96A27BC7529Eu,
+    0x3AA1277D0A0179F9u, 0x4911AAC96323250Au, 0x8C671DECFE9C6E5Eu, 0x37D15C696466D3D9u}};
+
+/// @brief Binary expansion of the square root of two.
+constexpr auto Sqrt2Bits = binary_constant{1u, {
+    0x6A09E667F3BCC908u, 0xB2FB1366EA957D3Eu, 0x3ADEC17512775099u, 0xDA2F590B0667322Au,
+    0x95F9060875714587u, 0x5163FCDFB907B672u, 0x1EE950BC8738F694u, 0xF0090E6C7BF44ED1u}};
+
+/// @brief Binary expansion of the square root of three.
+constexpr auto Sqrt3Bits = binary_constant{1u, {
+    0xBB67AE8584CAA73Bu, 0x25742D7078B83B89u, 0x25D834CC53DA4798u, 0xC720A6486E45A6E2u,
+    0x490BCFD95EF15DBDu, 0xA9930AAE12228F87u, 0xCC4CF24DA3A1EC68u, 0xD0CD33A01AD9A383u}};
+
+/// @brief Binary expansion of <code>pi / 6</code>.
+constexpr auto SixthPiBits = binary_constant{0u, {
+    0x860A91C16B9B2C23u, 0x2DD99707AB3D688Bu, 0x70AC3405B19A884Du, 0x56B27F197CB7BCC1u,
+    0x8B86B0510978033Eu, 0x9FB8BBCD337C2CBCu, 0xCAC75C494C3F62CFu, 0x8A96239E48E12C2Eu}};
+
+/// @brief Gets the given constant scaled by two to the given power, rounded to nearest or,
+///   if not rounding, truncated.
+/// @note This is meant for compile-time use in setting up the constants that range
+///   reductions need at a higher precision than the fixed type itself has.
+template <typename T>
+constexpr auto scaled_constant(binary_constant value, unsigned int shift, bool rounded = true) noexcept -> T
+{
+    const auto bit = [value](unsigned int i) {
+        return (i < 512u)? static_cast<unsigned int>((value.fraction[i / 64u] >> (63u - (i % 64u))) & 1u): 0u;
+    };
+    auto result = static_cast<T>(value.whole);
+    for (auto i = 0u; i < shift; ++i)
+    {
+        result = static_cast<T>(result * 2 + bit(i));
+    }
+    return (rounded && (shift < 512u))? static_cast<T>(result + bit(shift)): result;
+}
+
 /// @brief fixed point pi value.
+/// @note This is pi truncated to the fixed type's fraction bits. It's from the binary
+///   expansion of <code>pi / 2</code> rather than from a floating point value, so it has all
+///   of those bits even for types having more fraction bits than <code>double</code> has.
 template <typename BT, unsigned int FB>
-constexpr auto FixedPi = fixed<BT, FB>{realnumb::numbers::pi};
+constexpr auto FixedPi = fixed<BT, FB>::from_value(
+    static_cast<BT>(scaled_constant<typename wider<BT>::type>(HalfPiBits, FB + 1u, false)));
 
-/// @brief Default iterations for @c exp function.
-constexpr auto DefaultExpIterations = 6;
+/// @brief Normalizes the given angular argument.
+template <typename BT, unsigned int FB>
+constexpr auto angular_normalize(fixed<BT, FB> angle_in_radians) -> fixed<BT, FB>
+{
+    constexpr auto one_rotation_in_radians = FixedPi<BT, FB> << 1;
+    angle_in_radians = fmod(angle_in_radians, one_rotation_in_radians);
+    if (angle_in_radians > FixedPi<BT, FB>)
+    {
+        // 190_deg becomes 190_deg - 360_deg = -170_deg
+        angle_in_radians -= one_rotation_in_radians;
+    }
+    else if (angle_in_radians < -FixedPi<BT, FB>)
+    {
+        // -200_deg becomes -200_deg + 360_deg = 100_deg
+        angle_in_radians += one_rotation_in_radians;
+    }
+    return angle_in_radians;
+}
 
-/// @brief Default iterations for @c sin function.
-constexpr auto DefaultSinIterations = 5;
+/// @brief Gets the number of bits needed to represent the given non-negative value.
+/// @details This is one more than the index of the highest set bit, or zero for zero.
+///   It's the same as <code>std::bit_width</code> from C++20.
+/// @see https://en.cppreference.com/w/cpp/numeric/bit_width
+template <typename T>
+constexpr auto bit_width(T value) noexcept -> unsigned int
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+    auto bits = static_cast<unsigned_type>(value);
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (sizeof(unsigned_type) <= sizeof(unsigned int))
+    {
+        return (bits == 0u)? 0u: static_cast<unsigned int>(
+            std::numeric_limits<unsigned int>::digits - __builtin_clz(bits));
+    }
+    else if constexpr (sizeof(unsigned_type) <= sizeof(unsigned long long))
+    {
+        return (bits == 0u)? 0u: static_cast<unsigned int>(
+            std::numeric_limits<unsigned long long>::digits - __builtin_clzll(bits));
+    }
+#endif
+    auto result = 0u;
+    for (auto shift = static_cast<unsigned int>(sizeof(unsigned_type) * 4u); shift > 0u; shift /= 2u)
+    {
+        if ((bits >> shift) != 0u)
+        {
+            bits >>= shift;
+            result += shift;
+        }
+    }
+    return result + static_cast<unsigned int>(bits);
+}
 
-/// @brief Default iterations for @c cos function.
-constexpr auto DefaultCosIterations = 5;
+/// @brief Shifts the given value right by the given amount with rounding to nearest.
+template <typename T>
+constexpr auto round_shift(T value, unsigned int shift) noexcept -> T
+{
+    return (shift == 0u)? value: static_cast<T>((value + (T{1} << (shift - 1u))) >> shift);
+}
 
-/// @brief Default iterations for @c atan function.
-constexpr auto DefaultAtanIterations = 5;
+/// @brief Gets the square root of the given non-negative value rounded down.
+/// @details Finds the result two bits of the value at a time from the highest down.
+/// @see https://en.wikipedia.org/wiki/Integer_square_root
+template <typename T>
+constexpr auto isqrt(T value) noexcept -> T
+{
+    if (value <= 0)
+    {
+        return T{0};
+    }
+    auto result = T{0};
+    for (auto bit = T{1} << ((bit_width(value) - 1u) & ~1u); bit != 0; bit >>= 2)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+    }
+    return result;
+}
 
-/// @brief Computes the natural logarithm.
-/// @note A better method may be explained in https://math.stackexchange.com/a/61236/408405
-/// @see https://en.cppreference.com/w/cpp/numeric/math/log
-/// @see https://en.wikipedia.org/wiki/Natural_logarithm
-template <int N, typename BT, unsigned int FB>
-constexpr auto log(fixed<BT, FB> arg) -> fixed<BT, FB>
+/// @brief Gets the cube root of the given non-negative value, scaled by two to the given
+///   power, rounded to nearest.
+/// @details Finds the result a bit at a time from the highest down, taking three bits of the
+///   scaled value at a time like long division does and keeping only the remainder. Then
+///   rounds it up if eight times the remainder is more than <code>12 r^2 + 6 r + 1</code>,
+///   i.e. if the scaled value is more than the cube of the result plus a half.
+/// @note The scaled value is never formed. The remainder is less than about three times
+///   the square of the result. So this only needs room in the given type for about twice
+///   the result's bits, rather than three times that, which lets types with many fraction
+///   bits get all of them. The value itself needs two bits to spare in the given type.
+/// @see https://en.wikipedia.org/wiki/Shifting_nth_root_algorithm
+template <typename T>
+constexpr auto icbrt(T value, unsigned int shift = 0u) noexcept -> T
+{
+    auto result = T{0};
+    auto remainder = T{0};
+    const auto next = [&result, &remainder](T bits) {
+        remainder = static_cast<T>((remainder << 3u) | bits);
+        result = static_cast<T>(result << 1u);
+        const auto step = static_cast<T>(3 * result * (result + 1) + 1);
+        if (remainder >= step)
+        {
+            remainder = static_cast<T>(remainder - step);
+            result = static_cast<T>(result + 1);
+        }
+    };
+    // Aligns the value's bits with the groups of three then takes the value's groups
+    // followed by the groups of zeros...
+    value = static_cast<T>(value << (shift % 3u));
+    for (auto group = (bit_width(value) + 2u) / 3u; group > 0u; --group)
+    {
+        next(static_cast<T>((value >> (3u * (group - 1u))) & 7));
+    }
+    for (auto group = shift / 3u; group > 0u; --group)
+    {
+        next(T{0});
+    }
+    return (8 * remainder > 12 * result * result + 6 * result + 1)? static_cast<T>(result + 1): result;
+}
+
+/// @brief Number of fraction bits used internally for the given fixed type's functions.
+/// @details This leaves room in the wider type for multiplying two such values together.
+template <typename BT, unsigned int FB>
+constexpr auto WorkingBits = (fixed<BT, FB>::total_bits - 2u > FB)
+    ? fixed<BT, FB>::total_bits - 2u: FB;
+
+/// @brief Number of bits beyond the fixed type's fraction bits that the kernels of the
+///   functions having bounded results are accurate to.
+/// @details Dropping the polynomial terms beyond this accuracy can only change a result
+///   that's within <code>2^-(FB + KernelGuardBits)</code> of a rounding boundary.
+/// @see precise.
+constexpr auto KernelGuardBits = static_cast<unsigned int>(precise::guard_bits);
+
+/// @brief Number of fraction bits that the kernels of the functions having bounded results
+///   are accurate to for the given accuracy tier and fixed type.
+/// @see precise, balanced, fast.
+template <typename Tier, typename BT, unsigned int FB>
+constexpr auto TierBits = static_cast<unsigned int>(std::clamp(static_cast<int>(FB) + Tier::guard_bits,
+                                                               1, static_cast<int>(WorkingBits<BT, FB>)));
+
+/// @brief Number of fraction bits that the kernels of the functions having bounded results
+///   are accurate to for the given fixed type.
+/// @details The results of these functions are no more than a few in magnitude so their
+///   kernels only need to be accurate to a little more than the fixed type's fraction bits.
+///   Their term counts derive from this. So a fixed type with fewer fraction bits evaluates
+///   fewer terms even though it still evaluates them with all of the working bits.
+/// @see KernelGuardBits.
+template <typename BT, unsigned int FB>
+constexpr auto ResultBits = TierBits<precise, BT, FB>;
+
+/// @brief Number of bits beyond the working bits that <code>ln(2)</code> has when it's
+///   multiplied by a power of two.
+/// @details The product is rounded from these extra bits so the error of
+///   <code>ln(2)</code> isn't multiplied. This is eight, or fewer for 8-bit types so that
+///   the product stays within their 16-bit wider type.
+template <typename BT, unsigned int FB>
+constexpr auto Ln2GuardBits = std::min(8u, fixed<BT, FB>::total_bits - 5u);
+
+/// @brief Multiply-add operation for values in internal form having the given number of
+///   fraction bits.
+/// @see poly::horner, poly::estrin.
+template <typename T, unsigned int Shift>
+struct scaled_multiply_add
+{
+    /// @brief Computes <code>a * b + c</code> with rounding of the product.
+    constexpr auto operator()(T a, T b, T c) const noexcept -> T
+    {
+        return round_shift(a * b, Shift) + c;
+    }
+};
+
+/// @brief Gets the fewest bits of accuracy, that's no fewer than the given accuracy bits,
+///   that the given table template has coefficients for with the given working bits.
+/// @return Accuracy bits of the table with the fewest coefficients meeting the given
+///   accuracy, or a value for which there's no table if there's no such table.
+/// @see minimax.hpp.
+template <template <unsigned int, unsigned int> class Table,
+          unsigned int WorkingBits, unsigned int AccuracyBits>
+constexpr auto table_accuracy() noexcept -> unsigned int
+{
+    if constexpr (Table<WorkingBits, AccuracyBits>::available || (AccuracyBits > WorkingBits + 8u))
+    {
+        return AccuracyBits;
+    }
+    else
+    {
+        return table_accuracy<Table, WorkingBits, AccuracyBits + 1u>();
+    }
+}
+
+/// @brief Gets the coefficients for a polynomial kernel evaluated with the given number of
+///   working bits that's accurate to the given number of bits.
+/// @details Uses the minimax coefficients of the given table template if it has them for
+///   the working bits, or otherwise the Maclaurin series coefficients from the given
+///   function. Minimax coefficients meet the same accuracy with fewer terms.
+/// @param series Function taking the value of one and returning the series coefficients.
+/// @see minimax.hpp.
+template <typename T, template <unsigned int, unsigned int> class Table,
+          unsigned int WorkingBits, unsigned int AccuracyBits, typename Series>
+constexpr auto kernel_coefficients(Series series) noexcept
+{
+    using table = Table<WorkingBits, table_accuracy<Table, WorkingBits, AccuracyBits>()>;
+    if constexpr (table::available)
+    {
+        auto result = std::array<T, table::coefficients.size()>{};
+        for (auto i = std::size_t{0}; i < result.size(); ++i)
+        {
+            result[i] = static_cast<T>(table::coefficients[i]);
+        }
+        return result;
+    }
+    else
+    {
+        return series(T{1} << WorkingBits);
+    }
+}
+
+/// @brief Gets the reciprocals of the odd numbers from one up to but not including
+///   <code>2 N + 1</code>, scaled by the given value of one.
+template <typename T, std::size_t N>
+constexpr auto odd_reciprocals(T one) noexcept -> std::array<T, N>
+{
+    auto result = std::array<T, N>{};
+    for (auto i = std::size_t{0}; i < N; ++i)
+    {
+        const auto odd = static_cast<T>(2u * i + 1u);
+        result[i] = (one + odd / 2) / odd;
+    }
+    return result;
+}
+
+/// @brief Gets the number of odd terms of the <code>atanh</code> series that @c log_scaled
+///   needs for the given number of fraction bits.
+/// @details The series argument's magnitude is at most <code>3 - 2 sqrt(2)</code>, which is
+///   less than <code>2^-2.5</code>, so term <code>i</code> is less than
+///   <code>2^-(2.5 (2 i + 1))</code>.
+constexpr auto log_terms(unsigned int fraction_bits) noexcept -> unsigned int
+{
+    auto n = 1u;
+    while (((2u * n + 1u) * 5u) / 2u < fraction_bits + 3u)
+    {
+        ++n;
+    }
+    return n;
+}
+
+/// @brief Computes the natural logarithm of the given positive value in internal form.
+/// @details Normalizes the value by its highest set bit into <code>x * 2^k</code> with
+///   <code>x</code> between <code>sqrt(1/2)</code> and <code>sqrt(2)</code>, then computes
+///   <code>ln(x) = 2 atanh(s)</code> for <code>s = (x - 1) / (x + 1)</code> via a short
+///   odd series, and adds <code>k ln(2)</code>. The cost of this is independent of the
+///   magnitude of the value.
+/// @tparam Bits Number of fraction bits the series is to be accurate to.
+/// @return Natural logarithm in the wider type with @c WorkingBits fraction bits.
+template <typename BT, unsigned int FB, unsigned int Bits = ResultBits<BT, FB>>
+constexpr auto log_scaled(BT value) noexcept -> typename wider<BT>::type
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = WorkingBits<BT, FB>;
+    constexpr auto one = wider_type{1} << q;
+    constexpr auto sqrt2 = scaled_constant<wider_type>(Sqrt2Bits, q);
+    constexpr auto extra = Ln2GuardBits<BT, FB>;
+    constexpr auto ln2 = scaled_constant<wider_type>(Ln2Bits, q + extra);
+    constexpr auto terms = std::size_t{log_terms(Bits)};
+    const auto width = bit_width(value);
+    auto k = static_cast<int>(width) - 1 - static_cast<int>(FB);
+    const auto x = wider_type{value} << (q + 1u - width); // between 1 and 2 (with q bits)
+    auto denominator = one;
+    if (x > sqrt2)
+    {
+        denominator = one * 2; // use x / 2
+        ++k;
+    }
+    const auto numerator = (x - denominator) * one;
+    const auto divisor = x + denominator;
+    const auto offset = ((numerator < 0)? -divisor: divisor) / 2;
+    const auto s = (numerator + offset) / divisor;
+    const auto z = round_shift<wider_type>(s * s, q);
+    // Polynomial for atanh(s) / s = 1 + z/3 + z^2/5 + ...
+    constexpr auto coefficients = kernel_coefficients<wider_type, minimax_atanh, q, Bits>(
+        [](wider_type o) { return odd_reciprocals<wider_type, terms>(o); });
+    const auto sum = poly::horner(z, coefficients, scaled_multiply_add<wider_type, q>{});
+    return round_shift<wider_type>(k * ln2, extra) + round_shift(2 * s * sum, q);
+}
+
+/// @brief Number of fraction bits of the scale factor used by the logarithm functions.
+/// @note Fewer bits for the scale factor keeps its product with the natural logarithm
+///   within the wider type. The natural logarithms of 16-bit and 8-bit types are less
+///   than 11 and 3 in magnitude, so 12 and 6 bits still fit for those.
+template <typename BT, unsigned int FB>
+constexpr auto LogScaleBits = (fixed<BT, FB>::total_bits > 16u)
+    ? fixed<BT, FB>::total_bits - 8u: (fixed<BT, FB>::total_bits > 8u)? 12u: 6u;
+
+/// @brief Scale factor of the logarithm functions.
+/// @details This splits the factor into two parts of @c LogScaleBits bits each. Multiplying
+///   a natural logarithm by each part still fits the wider type but the factor has twice
+///   the bits. Types having nearly as many fraction bits as @c LogScaleBits, like
+///   <code>fixed<std::int64_t, 56></code>, need those extra bits for <code>log2</code> to
+///   be exact for powers of two.
+template <typename T>
+struct log_scale_factor
+{
+    T hi; ///< Factor truncated to @c LogScaleBits fraction bits.
+    T lo; ///< Rest of the factor, scaled by two to the power of @c LogScaleBits.
+};
+
+/// @brief Gets the scale factor for the logarithm functions from the given constant.
+template <typename BT, unsigned int FB>
+constexpr auto log_scale(binary_constant value) noexcept -> log_scale_factor<typename wider<BT>::type>
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto bits = LogScaleBits<BT, FB>;
+    const auto hi = scaled_constant<wider_type>(value, bits, false);
+    return {hi, static_cast<wider_type>(scaled_constant<wider_type>(value, 2u * bits) - (hi << bits))};
+}
+
+/// @brief Scales the given natural logarithm in the wider type by the given factor.
+template <typename BT, unsigned int FB>
+constexpr auto log_scaled_by(typename wider<BT>::type value,
+                             log_scale_factor<typename wider<BT>::type> scale) noexcept
+    -> typename wider<BT>::type
+{
+    constexpr auto bits = LogScaleBits<BT, FB>;
+    return round_shift(value * scale.hi + round_shift(value * scale.lo, bits), bits);
+}
+
+/// @brief Common implementation of the logarithm functions.
+/// @param arg Value whose logarithm is to be found.
+/// @param scale Factor to scale the natural logarithm by. This is meant to be a
+///   compile-time constant from @c log_scale.
+/// @tparam Bits Number of fraction bits the series is to be accurate to.
+template <typename BT, unsigned int FB, unsigned int Bits = ResultBits<BT, FB>>
+constexpr auto log(fixed<BT, FB> arg, log_scale_factor<typename wider<BT>::type> scale) -> fixed<BT, FB>
 {
     if (arg.isnan() || (arg < 0))
     {
@@ -46,100 +447,607 @@ constexpr auto log(fixed<BT, FB> arg) -> fixed<BT, FB>
     {
         return fixed<BT, FB>::get_negative_infinity();
     }
-    if (arg == 1)
+    if (arg == fixed<BT, FB>::get_positive_infinity())
     {
-        return fixed<BT, FB>{0};
+        return fixed<BT, FB>::get_positive_infinity();
     }
-    if (arg == fixed<BT, FB>::get_positive_infinity())
+    const auto result = log_scaled_by<BT, FB>(log_scaled<BT, FB, Bits>(arg.get_value()), scale);
+    return fixed<BT, FB>::from_value(static_cast<BT>(round_shift(result, WorkingBits<BT, FB> - FB)));
+}
+
+/// @brief Mask of the fraction bits of the underlying value of the given fixed type.
+template <typename BT, unsigned int FB>
+constexpr auto FractionMask = static_cast<BT>((typename unsigned_type<BT>::type{1} << FB) - 1u);
+
+/// @brief Converts the given underlying value from the wider type into the fixed type.
+/// @return Value that saturates to the infinities for values out of the finite range.
+template <typename BT, unsigned int FB>
+constexpr auto saturate(typename wider<BT>::type value) noexcept -> fixed<BT, FB>
+{
+    if (value > fixed<BT, FB>::get_max().get_value())
     {
         return fixed<BT, FB>::get_positive_infinity();
     }
-    if (arg <= 2)
+    if (value < fixed<BT, FB>::get_lowest().get_value())
+    {
+        return fixed<BT, FB>::get_negative_infinity();
+    }
+    return fixed<BT, FB>::from_value(static_cast<BT>(value));
+}
+
+/// @brief Gets the reciprocals of the factorials from <code>0!</code> up to but not
+///   including <code>N!</code>, scaled by the given value of one.
+template <typename T, std::size_t N>
+constexpr auto reciprocal_factorials(T one) noexcept -> std::array<T, N>
+{
+    auto result = std::array<T, N>{};
+    auto factorial = T{1};
+    for (auto i = std::size_t{0}; i < N; ++i)
     {
-        // ln(x) = sum((-1)^(n + 1) * (x - 1)^n / n) from n = 1 to infinity
-        // ln(x) = (x - 1) - (x - 1)^2/2 + (x - 1)^3/3 - (x - 1)^4/4 ....
-        arg -= 1;
-        auto res = arg;
-        auto sign = -1;
-        auto pt = arg;
-        for (auto i = 2; i < N; ++i)
+        if (i > 1u)
         {
-            pt *= arg;
-            res += sign * pt / i;
-            sign = -sign;
+            factorial *= static_cast<T>(i);
         }
-        return res;
+        result[i] = (one + factorial / 2) / factorial;
+    }
+    return result;
+}
+
+/// @brief Number of fraction bits beyond @c WorkingBits that the exponential functions'
+///   remainders and kernel results have.
+/// @details Large results of the exponential functions have up to a couple more
+///   significant bits than @c WorkingBits. The remainder's magnitude is less than
+///   <code>0.35</code>, so there's room for these extra bits in products with it.
+constexpr auto ExpGuardBits = 2u;
+
+/// @brief Number of fraction bits of the exponential functions' remainders and kernel
+///   results for the given fixed type.
+/// @see ExpGuardBits.
+template <typename BT, unsigned int FB>
+constexpr auto ExpBits = WorkingBits<BT, FB> + ExpGuardBits;
+
+/// @brief Number of fraction bits that @c exp_scaled is accurate to for the given accuracy
+///   tier and fixed type.
+/// @details The exponential functions' results can have all of the fixed type's bits. So
+///   this is relative to the fixed type's total bits rather than to its fraction bits, and
+///   is no more than one bit beyond @c ExpBits which is what the default tier needs.
+template <typename Tier, typename BT, unsigned int FB>
+constexpr auto ExpTierBits = static_cast<unsigned int>(
+    std::min(static_cast<int>(fixed<BT, FB>::total_bits) - 1 + Tier::guard_bits,
+             static_cast<int>(ExpBits<BT, FB>) + 1));
+
+/// @brief Gets the number of Maclaurin series terms that @c exp_scaled needs for the
+///   given number of bits.
+/// @details The reduced argument's magnitude is at most <code>ln(2) / 2</code>, which is
+///   less than <code>0.35</code>, so this stops at the first term whose bound is less
+///   than the working bits' resolution. That's needed since scaling the result by
+///   <code>2^k</code> can bring all of its bits into the fixed type's range.
+template <typename T>
+constexpr auto exp_terms(unsigned int working_bits) noexcept -> std::size_t
+{
+    auto bound = T{1} << working_bits;
+    auto n = std::size_t{1};
+    while (bound > 0)
+    {
+        bound = bound * 35 / 100 / static_cast<T>(n);
+        ++n;
     }
-    // The following algorithm isn't as accurate as desired.
-    // Is there a better one?
-    // ln(x) = ((x - 1) / x) + ((x - 1) / x)^2/2 + ((x - 1) / x)^3/3 + ...
-    arg = (arg - 1) / arg;
-    auto pt = arg;
-    auto res = pt;
-    for (auto i = 2; i < N; ++i)
+    return n;
+}
+
+/// @brief Gets the given coefficients without the first one, each multiplied by two to
+///   the given power.
+template <typename T, std::size_t N>
+constexpr auto tail_coefficients(const std::array<T, N>& coefficients, unsigned int shift) noexcept
+    -> std::array<T, N - 1u>
+{
+    auto result = std::array<T, N - 1u>{};
+    for (auto i = std::size_t{1}; i < N; ++i)
     {
-        pt *= arg;
-        res += pt / i;
+        result[i - 1u] = coefficients[i] << shift;
     }
-    return res;
+    return result;
+}
+
+/// @brief Computes Euler's number raised to the power of the given small value.
+/// @details This is <code>c0 + r P(r)</code> with the polynomial <code>P</code> of the
+///   remaining coefficients evaluated with one more than @c WorkingBits fraction bits.
+///   That's as many as fit in its products with the remainder since <code>P(r)</code> is
+///   a little more than one. So only the remainder and the final sum have all of the
+///   extra @c ExpGuardBits.
+/// @param r Value with @c ExpBits fraction bits whose magnitude is no more than
+///   about <code>ln(2) / 2</code>.
+/// @tparam Bits Number of fraction bits the polynomial is to be accurate to.
+/// @return Result in the wider type with @c ExpBits fraction bits.
+/// @note Unlike the kernels of the functions having bounded results, this is by default
+///   accurate to more than all of the working bits. That's since the result gets scaled by
+///   a power of two which can bring all of those bits into the fixed type's range.
+/// @see ExpTierBits.
+template <typename BT, unsigned int FB, unsigned int Bits = ExpBits<BT, FB> + 1u>
+constexpr auto exp_scaled(typename wider<BT>::type r) noexcept -> typename wider<BT>::type
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = WorkingBits<BT, FB>;
+    constexpr auto e = ExpBits<BT, FB>;
+    constexpr auto terms = exp_terms<wider_type>(Bits);
+    constexpr auto coefficients = kernel_coefficients<wider_type, minimax_exp, q, Bits>(
+        [](wider_type one) { return reciprocal_factorials<wider_type, terms>(one); });
+    constexpr auto tail = tail_coefficients(coefficients, 1u);
+    const auto sum = poly::horner(r, tail, scaled_multiply_add<wider_type, e>{});
+    return (coefficients[0] << ExpGuardBits) + round_shift(r * sum, q + 1u);
 }
 
-/// @brief Computes the square root of a non-negative value.
-/// @see https://en.wikipedia.org/wiki/Methods_of_computing_square_roots
+/// @brief Converts the given value having @c ExpBits fraction bits, times two to the
+///   given power, into the fixed type.
+/// @return Value that saturates to positive infinity or to zero.
 template <typename BT, unsigned int FB>
-constexpr auto compute_sqrt(fixed<BT, FB> arg) -> fixed<BT, FB>
+constexpr auto exp_finish(typename wider<BT>::type value, int k) noexcept -> fixed<BT, FB>
 {
-    auto temp = fixed<BT, FB>{1};
-    auto tempSquared = temp * temp;
-    const auto greaterThanOne = arg > 1;
-    auto lower = greaterThanOne? fixed<BT, FB>{1}: arg;
-    auto upper = greaterThanOne? arg: fixed<BT, FB>{1};
-    while (arg != tempSquared)
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = static_cast<int>(ExpBits<BT, FB>);
+    constexpr auto max = wider_type{fixed<BT, FB>::get_max().get_value()};
+    const auto shift = q - static_cast<int>(FB) - k;
+    if (shift < 0)
     {
-        const auto mid = (lower + upper) / 2;
-        if (temp == mid)
+        if ((-shift >= static_cast<int>(fixed<BT, FB>::total_bits)) || (value > (max >> -shift)))
         {
-            break;
-        }
-        temp = mid;
-        tempSquared = temp * temp;
-        if (tempSquared > arg)
-        {
-            upper = temp;
+            return fixed<BT, FB>::get_positive_infinity();
         }
-        else if (tempSquared < arg)
+        return fixed<BT, FB>::from_value(static_cast<BT>(value << -shift));
+    }
+    if (shift > q + 1)
+    {
+        return fixed<BT, FB>{0};
+    }
+    const auto result = round_shift(value, static_cast<unsigned int>(shift));
+    return (result > max)? fixed<BT, FB>::get_positive_infinity():
+        fixed<BT, FB>::from_value(static_cast<BT>(result));
+}
+
+/// @brief Range reduced argument of the exponential functions.
+/// @see exp_reduce, exp2_reduce.
+template <typename BT>
+struct exp_reduction
+{
+    int k; ///< Power of two to scale the exponential of the remainder by.
+    typename wider<BT>::type r; ///< Remainder with @c ExpBits fraction bits.
+};
+
+/// @brief Gets the internal value of the largest magnitude argument that the exponential
+///   functions' range reductions handle.
+/// @details Larger magnitude arguments' results are infinite or zero anyway, so this
+///   keeps their power of two from overflowing.
+template <typename BT, unsigned int FB>
+constexpr auto exp_reduce_limit() noexcept -> typename wider<BT>::type
+{
+    using wider_type = typename wider<BT>::type;
+    return wider_type{fixed<BT, FB>::total_bits} << FB;
+}
+
+/// @brief Splits the given finite value into <code>k ln(2) + r</code>.
+/// @details The quotient comes from multiplying by a scaled <code>log2(e)</code> and the
+///   remainder from subtracting <code>k</code> times <code>ln(2)</code> scaled to
+///   @c ExpBits fraction bits. So the remainder's magnitude is no more than about
+///   <code>ln(2) / 2</code>. The product of <code>k</code> and <code>ln(2)</code> is
+///   rounded from @c Ln2GuardBits more bits so the error of <code>ln(2)</code> isn't
+///   multiplied.
+template <typename BT, unsigned int FB>
+constexpr auto exp_reduce(fixed<BT, FB> arg) noexcept -> exp_reduction<BT>
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = ExpBits<BT, FB>;
+    constexpr auto total_bits = fixed<BT, FB>::total_bits;
+    constexpr auto quotient_bits = total_bits - 2u;
+    constexpr auto log2e = scaled_constant<wider_type>(Log2EBits, quotient_bits);
+    constexpr auto extra = Ln2GuardBits<BT, FB>;
+    constexpr auto ln2 = scaled_constant<wider_type>(Ln2Bits, q + extra);
+    constexpr auto limit = exp_reduce_limit<BT, FB>();
+    const auto value = wider_type{arg.get_value()};
+    if ((value > limit) || (value < -limit))
+    {
+        return {(value > 0)? static_cast<int>(total_bits): -2 * static_cast<int>(total_bits), 0};
+    }
+    const auto k = round_shift(value * log2e, FB + quotient_bits);
+    return {static_cast<int>(k),
+            static_cast<wider_type>(value * (wider_type{1} << (q - FB)) - round_shift(k * ln2, extra))};
+}
+
+/// @brief Splits the given finite value into <code>k + f</code>.
+/// @return <code>k</code> with <code>f ln(2)</code> as the remainder.
+template <typename BT, unsigned int FB>
+constexpr auto exp2_reduce(fixed<BT, FB> arg) noexcept -> exp_reduction<BT>
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto total_bits = fixed<BT, FB>::total_bits;
+    constexpr auto q = WorkingBits<BT, FB>;
+    constexpr auto ln2 = scaled_constant<wider_type>(Ln2Bits, ExpBits<BT, FB>);
+    constexpr auto limit = exp_reduce_limit<BT, FB>();
+    const auto value = wider_type{arg.get_value()};
+    if ((value > limit) || (value < -limit))
+    {
+        return {(value > 0)? static_cast<int>(total_bits): -2 * static_cast<int>(total_bits), 0};
+    }
+    const auto k = round_shift(value, FB);
+    const auto f = (value - k * (wider_type{1} << FB)) * (wider_type{1} << (q - FB));
+    return {static_cast<int>(k), round_shift<wider_type>(f * ln2, q)};
+}
+
+/// @brief Gets Euler's number raised to the power of the given reduced argument in
+///   internal form.
+/// @note The power of two must be small enough for the result to fit the wider type.
+/// @tparam Bits Number of fraction bits the polynomial is to be accurate to.
+/// @return Result in the wider type with @c ExpBits fraction bits.
+template <typename BT, unsigned int FB, unsigned int Bits = ExpBits<BT, FB> + 1u>
+constexpr auto exp_value(exp_reduction<BT> reduced) noexcept -> typename wider<BT>::type
+{
+    constexpr auto q = static_cast<int>(ExpBits<BT, FB>);
+    const auto value = exp_scaled<BT, FB, Bits>(reduced.r);
+    if (reduced.k >= 0)
+    {
+        return value << reduced.k;
+    }
+    return (-reduced.k > q + 1)? 0: round_shift(value, static_cast<unsigned int>(-reduced.k));
+}
+
+/// @brief Power of two beyond which the hyperbolic functions ignore <code>e^-x</code>.
+/// @details Beyond this, <code>e^-x</code> is less than <code>2^-(FB + 3)</code> so it
+///   can only change a result that's that close to a rounding boundary.
+template <typename BT, unsigned int FB>
+constexpr auto HyperbolicLimit = static_cast<int>(FB) + 3;
+
+/// @brief Computes the hyperbolic sine or cosine of the given non-negative finite value.
+/// @details This is <code>(e^x - e^-x) / 2</code> or <code>(e^x + e^-x) / 2</code> with
+///   both powers in internal form and a single rounding at the end. So there's no loss
+///   of accuracy from the cancellation for arguments near zero. For large arguments, this
+///   is just <code>e^x / 2</code>.
+/// @tparam Bits Number of fraction bits the polynomial is to be accurate to.
+/// @see HyperbolicLimit.
+template <typename BT, unsigned int FB, unsigned int Bits = ExpBits<BT, FB> + 1u>
+constexpr auto sinh_cosh(fixed<BT, FB> arg, bool cosine) -> fixed<BT, FB>
+{
+    constexpr auto q = ExpBits<BT, FB>;
+    const auto reduced = exp_reduce(arg);
+    if (reduced.k > HyperbolicLimit<BT, FB>)
+    {
+        return exp_finish<BT, FB>(exp_scaled<BT, FB, Bits>(reduced.r), reduced.k - 1);
+    }
+    const auto ep = exp_value<BT, FB, Bits>(reduced);
+    const auto em = exp_value<BT, FB, Bits>(exp_reduce(-arg));
+    return saturate<BT, FB>(round_shift(cosine? ep + em: ep - em, q - FB + 1u));
+}
+
+/// @brief Computes the hyperbolic tangent of the given non-negative finite value.
+/// @details This is <code>(1 - e^-2x) / (1 + e^-2x)</code> in internal form with a single
+///   rounding at the end. For large arguments, this is just one.
+/// @tparam Bits Number of fraction bits the polynomial is to be accurate to. The error
+///   of <code>e^-x</code> gets multiplied by up to four, so this needs two more bits
+///   than the result.
+/// @see HyperbolicLimit.
+template <typename BT, unsigned int FB, unsigned int Bits = ResultBits<BT, FB> + 2u>
+constexpr auto tanh(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = WorkingBits<BT, FB>;
+    constexpr auto one = wider_type{1} << q;
+    if (exp_reduce(arg).k > HyperbolicLimit<BT, FB>)
+    {
+        return fixed<BT, FB>{1};
+    }
+    const auto em = round_shift(exp_value<BT, FB, Bits>(exp_reduce(-arg)), ExpGuardBits);
+    const auto e2 = round_shift(em * em, q);
+    const auto divisor = one + e2;
+    return fixed<BT, FB>::from_value(static_cast<BT>(
+        ((one - e2) * (wider_type{1} << FB) + divisor / 2) / divisor));
+}
+
+/// @brief Angle reduced to within a quarter rotation of zero.
+/// @see quadrant_reduce.
+template <typename BT, unsigned int FB>
+struct quadrant_angle
+{
+    /// @brief Quadrant index from 0 to 3.
+    /// @details The number of quarter rotations modulo four that were removed from the
+    ///   original angle.
+    unsigned int quadrant;
+
+    /// @brief Remaining angle between about <code>-pi/4</code> and <code>+pi/4</code>.
+    fixed<BT, FB> angle;
+};
+
+/// @brief Angle reduced to within a quarter rotation of zero in internal form.
+/// @see quadrant_reduce_to.
+template <typename BT>
+struct quadrant_remainder
+{
+    /// @brief Quadrant index from 0 to 3.
+    unsigned int quadrant;
+
+    /// @brief Remaining angle between about <code>-pi/4</code> and <code>+pi/4</code>.
+    typename wider<BT>::type r;
+};
+
+/// @brief Reduces the given finite angle to a quadrant index and a remainder with the given
+///   number of fraction bits.
+/// @details This is a Cody-Waite style range reduction that does its work on the internal
+///   representation of the given value. The quadrant index comes from multiplying by a
+///   scaled <code>2/pi</code> value. The remainder comes from subtracting that many
+///   quarter rotations from the angle using a <code>pi/2</code> value that has about
+///   as many extra bits of precision as the base type has bits. So only one rounding
+///   occurs, and that's at the end. This also stays accurate for large angles.
+/// @tparam Bits Number of fraction bits for the remainder. From @c FB up to @c FB plus
+///   two less than the base type's number of bits.
+/// @note Behavior is undefined for non-finite values.
+/// @see https://en.wikipedia.org/wiki/Argument_reduction
+template <unsigned int Bits, typename BT, unsigned int FB>
+constexpr auto quadrant_reduce_to(fixed<BT, FB> angle_in_radians) noexcept -> quadrant_remainder<BT>
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto quotient_bits = fixed<BT, FB>::total_bits - 2u;
+    constexpr auto guard_bits = fixed<BT, FB>::total_bits - 2u;
+    constexpr auto quotient_shift = FB + quotient_bits;
+    constexpr auto two_over_pi = scaled_constant<wider_type>(TwoOverPiBits, quotient_bits);
+    constexpr auto half_pi = scaled_constant<wider_type>(HalfPiBits, FB + guard_bits);
+    constexpr auto guard_scale = wider_type{1} << guard_bits;
+    static_assert((Bits >= FB) && (Bits <= FB + guard_bits), "unsupported remainder bits");
+    const auto value = wider_type{angle_in_radians.get_value()};
+    const auto k = (value * two_over_pi + (wider_type{1} << (quotient_shift - 1u))) >> quotient_shift;
+    const auto remainder = value * guard_scale - k * half_pi;
+    return {static_cast<unsigned int>(k) & 3u, round_shift<wider_type>(remainder, FB + guard_bits - Bits)};
+}
+
+/// @brief Reduces the given finite angle to a quadrant index and a remainder.
+/// @note Behavior is undefined for non-finite values.
+/// @see quadrant_reduce_to.
+template <typename BT, unsigned int FB>
+constexpr auto quadrant_reduce(fixed<BT, FB> angle_in_radians) noexcept -> quadrant_angle<BT, FB>
+{
+    const auto reduced = quadrant_reduce_to<FB>(angle_in_radians);
+    return {reduced.quadrant, fixed<BT, FB>::from_value(static_cast<BT>(reduced.r))};
+}
+
+/// @brief Gets the number of terms of the <code>sin(r) / r</code> and <code>cos(r)</code>
+///   polynomials in <code>r^2</code> that @c sin needs for the given number of fraction bits.
+/// @details The reduced angle's magnitude is at most about <code>pi / 4</code>, which is
+///   less than <code>0.79</code>, so this stops once the first omitted term's bound is less
+///   than the fraction bits' resolution.
+template <typename T>
+constexpr auto sin_cos_terms(unsigned int fraction_bits) noexcept -> std::size_t
+{
+    auto bound = T{1} << fraction_bits;
+    auto n = std::size_t{0};
+    while (bound > 0)
+    {
+        ++n;
+        bound = bound * 79 / 100 * 79 / 100 / static_cast<T>((2u * n - 1u) * (2u * n));
+    }
+    return n;
+}
+
+/// @brief Gets the coefficients of the Maclaurin series of <code>cos(r)</code> as a
+///   polynomial in <code>r^2</code> for an offset of zero, or of <code>sin(r) / r</code>
+///   for an offset of one.
+template <typename T, std::size_t N>
+constexpr auto sin_cos_coefficients(T one, std::size_t offset) noexcept -> std::array<T, N>
+{
+    const auto reciprocals = reciprocal_factorials<T, 2u * N + 1u>(one);
+    auto result = std::array<T, N>{};
+    for (auto i = std::size_t{0}; i < N; ++i)
+    {
+        const auto value = reciprocals[2u * i + offset];
+        result[i] = (i % 2u == 0u)? value: -value;
+    }
+    return result;
+}
+
+/// @brief Computes the sine, or the cosine, of the given angle in internal form.
+/// @details Evaluates the division-free polynomial for the sine or cosine with
+///   @c WorkingBits fraction bits.
+/// @param r Angle with @c WorkingBits fraction bits whose magnitude is no more than about
+///   <code>pi / 4</code>.
+/// @param cosine Whether to compute the cosine instead of the sine.
+/// @tparam Bits Number of fraction bits the polynomial is to be accurate to.
+/// @return Result in the wider type with @c WorkingBits fraction bits.
+template <typename BT, unsigned int FB, unsigned int Bits = ResultBits<BT, FB>>
+constexpr auto sin_scaled(typename wider<BT>::type r, bool cosine) noexcept -> typename wider<BT>::type
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = WorkingBits<BT, FB>;
+    constexpr auto terms = sin_cos_terms<wider_type>(Bits);
+    constexpr auto op = scaled_multiply_add<wider_type, q>{};
+    const auto z = round_shift<wider_type>(r * r, q);
+    if (cosine)
+    {
+        constexpr auto coefficients = kernel_coefficients<wider_type, minimax_cos, q, Bits>(
+            [](wider_type one) { return sin_cos_coefficients<wider_type, terms>(one, 0u); });
+        return poly::horner(z, coefficients, op);
+    }
+    constexpr auto coefficients = kernel_coefficients<wider_type, minimax_sin, q, Bits>(
+        [](wider_type one) { return sin_cos_coefficients<wider_type, terms>(one, 1u); });
+    return round_shift(r * poly::horner(z, coefficients, op), q);
+}
+
+/// @brief Computes the sine of the given reduced angle.
+/// @details Evaluates the sine or cosine of the reduced angle, depending on the quadrant,
+///   with @c WorkingBits fraction bits and rounds that just once to the fixed type.
+/// @tparam Bits Number of fraction bits the polynomial is to be accurate to.
+template <typename BT, unsigned int FB, unsigned int Bits = ResultBits<BT, FB>>
+constexpr auto sin(quadrant_angle<BT, FB> arg) -> fixed<BT, FB>
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = WorkingBits<BT, FB>;
+    const auto r = wider_type{arg.angle.get_value()} * (wider_type{1} << (q - FB));
+    const auto result = round_shift(sin_scaled<BT, FB, Bits>(r, arg.quadrant % 2u != 0u), q - FB);
+    return fixed<BT, FB>::from_value(static_cast<BT>((arg.quadrant >= 2u)? -result: result));
+}
+
+/// @brief Gets the number of odd terms of the arctangent series that @c atan_scaled needs
+///   for the given number of fraction bits.
+/// @details The reduced argument's magnitude is at most <code>2 - sqrt(3)</code>, which is
+///   less than <code>2^-1.9</code>, so term <code>i</code> is less than
+///   <code>2^-(1.9 (2 i + 1))</code>.
+constexpr auto atan_terms(unsigned int fraction_bits) noexcept -> unsigned int
+{
+    auto n = 1u;
+    while (((2u * n + 1u) * 19u) / 10u < fraction_bits + 1u)
+    {
+        ++n;
+    }
+    return n;
+}
+
+/// @brief Gets the coefficients of the Maclaurin series of <code>atan(t) / t</code> as a
+///   polynomial in <code>t^2</code>.
+template <typename T, std::size_t N>
+constexpr auto atan_coefficients(T one) noexcept -> std::array<T, N>
+{
+    auto result = odd_reciprocals<T, N>(one);
+    for (auto i = std::size_t{1}; i < N; i += 2u)
+    {
+        result[i] = -result[i];
+    }
+    return result;
+}
+
+/// @brief Computes the arctangent of the given non-negative value in internal form.
+/// @param x Value with @c WorkingBits fraction bits. Up to the square of one in
+///   magnitude.
+/// @details Uses <code>atan(x) = pi/2 - atan(1/x)</code> to get the value to no more than
+///   one, then <code>atan(x) = pi/6 + atan((sqrt(3) x - 1) / (sqrt(3) + x))</code> to get
+///   it to no more than <code>2 - sqrt(3)</code> in magnitude. The arctangent of that comes
+///   from a short odd polynomial. All of this is done with @c WorkingBits fraction bits.
+/// @tparam Bits Number of fraction bits the polynomial is to be accurate to.
+/// @return Arctangent in the wider type with @c WorkingBits fraction bits.
+template <typename BT, unsigned int FB, unsigned int Bits = ResultBits<BT, FB>>
+constexpr auto atan_scaled(typename wider<BT>::type x) noexcept -> typename wider<BT>::type
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = WorkingBits<BT, FB>;
+    constexpr auto one = wider_type{1} << q;
+    constexpr auto half_pi = scaled_constant<wider_type>(HalfPiBits, q);
+    constexpr auto sixth_pi = scaled_constant<wider_type>(SixthPiBits, q);
+    constexpr auto sqrt3 = scaled_constant<wider_type>(Sqrt3Bits, q);
+    constexpr auto terms = std::size_t{atan_terms(Bits)};
+    const auto reciprocal = x > one;
+    if (reciprocal)
+    {
+        x = (one * one + x / 2) / x;
+    }
+    auto offset = wider_type{0};
+    if (x > 2 * one - sqrt3)
+    {
+        const auto numerator = (round_shift(sqrt3 * x, q) - one) * one;
+        const auto divisor = sqrt3 + x;
+        x = (numerator + ((numerator < 0)? -divisor: divisor) / 2) / divisor;
+        offset = sixth_pi;
+    }
+    const auto z = round_shift<wider_type>(x * x, q);
+    // Polynomial for atan(t) / t = 1 - z/3 + z^2/5 - ...
+    constexpr auto coefficients = kernel_coefficients<wider_type, minimax_atan, q, Bits>(
+        [](wider_type o) { return atan_coefficients<wider_type, terms>(o); });
+    const auto sum = poly::horner(z, coefficients, scaled_multiply_add<wider_type, q>{});
+    const auto result = offset + round_shift(x * sum, q);
+    return reciprocal? half_pi - result: result;
+}
+
+/// @brief Computes the arcsine of the given non-negative value in internal form.
+/// @details This is <code>atan(x / sqrt(1 - x^2))</code> where the square root comes
+///   from the exact square in internal form. So it stays accurate for values near one.
+/// @param x Value with @c WorkingBits fraction bits. No more than one.
+/// @tparam Bits Number of fraction bits the arctangent polynomial is to be accurate to.
+/// @return Arcsine in the wider type with @c WorkingBits fraction bits.
+template <typename BT, unsigned int FB, unsigned int Bits = ResultBits<BT, FB>>
+constexpr auto asin_scaled(typename wider<BT>::type x) noexcept -> typename wider<BT>::type
+{
+    using wider_type = typename wider<BT>::type;
+    constexpr auto q = WorkingBits<BT, FB>;
+    constexpr auto one = wider_type{1} << q;
+    const auto y = isqrt(one * one - x * x);
+    if (y == 0)
+    {
+        return scaled_constant<wider_type>(HalfPiBits, q);
+    }
+    return atan_scaled<BT, FB, Bits>((x * one + y / 2) / y);
+}
+
+/// @brief Gets the smallest factor of the given value that's greater than one.
+constexpr auto smallest_factor(unsigned int n) noexcept -> unsigned int
+{
+    for (auto f = 2u; f * f <= n; ++f)
+    {
+        if (n % f == 0u)
         {
-            lower = temp;
+            return f;
         }
     }
-    return temp;
+    return n;
 }
 
-/// @brief Normalizes the given angular argument.
-template <typename BT, unsigned int FB>
-constexpr auto angular_normalize(fixed<BT, FB> angle_in_radians) -> fixed<BT, FB>
+/// @brief Gets the number of multiplications @c unrolled_pow takes for the given power.
+constexpr auto pow_chain_length(unsigned int n) noexcept -> unsigned int
 {
-    constexpr auto one_rotation_in_radians = fixed<BT, FB>(2) * FixedPi<BT, FB>;
-    angle_in_radians = fmod(angle_in_radians, one_rotation_in_radians);
-    if (angle_in_radians > FixedPi<BT, FB>)
+    if (n <= 1u)
     {
-        // 190_deg becomes 190_deg - 360_deg = -170_deg
-        angle_in_radians -= one_rotation_in_radians;
+        return 0u;
     }
-    else if (angle_in_radians < -FixedPi<BT, FB>)
+    if (n % 2u == 0u)
     {
-        // -200_deg becomes -200_deg + 360_deg = 100_deg
-        angle_in_radians += one_rotation_in_radians;
+        return pow_chain_length(n / 2u) + 1u;
     }
-    return angle_in_radians;
+    const auto f = smallest_factor(n);
+    const auto binary = pow_chain_length(n - 1u) + 1u;
+    return (f == n)? binary: std::min(binary, pow_chain_length(f) + pow_chain_length(n / f));
 }
 
-static constexpr auto LogMaxForLowerIterations = 8;
-static constexpr auto LogIterationsForSmaller = 36;
-static constexpr auto LogIterationsForLarger = 96;
+/// @brief Gets the factor @c unrolled_pow splits the given odd power by, or zero for
+///   using the binary method of one multiplication by the base instead.
+constexpr auto pow_chain_factor(unsigned int n) noexcept -> unsigned int
+{
+    const auto f = smallest_factor(n);
+    return ((f != n) && (pow_chain_length(f) + pow_chain_length(n / f) < pow_chain_length(n - 1u) + 1u))
+        ? f: 0u;
+}
 
-static constexpr auto ExpMaxForLowerIterations = 2;
-static constexpr auto ExpIterationsForLarger = 24;
+/// @brief Raises the given value to the given non-negative compile-time power.
+/// @see pow_chain_length.
+template <unsigned int N, typename BT, unsigned int FB>
+constexpr auto unrolled_pow(fixed<BT, FB> value) -> fixed<BT, FB>
+{
+    if constexpr (N == 0u)
+    {
+        return fixed<BT, FB>{1};
+    }
+    else if constexpr (N == 1u)
+    {
+        return value;
+    }
+    else if constexpr (N % 2u == 0u)
+    {
+        const auto half = unrolled_pow<N / 2u>(value);
+        return half * half;
+    }
+    else if constexpr (pow_chain_factor(N) != 0u)
+    {
+        return unrolled_pow<N / pow_chain_factor(N)>(unrolled_pow<pow_chain_factor(N)>(value));
+    }
+    else
+    {
+        return unrolled_pow<N - 1u>(value) * value;
+    }
+}
+
+/// @brief Gets the reciprocal of the given power of a value.
+/// @param value Power whose reciprocal is to be found.
+/// @param negative Whether the power's true value is negative. This determines the sign of
+///   the infinity returned when the power underflowed to zero.
+template <typename BT, unsigned int FB>
+constexpr auto pow_reciprocal(fixed<BT, FB> value, bool negative) -> fixed<BT, FB>
+{
+    if (value == 0)
+    {
+        return negative? fixed<BT, FB>::get_negative_infinity(): fixed<BT, FB>::get_positive_infinity();
+    }
+    return fixed<BT, FB>(1) / value;
+}
 
 } // namespace detail
 
@@ -199,25 +1107,70 @@ constexpr auto pow(fixed<BT, FB> value, int n) -> fixed<BT, FB>
     {
         return (n < 0)? fixed<BT, FB>{0}: fixed<BT, FB>::get_positive_infinity();
     }
-    const auto doReciprocal = (n < 0);
-    if (doReciprocal)
+    // Exponentiation by squaring...
+    auto magnitude = (n < 0)? 0u - static_cast<unsigned int>(n): static_cast<unsigned int>(n);
+    auto result = fixed<BT, FB>{1};
+    auto factor = value;
+    for (;;)
     {
-        n = -n;
+        if (magnitude & 1u)
+        {
+            result *= factor;
+            if (!result.isfinite() || (result == 0))
+            {
+                break;
+            }
+        }
+        magnitude >>= 1u;
+        if (!magnitude)
+        {
+            break;
+        }
+        factor *= factor;
+        if (!factor.isfinite())
+        {
+            // Saturated while bits of the exponent remain, so the result would too...
+            result = ((value < 0) && (n % 2 != 0))
+                ? fixed<BT, FB>::get_negative_infinity(): fixed<BT, FB>::get_positive_infinity();
+            break;
+        }
     }
-    auto res = value;
-    for (; n > 1; --n)
+    return (n < 0)? detail::pow_reciprocal(result, (value < 0) && (n % 2 != 0)): result;
+}
+
+/// @brief Computes the value of the given number raised to the given compile-time power.
+/// @details Unrolls into the multiplications of a short addition chain for @c N that
+///   combines the binary and factor methods. For example, <code>pow<15></code> takes
+///   five multiplications as <code>(x^3)^5</code> rather than the six of the binary method.
+///   Negative powers take a single reciprocal of the result for the positive power.
+/// @see https://en.wikipedia.org/wiki/Addition_chain_exponentiation
+template <int N, typename BT, unsigned int FB>
+constexpr auto pow(fixed<BT, FB> value) -> fixed<BT, FB>
+{
+    if constexpr (N < 0)
+    {
+        return detail::pow_reciprocal(detail::unrolled_pow<static_cast<unsigned int>(-N)>(value),
+                                      (value < 0) && (N % 2 != 0));
+    }
+    else
     {
-        res *= value;
+        return detail::unrolled_pow<static_cast<unsigned int>(N)>(value);
     }
-    return doReciprocal? (fixed<BT, FB>(1) / res): res;
 }
 
 /// @brief Truncates the given value.
+/// @note This clears the fraction bits of the value's magnitude.
 /// @see https://en.cppreference.com/w/c/numeric/math/trunc
 template <typename BT, unsigned int FB>
-constexpr auto trunc(fixed<BT, FB> arg) -> fixed<BT, FB>
+constexpr auto trunc(fixed<BT, FB> arg) noexcept -> fixed<BT, FB>
 {
-    return static_cast<fixed<BT, FB>>(static_cast<long long>(arg));
+    if (!arg.isfinite())
+    {
+        return arg;
+    }
+    constexpr auto mask = detail::FractionMask<BT, FB>;
+    const auto value = arg.get_value();
+    return fixed<BT, FB>::from_value(static_cast<BT>((value < 0)? -((-value) & ~mask): (value & ~mask)));
 }
 
 /// @brief Next after function for fixed types.
@@ -237,25 +1190,159 @@ constexpr auto nextafter(fixed<BT, FB> from, fixed<BT, FB> to) noexcept -> fixed
 }
 
 /// @brief Computes the remainder of the division of the given dividend by the given divisor.
+/// @details This is exact. Since both underlying values have the same scale, it's their
+///   integer remainder.
+/// @return Not-a-number if either argument is, if the dividend is infinite, or if the
+///   divisor is zero. Otherwise the remainder having the same sign as the dividend.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/fmod
 template <typename BT, unsigned int FB>
 constexpr auto fmod(fixed<BT, FB> dividend, fixed<BT, FB> divisor) noexcept -> fixed<BT, FB>
 {
-    const auto quotient = dividend / divisor;
-    const auto integer = trunc(quotient);
-    const auto remainder = quotient - integer;
-    return remainder * divisor;
+    if (!dividend.isfinite() || divisor.isnan() || (divisor == 0))
+    {
+        return fixed<BT, FB>::get_nan();
+    }
+    if (!divisor.isfinite())
+    {
+        return dividend;
+    }
+    return fixed<BT, FB>::from_value(static_cast<BT>(dividend.get_value() % divisor.get_value()));
+}
+
+/// @brief Computes the IEEE remainder of the division of the given dividend by the given
+///   divisor.
+/// @details This is exact. It's <code>dividend - n * divisor</code> where <code>n</code> is
+///   the quotient rounded to the nearest integer with halfway cases rounded to even.
+/// @return Not-a-number if either argument is, if the dividend is infinite, or if the
+///   divisor is zero. Otherwise a remainder whose magnitude is no more than half the
+///   divisor's.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/remainder
+template <typename BT, unsigned int FB>
+constexpr auto remainder(fixed<BT, FB> dividend, fixed<BT, FB> divisor) noexcept -> fixed<BT, FB>
+{
+    if (!dividend.isfinite() || divisor.isnan() || (divisor == 0))
+    {
+        return fixed<BT, FB>::get_nan();
+    }
+    if (!divisor.isfinite())
+    {
+        return dividend;
+    }
+    const auto x = dividend.get_value();
+    const auto y = divisor.get_value();
+    const auto magnitude = static_cast<BT>((y < 0)? -y: y);
+    auto result = static_cast<BT>(x % y);
+    const auto rest = static_cast<BT>(magnitude - ((result < 0)? -result: result));
+    if ((result != 0) && ((rest < magnitude - rest) || ((rest == magnitude - rest) && ((x / y) % 2 != 0))))
+    {
+        result = static_cast<BT>((result < 0)? result + magnitude: result - magnitude);
+    }
+    return fixed<BT, FB>::from_value(result);
+}
+
+/// @brief Decomposes the given value into integral and fractional parts.
+/// @param arg Value to decompose.
+/// @param iptr Pointer to where to store the integral part. This is the same as
+///   <code>trunc(arg)</code>.
+/// @return Fractional part having the same sign as the given value, zero for infinities,
+///   or not-a-number for not-a-number.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/modf
+template <typename BT, unsigned int FB>
+constexpr auto modf(fixed<BT, FB> arg, fixed<BT, FB>* iptr) noexcept -> fixed<BT, FB>
+{
+    const auto integral = trunc(arg);
+    *iptr = integral;
+    if (!arg.isfinite())
+    {
+        return arg.isnan()? arg: fixed<BT, FB>{0};
+    }
+    return fixed<BT, FB>::from_value(static_cast<BT>(arg.get_value() - integral.get_value()));
+}
+
+/// @brief Multiplies the given value by two raised to the given power.
+/// @note This is the left shift operator. It's exact unless the result saturates to
+///   infinity or, for negative powers, needs rounding.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/ldexp
+template <typename BT, unsigned int FB>
+constexpr auto ldexp(fixed<BT, FB> arg, int exp) noexcept -> fixed<BT, FB>
+{
+    return arg << exp;
+}
+
+/// @brief Multiplies the given value by the radix raised to the given power.
+/// @note The radix of the fixed types is two so this is the same as @c ldexp.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/scalbn
+template <typename BT, unsigned int FB>
+constexpr auto scalbn(fixed<BT, FB> arg, int exp) noexcept -> fixed<BT, FB>
+{
+    return arg << exp;
+}
+
+/// @brief Decomposes the given value into a normalized fraction and a power of two.
+/// @param arg Value to decompose.
+/// @param exp Pointer to where to store the power of two. This is zero for zero and for
+///   the non-finite values.
+/// @return Fraction whose magnitude is in the range <code>[0.5, 1)</code>, or the given
+///   value for zero and for the non-finite values. The fraction is rounded to nearest
+///   if the given value has more significant bits than the type has fraction bits.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/frexp
+template <typename BT, unsigned int FB>
+constexpr auto frexp(fixed<BT, FB> arg, int* exp) noexcept -> fixed<BT, FB>
+{
+    static_assert(FB > 0u, "fraction needs at least one fraction bit");
+    *exp = 0;
+    if (!arg.isfinite() || (arg == 0))
+    {
+        return arg;
+    }
+    const auto value = arg.get_value();
+    *exp = static_cast<int>(detail::bit_width((value < 0)? -value: value)) - static_cast<int>(FB);
+    auto result = arg >> *exp;
+    if ((result == 1) || (result == -1))
+    {
+        // Rounded up to the next power of two...
+        result >>= 1;
+        ++*exp;
+    }
+    return result;
+}
+
+/// @brief Gets the unbiased exponent of the given value, i.e. the power of two of its
+///   highest set bit.
+/// @return <code>FP_ILOGB0</code> for zero, <code>FP_ILOGBNAN</code> for not-a-number,
+///   or the largest @c int value for infinities.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/ilogb
+template <typename BT, unsigned int FB>
+constexpr auto ilogb(fixed<BT, FB> arg) noexcept -> int
+{
+    if (arg.isnan())
+    {
+        return FP_ILOGBNAN;
+    }
+    if (!arg.isfinite())
+    {
+        return std::numeric_limits<int>::max();
+    }
+    if (arg == 0)
+    {
+        return FP_ILOGB0;
+    }
+    const auto value = arg.get_value();
+    return static_cast<int>(detail::bit_width((value < 0)? -value: value)) - 1 - static_cast<int>(FB);
 }
 
 /// @brief Square root's the given value.
-/// @note This implementation isn't meant to be fast, only correct enough.
+/// @details Finds the integer square root of the underlying value scaled by two to the
+///   power of the fraction bits. Then rounds that up if the remainder is more than the
+///   root. So the result is correctly rounded for every accuracy tier since there's no
+///   polynomial whose terms could be traded for speed.
 /// @note The IEEE standard (presumably IEC 60559), requires <code>std::sqrt</code> to be exact
 ///   to within half of a ULP for floating-point types (float, double). That sets a precedence
 ///   that puts a high expectation on this implementation for fixed-point types.
 /// @note "Domain error" occurs if <code>arg</code> is less than zero.
 /// @return Mathematical square root value of the given value or the <code>NaN</code> value.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/sqrt
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto sqrt(fixed<BT, FB> arg) -> fixed<BT, FB>
 {
     if ((arg == fixed<BT, FB>{1}) || (arg == fixed<BT, FB>{0}))
@@ -264,12 +1351,38 @@ constexpr auto sqrt(fixed<BT, FB> arg) -> fixed<BT, FB>
     }
     if (arg > fixed<BT, FB>{0})
     {
-        return detail::compute_sqrt(arg);
+        if (arg == fixed<BT, FB>::get_positive_infinity())
+        {
+            return arg;
+        }
+        using wider_type = typename detail::wider<BT>::type;
+        const auto scaled = wider_type{arg.get_value()} << FB;
+        const auto root = detail::isqrt(scaled);
+        return fixed<BT, FB>::from_value(static_cast<BT>((scaled - root * root > root)? root + 1: root));
     }
     // else arg < 0 or NaN...
     return fixed<BT, FB>::get_nan();
 }
 
+/// @brief Computes the cube root of the given argument.
+/// @details Finds the integer cube root of the underlying value scaled by two to the
+///   power of twice the fraction bits. So the result is rounded to nearest for every
+///   accuracy tier.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/cbrt
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto cbrt(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (!arg.isfinite() || (arg == 0))
+    {
+        return arg;
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    const auto negative = arg < 0;
+    const auto magnitude = static_cast<wider_type>(negative? -arg.get_value(): arg.get_value());
+    const auto root = detail::icbrt(magnitude, 2u * FB);
+    return fixed<BT, FB>::from_value(static_cast<BT>(negative? -root: root));
+}
+
 /// @brief Gets whether the given value is normal - i.e. not 0 nor infinite.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/isnormal
 template <typename BT, unsigned int FB>
@@ -280,7 +1393,7 @@ constexpr auto isnormal(fixed<BT, FB> arg) -> bool
 
 /// @brief Computes the sine of the argument for fixed types.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/sin
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto sin(fixed<BT, FB> arg) -> fixed<BT, FB>
 {
     if (arg.isnan()) {
@@ -289,23 +1402,12 @@ constexpr auto sin(fixed<BT, FB> arg) -> fixed<BT, FB>
     if (!arg.isfinite()) {
         return fixed<BT, FB>::get_nan();
     }
-    arg = detail::angular_normalize(arg);
-    // detail::sin seems more accurate within -90 to +90, so convert 91 to 89, etc...
-    if (arg > +detail::FixedPi<BT, FB> / 2) {
-        arg = +detail::FixedPi<BT, FB> - arg;
-    }
-    else if (arg < -detail::FixedPi<BT, FB> / 2) {
-        arg = -detail::FixedPi<BT, FB> - arg;
-    }
-    if (arg == fixed<BT, FB>(0)) {
-        return fixed<BT, FB>(0);
-    }
-    return taylor_series::sin<detail::DefaultSinIterations>(arg);
+    return detail::sin<BT, FB, detail::TierBits<Tier, BT, FB>>(detail::quadrant_reduce(arg));
 }
 
 /// @brief Computes the cosine of the argument for fixed types.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/cos
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto cos(fixed<BT, FB> arg) -> fixed<BT, FB>
 {
     if (arg.isnan()) {
@@ -314,17 +1416,59 @@ constexpr auto cos(fixed<BT, FB> arg) -> fixed<BT, FB>
     if (!arg.isfinite()) {
         return fixed<BT, FB>::get_nan();
     }
-    if (arg == fixed<BT, FB>(0)) {
-        return fixed<BT, FB>(1);
+    // cos(x) is sin(x + pi/2), so shift the angle by one quadrant...
+    auto reduced = detail::quadrant_reduce(arg);
+    reduced.quadrant = (reduced.quadrant + 1u) % 4u;
+    return detail::sin<BT, FB, detail::TierBits<Tier, BT, FB>>(reduced);
+}
+
+/// @brief Computes the tangent of the argument for fixed types.
+/// @details Divides the sine and cosine polynomials of the reduced angle, which are both
+///   evaluated with all of the working bits, and rounds that just once. The error of the
+///   quotient grows with the square of the result, so the polynomials are accurate to
+///   twelve more bits than the accuracy tier's. That keeps the tier's error bound for
+///   results up to 64 in magnitude.
+/// @note Types having fewer than twelve working bits beyond their fraction bits, like
+///   <code>fixed<std::int64_t, 56></code>, can't get those extra bits. Their errors grow
+///   to a few ulps for results more than about four in magnitude.
+/// @note Results within an ulp or so of the poles at the odd multiples of <code>pi / 2</code>
+///   are accurate relative to their magnitude instead of to within an ulp.
+/// @return Value that saturates to the infinities near the poles.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/tan
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto tan(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (!arg.isfinite())
+    {
+        return fixed<BT, FB>::get_nan();
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    constexpr auto q = detail::WorkingBits<BT, FB>;
+    constexpr auto bits = std::min(detail::TierBits<Tier, BT, FB> + 12u, q);
+    const auto reduced = detail::quadrant_reduce_to<q>(arg);
+    const auto s = detail::sin_scaled<BT, FB, bits>(reduced.r, false);
+    const auto c = detail::sin_scaled<BT, FB, bits>(reduced.r, true);
+    // tan(r + pi/2) is -cos(r) / sin(r), and tan has a period of pi...
+    const auto odd = (reduced.quadrant % 2u) != 0u;
+    auto numerator = (odd? -c: s) * (wider_type{1} << FB);
+    auto divisor = odd? s: c;
+    if (divisor == 0)
+    {
+        return (numerator < 0)? fixed<BT, FB>::get_negative_infinity(): fixed<BT, FB>::get_positive_infinity();
+    }
+    if (divisor < 0)
+    {
+        numerator = -numerator;
+        divisor = -divisor;
     }
-    // Use sin function with angle shifted by 1/2 pi...
-    return sin(arg + detail::FixedPi<BT, FB> / 2);
+    const auto offset = ((numerator < 0)? -divisor: divisor) / 2;
+    return detail::saturate<BT, FB>((numerator + offset) / divisor);
 }
 
 /// @brief Computes the arc tangent.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/atan
 /// @return Value between <code>-Pi / 2</code> and <code>Pi / 2</code>.
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto atan(fixed<BT, FB> arg) -> fixed<BT, FB>
 {
     if (arg.isnan() || (arg == 0))
@@ -333,65 +1477,283 @@ constexpr auto atan(fixed<BT, FB> arg) -> fixed<BT, FB>
     }
     if (arg == fixed<BT, FB>::get_positive_infinity())
     {
-        return detail::FixedPi<BT, FB> / 2;
+        return detail::FixedPi<BT, FB> >> 1;
     }
     if (arg == fixed<BT, FB>::get_negative_infinity())
     {
-        return -detail::FixedPi<BT, FB> / 2;
+        return -(detail::FixedPi<BT, FB> >> 1);
     }
-    return taylor_series::atan<detail::DefaultAtanIterations>(arg);
+    const auto negative = arg < 0;
+    const auto magnitude = static_cast<typename detail::wider<BT>::type>(negative? -arg.get_value(): arg.get_value());
+    constexpr auto q = detail::WorkingBits<BT, FB>;
+    constexpr auto bits = detail::TierBits<Tier, BT, FB>;
+    const auto result = detail::round_shift(detail::atan_scaled<BT, FB, bits>(magnitude << (q - FB)), q - FB);
+    return fixed<BT, FB>::from_value(static_cast<BT>(negative? -result: result));
 }
 
 /// @brief Computes the multi-valued inverse tangent.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/atan2
 /// @return Value between <code>-Pi</code> and <code>+Pi</code> inclusive.
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto atan2(fixed<BT, FB> y, fixed<BT, FB> x) -> fixed<BT, FB>
 {
     // See https://en.wikipedia.org/wiki/Atan2
     // See https://en.wikipedia.org/wiki/Taylor_series
     if (x > 0)
     {
-        return atan(y / x);
+        return atan<Tier>(y / x);
     }
     if (x < 0)
     {
-        return atan(y / x) + ((y >= 0)? +1: -1) * detail::FixedPi<BT, FB>;
+        return atan<Tier>(y / x) + ((y >= 0)? +1: -1) * detail::FixedPi<BT, FB>;
     }
     if (y > 0)
     {
-        return +detail::FixedPi<BT, FB> / 2;
+        return +(detail::FixedPi<BT, FB> >> 1);
     }
     if (y < 0)
     {
-        return -detail::FixedPi<BT, FB> / 2;
+        return -(detail::FixedPi<BT, FB> >> 1);
     }
     return fixed<BT, FB>::get_nan();
 }
 
+/// @brief Computes the principal value of the arc sine of the given argument.
+/// @return Value between <code>-Pi / 2</code> and <code>Pi / 2</code> inclusive, or
+///   the <code>NaN</code> value for arguments outside of <code>[-1, +1]</code>.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/asin
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto asin(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (arg.isnan() || (arg < fixed<BT, FB>{-1}) || (arg > fixed<BT, FB>{1}))
+    {
+        return fixed<BT, FB>::get_nan();
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    constexpr auto q = detail::WorkingBits<BT, FB>;
+    const auto negative = arg < 0;
+    const auto magnitude = static_cast<wider_type>(negative? -arg.get_value(): arg.get_value());
+    constexpr auto bits = detail::TierBits<Tier, BT, FB>;
+    const auto result = detail::round_shift(detail::asin_scaled<BT, FB, bits>(magnitude << (q - FB)), q - FB);
+    return fixed<BT, FB>::from_value(static_cast<BT>(negative? -result: result));
+}
+
+/// @brief Computes the principal value of the arc cosine of the given argument.
+/// @details This is <code>pi / 2 - asin(arg)</code> in internal form, so it stays accurate
+///   for arguments near one.
+/// @return Value between <code>0</code> and <code>Pi</code> inclusive, or the
+///   <code>NaN</code> value for arguments outside of <code>[-1, +1]</code>.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/acos
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto acos(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (arg.isnan() || (arg < fixed<BT, FB>{-1}) || (arg > fixed<BT, FB>{1}))
+    {
+        return fixed<BT, FB>::get_nan();
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    constexpr auto q = detail::WorkingBits<BT, FB>;
+    constexpr auto half_pi = detail::scaled_constant<wider_type>(detail::HalfPiBits, q);
+    const auto negative = arg < 0;
+    const auto magnitude = static_cast<wider_type>(negative? -arg.get_value(): arg.get_value());
+    const auto angle = detail::asin_scaled<BT, FB, detail::TierBits<Tier, BT, FB>>(magnitude << (q - FB));
+    const auto result = detail::round_shift(negative? half_pi + angle: half_pi - angle, q - FB);
+    return fixed<BT, FB>::from_value(static_cast<BT>(result));
+}
+
 /// @brief Computes the natural logarithm of the given argument.
+/// @note This has a small fixed cost that's independent of the argument's magnitude.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/log
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto log(fixed<BT, FB> arg) -> fixed<BT, FB>
 {
-    return (arg < detail::LogMaxForLowerIterations)
-        ? detail::log<detail::LogIterationsForSmaller>(arg)
-        : detail::log<detail::LogIterationsForLarger>(arg);
+    constexpr auto scale = detail::log_scale<BT, FB>(detail::OneBits);
+    return detail::log<BT, FB, detail::TierBits<Tier, BT, FB>>(arg, scale);
+}
+
+/// @brief Computes the binary (base-2) logarithm of the given argument.
+/// @note Exact for powers of two.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/log2
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto log2(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    constexpr auto scale = detail::log_scale<BT, FB>(detail::Log2EBits);
+    return detail::log<BT, FB, detail::TierBits<Tier, BT, FB>>(arg, scale);
+}
+
+/// @brief Computes the common (base-10) logarithm of the given argument.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/log10
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto log10(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    constexpr auto scale = detail::log_scale<BT, FB>(detail::Log10EBits);
+    return detail::log<BT, FB, detail::TierBits<Tier, BT, FB>>(arg, scale);
 }
 
 /// @brief Computes the Euler number raised to the power of the given argument.
+/// @details Splits the argument into <code>k ln(2) + r</code>, evaluates a short
+///   polynomial for <code>e^r</code>, and applies <code>2^k</code> as a shift.
+/// @return Value that saturates to positive infinity or to zero.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/exp
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto exp(fixed<BT, FB> arg) -> fixed<BT, FB>
 {
-    return (abs(arg) <= detail::ExpMaxForLowerIterations)
-        ? taylor_series::exp<detail::DefaultExpIterations>(arg)
-        : taylor_series::exp<detail::ExpIterationsForLarger>(arg);
+    if (arg.isnan())
+    {
+        return arg;
+    }
+    if (arg == fixed<BT, FB>::get_positive_infinity())
+    {
+        return fixed<BT, FB>::get_positive_infinity();
+    }
+    if (arg == fixed<BT, FB>::get_negative_infinity())
+    {
+        return fixed<BT, FB>{0};
+    }
+    constexpr auto bits = detail::ExpTierBits<Tier, BT, FB>;
+    const auto reduced = detail::exp_reduce(arg);
+    return detail::exp_finish<BT, FB>(detail::exp_scaled<BT, FB, bits>(reduced.r), reduced.k);
+}
+
+/// @brief Computes two raised to the power of the given argument.
+/// @note Exact for integral arguments within range.
+/// @return Value that saturates to positive infinity or to zero.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/exp2
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto exp2(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (arg.isnan())
+    {
+        return arg;
+    }
+    if (arg == fixed<BT, FB>::get_positive_infinity())
+    {
+        return fixed<BT, FB>::get_positive_infinity();
+    }
+    if (arg == fixed<BT, FB>::get_negative_infinity())
+    {
+        return fixed<BT, FB>{0};
+    }
+    constexpr auto bits = detail::ExpTierBits<Tier, BT, FB>;
+    const auto reduced = detail::exp2_reduce(arg);
+    return detail::exp_finish<BT, FB>(detail::exp_scaled<BT, FB, bits>(reduced.r), reduced.k);
+}
+
+/// @brief Computes the Euler number raised to the power of the given argument, minus one.
+/// @details This is more accurate than <code>exp(arg) - 1</code> for arguments near zero
+///   since the subtraction happens before rounding to the fixed type.
+/// @return Value that saturates to positive infinity or to minus one.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/expm1
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto expm1(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (arg.isnan())
+    {
+        return arg;
+    }
+    if (arg == fixed<BT, FB>::get_positive_infinity())
+    {
+        return fixed<BT, FB>::get_positive_infinity();
+    }
+    if (arg == fixed<BT, FB>::get_negative_infinity())
+    {
+        return fixed<BT, FB>{-1};
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    constexpr auto q = detail::ExpBits<BT, FB>;
+    const auto reduced = detail::exp_reduce(arg);
+    const auto value = detail::exp_scaled<BT, FB, detail::ExpTierBits<Tier, BT, FB>>(reduced.r);
+    if ((reduced.k > 1) || (reduced.k < -static_cast<int>(q)))
+    {
+        return detail::exp_finish<BT, FB>(value, reduced.k) - fixed<BT, FB>{1};
+    }
+    const auto scaled = (reduced.k < 0)? (value >> -reduced.k): (value << reduced.k);
+    const auto result = detail::round_shift(scaled - (wider_type{1} << q), q - FB);
+    return fixed<BT, FB>::from_value(static_cast<BT>(result));
+}
+
+/// @brief Computes the natural logarithm of one plus the given argument.
+/// @details Unlike for floating point types, adding one to a fixed type's value is exact
+///   unless that overflows. So this is the logarithm of that sum and is just as accurate
+///   for arguments near zero.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/log1p
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto log1p(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (arg.isnan() || (arg < fixed<BT, FB>{-1}))
+    {
+        return fixed<BT, FB>::get_nan();
+    }
+    if (arg == fixed<BT, FB>::get_positive_infinity())
+    {
+        return arg;
+    }
+    if (arg > fixed<BT, FB>::get_max() - fixed<BT, FB>{1})
+    {
+        // Adds ln(2) to the logarithm of (arg + 1) / 2 since arg + 1 overflows. With many
+        // fraction bits, the logarithms of arg and arg + 1 are many ulps apart...
+        using wider_type = typename detail::wider<BT>::type;
+        constexpr auto q = detail::WorkingBits<BT, FB>;
+        constexpr auto ln2 = detail::scaled_constant<wider_type>(detail::Ln2Bits, q);
+        const auto half = (arg >> 1) + fixed<BT, FB>{0.5};
+        const auto result = detail::log_scaled<BT, FB, detail::TierBits<Tier, BT, FB>>(half.get_value()) + ln2;
+        return fixed<BT, FB>::from_value(static_cast<BT>(detail::round_shift(result, q - FB)));
+    }
+    return log<Tier>(arg + fixed<BT, FB>{1});
+}
+
+/// @brief Computes the hyperbolic sine of the given argument.
+/// @return Value that saturates to the infinities.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/sinh
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto sinh(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (!arg.isfinite())
+    {
+        return arg;
+    }
+    constexpr auto bits = detail::ExpTierBits<Tier, BT, FB>;
+    return (arg < 0)? -detail::sinh_cosh<BT, FB, bits>(-arg, false): detail::sinh_cosh<BT, FB, bits>(arg, false);
+}
+
+/// @brief Computes the hyperbolic cosine of the given argument.
+/// @return Value that saturates to positive infinity.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/cosh
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto cosh(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (arg.isnan())
+    {
+        return arg;
+    }
+    if (!arg.isfinite())
+    {
+        return fixed<BT, FB>::get_positive_infinity();
+    }
+    return detail::sinh_cosh<BT, FB, detail::ExpTierBits<Tier, BT, FB>>((arg < 0)? -arg: arg, true);
+}
+
+/// @brief Computes the hyperbolic tangent of the given argument.
+/// @return Value between <code>-1</code> and <code>+1</code> inclusive.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/tanh
+template <typename Tier = precise, typename BT, unsigned int FB>
+constexpr auto tanh(fixed<BT, FB> arg) -> fixed<BT, FB>
+{
+    if (arg.isnan())
+    {
+        return arg;
+    }
+    if (!arg.isfinite())
+    {
+        return fixed<BT, FB>{(arg < 0)? -1: +1};
+    }
+    constexpr auto bits = detail::TierBits<Tier, BT, FB> + 2u;
+    return (arg < 0)? -detail::tanh<BT, FB, bits>(-arg): detail::tanh<BT, FB, bits>(arg);
 }
 
 /// @brief Computes the value of the base number raised to the power of the exponent.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/pow
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto pow(fixed<BT, FB> base, fixed<BT, FB> exponent) -> fixed<BT, FB>
 {
     if (exponent.isfinite())
@@ -407,25 +1769,71 @@ constexpr auto pow(fixed<BT, FB> base, fixed<BT, FB> exponent) -> fixed<BT, FB>
     {
         return fixed<BT, FB>::get_nan();
     }
-    return exp(log(base) * exponent);
+    return exp<Tier>(log<Tier>(base) * exponent);
 }
 
 /// @brief Computes the square root of the sum of the squares.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/hypot
-template <typename BT, unsigned int FB>
+template <typename Tier = precise, typename BT, unsigned int FB>
 constexpr auto hypot(fixed<BT, FB> x, fixed<BT, FB> y) -> fixed<BT, FB>
 {
-    return sqrt(x * x + y * y);
+    return sqrt<Tier>(x * x + y * y);
+}
+
+/// @brief Computes <code>x * y + z</code> with a single rounding.
+/// @details The product and sum are exact in the wider type so only the result is rounded.
+/// @return Value that saturates to the infinities if out of the finite range.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/fma
+template <typename BT, unsigned int FB>
+constexpr auto fma(fixed<BT, FB> x, fixed<BT, FB> y, fixed<BT, FB> z) noexcept -> fixed<BT, FB>
+{
+    if (!x.isfinite() || !y.isfinite() || !z.isfinite())
+    {
+        return x * y + z;
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    const auto sum = wider_type{x.get_value()} * y.get_value() // newline!
+        + wider_type{z.get_value()} * (wider_type{1} << FB);
+    return detail::saturate<BT, FB>((sum < 0)? -detail::round_shift(-sum, FB): detail::round_shift(sum, FB));
 }
 
-/// @brief Rounds the given value.
+/// @brief Rounds the given value to the nearest integer with halfway cases rounded away
+///   from zero.
+/// @return Rounded value that saturates to infinity if not representable.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/round
 template <typename BT, unsigned int FB>
 constexpr auto round(fixed<BT, FB> value) noexcept -> fixed<BT, FB>
 {
-    const auto tmp = value + (fixed<BT, FB>{1} / fixed<BT, FB>{2});
-    const auto truncated = static_cast<typename fixed<BT, FB>::value_type>(tmp);
-    return fixed<BT, FB>{truncated, 0};
+    if (!value.isfinite())
+    {
+        return value;
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    constexpr auto mask = wider_type{detail::FractionMask<BT, FB>};
+    constexpr auto half = (mask + 1) / 2;
+    const auto v = wider_type{value.get_value()};
+    return detail::saturate<BT, FB>((v < 0)? -((half - v) & ~mask): ((v + half) & ~mask));
+}
+
+/// @brief Rounds the given value to the nearest integer with halfway cases rounded to even.
+/// @note This is the rounding of the default floating-point environment which fixed types
+///   don't otherwise have.
+/// @return Rounded value that saturates to infinity if not representable.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/nearbyint
+template <typename BT, unsigned int FB>
+constexpr auto nearbyint(fixed<BT, FB> value) noexcept -> fixed<BT, FB>
+{
+    if (!value.isfinite() || (FB == 0u))
+    {
+        return value;
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    constexpr auto mask = wider_type{detail::FractionMask<BT, FB>};
+    constexpr auto half = (mask + 1) / 2;
+    const auto v = wider_type{value.get_value()};
+    // Rounds down exact halves whose floor is even...
+    const auto odd = (v >> FB) & 1;
+    return detail::saturate<BT, FB>((v + half - 1 + odd) & ~mask);
 }
 
 /// @brief Determines whether the given value is negative.
@@ -463,12 +1871,34 @@ constexpr auto isinf(const fixed<BT, FB>& value) noexcept -> bool
 }
 
 /// @brief Gets the largest integer value not greater than the given value.
+/// @note This clears the fraction bits of the value's two's complement representation.
+/// @return Integer value that saturates to negative infinity if not representable.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/floor.
 template <typename BT, unsigned int FB>
-constexpr auto floor(const fixed<BT, FB>& value) -> fixed<BT, FB>
+constexpr auto floor(fixed<BT, FB> value) noexcept -> fixed<BT, FB>
 {
-    const auto tmp = trunc(value);
-    return (tmp > value)? (value - 1): tmp;
+    if (!value.isfinite())
+    {
+        return value;
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    constexpr auto mask = wider_type{detail::FractionMask<BT, FB>};
+    return detail::saturate<BT, FB>(wider_type{value.get_value()} & ~mask);
+}
+
+/// @brief Gets the smallest integer value not less than the given value.
+/// @return Integer value that saturates to positive infinity if not representable.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/ceil.
+template <typename BT, unsigned int FB>
+constexpr auto ceil(fixed<BT, FB> value) noexcept -> fixed<BT, FB>
+{
+    if (!value.isfinite())
+    {
+        return value;
+    }
+    using wider_type = typename detail::wider<BT>::type;
+    constexpr auto mask = wider_type{detail::FractionMask<BT, FB>};
+    return detail::saturate<BT, FB>((wider_type{value.get_value()} + mask) & ~mask);
 }
 
 /// @see https://en.cppreference.com/w/cpp/numeric/math/fpclassify.
@@ -0,0 +1,587 @@
+#ifndef REALNUMB_FIXED_SIMD_HPP
+#define REALNUMB_FIXED_SIMD_HPP
+
+/// @file
+/// @brief SIMD lane types of the fixed and fractional types.
+/// @details These hold a fixed number of values of a fixed or fractional type and do their
+///   arithmetic and comparisons lane-wise. Their operations are written as loops over the lanes' internal
+///   values without branches, so the compiler can turn them into vector instructions. Their
+///   results are the same as those of the fixed type's operations on each lane.
+/// @see https://en.cppreference.com/w/cpp/experimental/simd
+
+#include <array> // for std::array
+#include <cstddef> // for std::size_t
+#include <limits> // for std::numeric_limits
+#include <type_traits> // for std::enable_if_t, std::is_arithmetic_v, std::decay_t, std::make_unsigned_t
+
+#include <realnumb/fixed.hpp>
+#include <realnumb/fractional.hpp>
+
+namespace realnumb {
+
+/// @brief Mask of the lanes of a <code>fixed_simd</code>.
+/// @see fixed_simd.
+template <std::size_t N>
+class fixed_simd_mask
+{
+public:
+    /// @brief Value type.
+    using value_type = bool;
+
+    /// @brief Gets the number of lanes.
+    static constexpr auto size() noexcept -> std::size_t
+    {
+        return N;
+    }
+
+    fixed_simd_mask() = default;
+
+    /// @brief Broadcasting constructor.
+    constexpr explicit fixed_simd_mask(bool value) noexcept
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_lanes[i] = value;
+        }
+    }
+
+    /// @brief Gets the given lane.
+    constexpr auto operator[](std::size_t i) const noexcept -> bool
+    {
+        return m_lanes[i];
+    }
+
+    /// @brief Gets the given lane.
+    constexpr auto operator[](std::size_t i) noexcept -> bool&
+    {
+        return m_lanes[i];
+    }
+
+    /// @brief Logical not operator.
+    constexpr auto operator!() const noexcept -> fixed_simd_mask
+    {
+        auto result = fixed_simd_mask{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            result.m_lanes[i] = !m_lanes[i];
+        }
+        return result;
+    }
+
+    /// @brief Logical and operator.
+    friend constexpr auto operator&&(const fixed_simd_mask& lhs, const fixed_simd_mask& rhs) noexcept
+        -> fixed_simd_mask
+    {
+        auto result = fixed_simd_mask{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            result.m_lanes[i] = lhs.m_lanes[i] & rhs.m_lanes[i];
+        }
+        return result;
+    }
+
+    /// @brief Logical or operator.
+    friend constexpr auto operator||(const fixed_simd_mask& lhs, const fixed_simd_mask& rhs) noexcept
+        -> fixed_simd_mask
+    {
+        auto result = fixed_simd_mask{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            result.m_lanes[i] = lhs.m_lanes[i] | rhs.m_lanes[i];
+        }
+        return result;
+    }
+
+private:
+    std::array<bool, N> m_lanes; ///< Lanes.
+};
+
+/// @brief Checks whether all of the given mask's lanes are set.
+template <std::size_t N>
+constexpr auto all_of(const fixed_simd_mask<N>& mask) noexcept -> bool
+{
+    auto result = true;
+    for (auto i = std::size_t{0}; i < N; ++i)
+    {
+        result = result & mask[i];
+    }
+    return result;
+}
+
+/// @brief Checks whether any of the given mask's lanes are set.
+template <std::size_t N>
+constexpr auto any_of(const fixed_simd_mask<N>& mask) noexcept -> bool
+{
+    auto result = false;
+    for (auto i = std::size_t{0}; i < N; ++i)
+    {
+        result = result | mask[i];
+    }
+    return result;
+}
+
+/// @brief Checks whether none of the given mask's lanes are set.
+template <std::size_t N>
+constexpr auto none_of(const fixed_simd_mask<N>& mask) noexcept -> bool
+{
+    return !any_of(mask);
+}
+
+namespace detail {
+
+/// @brief Blends the given values by the given condition without branching.
+/// @return The first value if the condition holds, or the second value otherwise.
+template <typename R>
+constexpr auto blend(bool condition, R a, R b) noexcept -> R
+{
+    const auto bits = static_cast<R>(-static_cast<R>(condition));
+    return static_cast<R>(b ^ ((a ^ b) & bits));
+}
+
+/// @brief Lane-wise operations on the internal values of the given type for
+///   <code>fixed_simd</code>.
+/// @details Specializations provide <code>ordered</code>, <code>negate</code>, <code>add</code>,
+///   <code>subtract</code> and <code>multiply</code> functions that match the type's own operations, written
+///   without branches.
+/// @see fixed_simd.
+template <class T>
+struct lane_operations;
+
+/// @brief Lane-wise operations on the internal values of fixed types.
+template <typename BT, unsigned int FB>
+struct lane_operations<fixed<BT, FB>>
+{
+    /// @brief Fixed type.
+    using T = fixed<BT, FB>;
+
+    /// @brief Internal value type.
+    using raw_type = BT;
+
+    /// @brief Widened type alias.
+    using wider_type = typename wider<raw_type>::type;
+
+    /// @brief Unsigned type alias.
+    using unsigned_type = std::make_unsigned_t<raw_type>;
+
+    static constexpr auto nan = T::get_nan().get_value(); ///< NaN in internal form.
+    static constexpr auto pinf = T::get_positive_infinity().get_value(); ///< +inf in internal form.
+    static constexpr auto ninf = T::get_negative_infinity().get_value(); ///< -inf in internal form.
+    static constexpr auto max = T::get_max().get_value(); ///< Max in internal form.
+    static constexpr auto lowest = T::get_lowest().get_value(); ///< Lowest in internal form.
+
+    /// @brief Checks whether neither of the given values is NaN.
+    static constexpr auto ordered(raw_type a, raw_type b) noexcept -> bool
+    {
+        return (a != nan) & (b != nan);
+    }
+
+    /// @brief Checks whether the given internal value is of a finite value.
+    static constexpr auto isfinite(raw_type value) noexcept -> bool
+    {
+        return (value > ninf) & (value < pinf);
+    }
+
+    /// @brief Saturates the given wide value to the finite range, or the infinities beyond.
+    static constexpr auto saturate(wider_type value) noexcept -> raw_type
+    {
+        const auto result = blend(value > max, pinf, static_cast<raw_type>(value));
+        return blend(value < lowest, ninf, result);
+    }
+
+    /// @brief Gets the result of an operation on the given values when either is not finite.
+    /// @param infinite Result if neither is NaN and the result isn't otherwise invalid.
+    static constexpr auto special(raw_type a, raw_type b, bool invalid, raw_type infinite) noexcept
+        -> raw_type
+    {
+        return blend(invalid | (a == nan) | (b == nan), nan, infinite);
+    }
+
+    /// @brief Adds the given values in internal form like the fixed type's addition.
+    static constexpr auto add(raw_type a, raw_type b) noexcept -> raw_type
+    {
+        // Sums in the lanes' own width, detecting overflow from the signs, so that twice as
+        // many lanes fit a vector as would in the widened type. Like a saturating add
+        // (paddsw), overflows go to the limit of the first value's sign. That's +inf, or NaN
+        // which then goes to -inf like the sums below the lowest value do.
+        const auto wrapped = static_cast<raw_type>(static_cast<unsigned_type>(a) + static_cast<unsigned_type>(b));
+        const auto overflow = ((a ^ wrapped) & (b ^ wrapped)) < 0;
+        const auto sum = blend(overflow, blend(a < 0, nan, pinf), wrapped);
+        const auto saturated = blend(sum < ninf, ninf, sum);
+        const auto opposites = ((a == pinf) & (b == ninf)) | ((a == ninf) & (b == pinf));
+        const auto infinite = blend((a == pinf) | (b == pinf), pinf, ninf);
+        return blend(isfinite(a) & isfinite(b), saturated, special(a, b, opposites, infinite));
+    }
+
+    /// @brief Subtracts the given values in internal form like the fixed type's subtraction.
+    static constexpr auto subtract(raw_type a, raw_type b) noexcept -> raw_type
+    {
+        return add(a, negate(b));
+    }
+
+    /// @brief Shifts the given product right by the fraction bits, rounding half away from
+    ///   zero like the fixed type's multiplication.
+    /// @details This is like what the <code>pmulhrsw</code> instruction does for 15 fraction
+    ///   bits. Rather than dividing, which vectors can't do, this subtracts one from
+    ///   negative products before adding the half. That rounds their halves downwards.
+    static constexpr auto round_shift(wider_type product) noexcept -> wider_type
+    {
+        if constexpr (FB == 0u)
+        {
+            return product;
+        }
+        else
+        {
+            constexpr auto half = wider_type{1} << (FB - 1u);
+            return static_cast<wider_type>((product + half - wider_type{product < 0}) >> FB);
+        }
+    }
+
+    /// @brief Negates the given value in internal form like the fixed type's negation.
+    static constexpr auto negate(raw_type v) noexcept -> raw_type
+    {
+        return blend(v == nan, v, static_cast<raw_type>(-v));
+    }
+
+    /// @brief Multiplies the given values in internal form like the fixed type's
+    ///   multiplication.
+    static constexpr auto multiply(raw_type a, raw_type b) noexcept -> raw_type
+    {
+        const auto product = static_cast<wider_type>(wider_type{a} * wider_type{b});
+        const auto finite = saturate(round_shift(product));
+        const auto zero = (a == 0) | (b == 0);
+        const auto infinite = blend((a > 0) != (b > 0), ninf, pinf);
+        return blend(isfinite(a) & isfinite(b), finite, special(a, b, zero, infinite));
+    }
+};
+
+/// @brief Lane-wise operations on the internal values of fractional types.
+/// @details These saturate like the <code>paddsw</code> and <code>pmulhrsw</code>
+///   instructions do but for the latter's overflowing product of minus one with itself.
+template <typename BT>
+struct lane_operations<fractional<BT>>
+{
+    /// @brief Internal value type.
+    using raw_type = BT;
+
+    /// @brief Widened type alias.
+    using wider_type = typename wider<raw_type>::type;
+
+    /// @brief Unsigned type alias.
+    using unsigned_type = std::make_unsigned_t<raw_type>;
+
+    static constexpr auto max = std::numeric_limits<raw_type>::max(); ///< Max in internal form.
+    static constexpr auto lowest = std::numeric_limits<raw_type>::lowest(); ///< Lowest in internal form.
+
+    /// @brief Checks whether the given values are ordered, which they always are.
+    static constexpr auto ordered(raw_type, raw_type) noexcept -> bool
+    {
+        return true;
+    }
+
+    /// @brief Negates the given value in internal form, saturating like the fractional
+    ///   type's negation.
+    static constexpr auto negate(raw_type v) noexcept -> raw_type
+    {
+        return blend(v == lowest, max, static_cast<raw_type>(-v));
+    }
+
+    /// @brief Adds the given values in internal form, saturating like the fractional type's
+    ///   addition.
+    static constexpr auto add(raw_type a, raw_type b) noexcept -> raw_type
+    {
+        const auto wrapped = static_cast<raw_type>(static_cast<unsigned_type>(a) + static_cast<unsigned_type>(b));
+        const auto overflow = ((a ^ wrapped) & (b ^ wrapped)) < 0;
+        return blend(overflow, blend(a < 0, lowest, max), wrapped);
+    }
+
+    /// @brief Subtracts the given values in internal form, saturating like the fractional
+    ///   type's subtraction.
+    static constexpr auto subtract(raw_type a, raw_type b) noexcept -> raw_type
+    {
+        const auto wrapped = static_cast<raw_type>(static_cast<unsigned_type>(a) - static_cast<unsigned_type>(b));
+        const auto overflow = ((a ^ b) & (a ^ wrapped)) < 0;
+        return blend(overflow, blend(a < 0, lowest, max), wrapped);
+    }
+
+    /// @brief Multiplies the given values in internal form like the fractional type's
+    ///   saturating rounding doubling multiply-high.
+    static constexpr auto multiply(raw_type a, raw_type b) noexcept -> raw_type
+    {
+        constexpr auto half = wider_type{1} << (fractional<BT>::fraction_bits - 1u);
+        const auto product = static_cast<wider_type>(wider_type{a} * wider_type{b});
+        const auto result = static_cast<wider_type>((product + half) >> fractional<BT>::fraction_bits);
+        // Selecting in the wider type vectorizes better than blending narrowed values.
+        return static_cast<raw_type>((result > max)? wider_type{max}: result);
+    }
+};
+
+} // namespace detail
+
+/// @brief SIMD lane type of a fixed or fractional type.
+/// @details This is a value type of @c N values of the fixed or fractional type @c T, like
+///   <code>std::experimental::simd</code> is of the arithmetic types. Its arithmetic and
+///   comparison operators apply lane-wise, with the type's saturation and special
+///   values. Comparisons result in a <code>fixed_simd_mask</code>, from which
+///   <code>select</code> blends two values.
+/// @tparam T Fixed or fractional type.
+/// @tparam N Number of lanes.
+/// @see fixed_simd_mask.
+template <class T, std::size_t N>
+class fixed_simd
+{
+public:
+    /// @brief Value type.
+    using value_type = T;
+
+    /// @brief Internal value type of the value type.
+    using raw_type = decltype(T{}.get_value());
+
+    /// @brief Mask type.
+    using mask_type = fixed_simd_mask<N>;
+
+    /// @brief Internal values type.
+    using values_type = std::array<raw_type, N>;
+
+    /// @brief Gets the number of lanes.
+    static constexpr auto size() noexcept -> std::size_t
+    {
+        return N;
+    }
+
+    fixed_simd() = default;
+
+    /// @brief Broadcasting constructor.
+    constexpr fixed_simd(value_type value) noexcept
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_values[i] = value.get_value();
+        }
+    }
+
+    /// @brief Broadcasting constructor from any arithmetic type.
+    template <class U, std::enable_if_t<std::is_arithmetic_v<std::decay_t<U>>, int> = 0>
+    constexpr fixed_simd(U value) noexcept: fixed_simd(value_type(value))
+    {
+        // Intentionally empty.
+    }
+
+    /// @brief Initializing constructor.
+    constexpr explicit fixed_simd(const std::array<value_type, N>& values) noexcept
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_values[i] = values[i].get_value();
+        }
+    }
+
+    /// @brief Gets the value of the given lane.
+    constexpr auto operator[](std::size_t i) const noexcept -> value_type
+    {
+        return value_type::from_value(m_values[i]);
+    }
+
+    /// @brief Gets the lanes' values in their internal form.
+    /// @see from_values.
+    constexpr auto get_values() const noexcept -> const values_type&
+    {
+        return m_values;
+    }
+
+    /// @brief Gets the lanes for the given values in internal form.
+    /// @note This is the inverse of <code>get_values</code>.
+    /// @see get_values.
+    static constexpr auto from_values(const values_type& values) noexcept -> fixed_simd
+    {
+        auto result = fixed_simd{};
+        result.m_values = values;
+        return result;
+    }
+
+    /// @brief Loads the lanes from the given values.
+    static auto load(const value_type* values) noexcept -> fixed_simd
+    {
+        auto result = fixed_simd{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            result.m_values[i] = values[i].get_value();
+        }
+        return result;
+    }
+
+    /// @brief Stores the lanes to the given values.
+    void store(value_type* values) const noexcept
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            values[i] = value_type::from_value(m_values[i]);
+        }
+    }
+
+    /// @brief Negation operator.
+    constexpr auto operator-() const noexcept -> fixed_simd
+    {
+        auto result = fixed_simd{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            result.m_values[i] = operations::negate(m_values[i]);
+        }
+        return result;
+    }
+
+    /// @brief Positive operator.
+    constexpr auto operator+() const noexcept -> fixed_simd
+    {
+        return *this;
+    }
+
+    /// @brief Addition assignment operator.
+    constexpr auto operator+=(const fixed_simd& val) noexcept -> fixed_simd&
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_values[i] = operations::add(m_values[i], val.m_values[i]);
+        }
+        return *this;
+    }
+
+    /// @brief Subtraction assignment operator.
+    constexpr auto operator-=(const fixed_simd& val) noexcept -> fixed_simd&
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_values[i] = operations::subtract(m_values[i], val.m_values[i]);
+        }
+        return *this;
+    }
+
+    /// @brief Multiplication assignment operator.
+    constexpr auto operator*=(const fixed_simd& val) noexcept -> fixed_simd&
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_values[i] = operations::multiply(m_values[i], val.m_values[i]);
+        }
+        return *this;
+    }
+
+    /// @brief Division assignment operator.
+    /// @note There are no integer division instructions for vectors. So this divides each
+    ///   lane in turn using the fixed type's division.
+    constexpr auto operator/=(const fixed_simd& val) noexcept -> fixed_simd&
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_values[i] = (value_type::from_value(m_values[i]) / value_type::from_value(val.m_values[i])).get_value();
+        }
+        return *this;
+    }
+
+    /// @brief Addition operator.
+    friend constexpr auto operator+(fixed_simd lhs, const fixed_simd& rhs) noexcept -> fixed_simd
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    /// @brief Subtraction operator.
+    friend constexpr auto operator-(fixed_simd lhs, const fixed_simd& rhs) noexcept -> fixed_simd
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    /// @brief Multiplication operator.
+    friend constexpr auto operator*(fixed_simd lhs, const fixed_simd& rhs) noexcept -> fixed_simd
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    /// @brief Division operator.
+    friend constexpr auto operator/(fixed_simd lhs, const fixed_simd& rhs) noexcept -> fixed_simd
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    /// @brief Equality operator.
+    friend constexpr auto operator==(const fixed_simd& lhs, const fixed_simd& rhs) noexcept -> mask_type
+    {
+        auto result = mask_type{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            const auto a = lhs.m_values[i];
+            const auto b = rhs.m_values[i];
+            result[i] = operations::ordered(a, b) & (a == b);
+        }
+        return result;
+    }
+
+    /// @brief Inequality operator.
+    friend constexpr auto operator!=(const fixed_simd& lhs, const fixed_simd& rhs) noexcept -> mask_type
+    {
+        return !(lhs == rhs);
+    }
+
+    /// @brief Less-than operator.
+    friend constexpr auto operator<(const fixed_simd& lhs, const fixed_simd& rhs) noexcept -> mask_type
+    {
+        auto result = mask_type{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            const auto a = lhs.m_values[i];
+            const auto b = rhs.m_values[i];
+            result[i] = operations::ordered(a, b) & (a < b);
+        }
+        return result;
+    }
+
+    /// @brief Greater-than operator.
+    friend constexpr auto operator>(const fixed_simd& lhs, const fixed_simd& rhs) noexcept -> mask_type
+    {
+        return rhs < lhs;
+    }
+
+    /// @brief Less-than or equal-to operator.
+    friend constexpr auto operator<=(const fixed_simd& lhs, const fixed_simd& rhs) noexcept -> mask_type
+    {
+        auto result = mask_type{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            const auto a = lhs.m_values[i];
+            const auto b = rhs.m_values[i];
+            result[i] = operations::ordered(a, b) & (a <= b);
+        }
+        return result;
+    }
+
+    /// @brief Greater-than or equal-to operator.
+    friend constexpr auto operator>=(const fixed_simd& lhs, const fixed_simd& rhs) noexcept -> mask_type
+    {
+        return rhs <= lhs;
+    }
+
+    /// @brief Selects the lanes of the first value where the mask is set, and of the
+    ///   second value elsewhere.
+    friend constexpr auto select(const mask_type& mask, const fixed_simd& a, const fixed_simd& b) noexcept
+        -> fixed_simd
+    {
+        auto result = fixed_simd{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            result.m_values[i] = detail::blend(mask[i], a.m_values[i], b.m_values[i]);
+        }
+        return result;
+    }
+
+private:
+    /// @brief Lane-wise operations on internal values of the value type.
+    using operations = detail::lane_operations<T>;
+
+    values_type m_values; ///< Lanes' values in internal form.
+};
+
+}
+
+#endif /* REALNUMB_FIXED_SIMD_HPP */
@@ -0,0 +1,326 @@
+#ifndef REALNUMB_FRACTIONAL_HPP
+#define REALNUMB_FRACTIONAL_HPP
+
+/// @file
+/// @brief Definition of the @c fractional class and closely related code.
+
+#include <cstdint> // for types like std::int16_t
+#include <limits> // for std::numeric_limits
+#include <type_traits> // for std::enable_if_t and more
+#include <iostream>
+#include <utility> // for std::forward
+
+#include <realnumb/fixed.hpp> // for detail::wider
+
+namespace realnumb {
+
+/// @brief Template class for pure fraction fixed-point numbers like those of DSP libraries.
+/// @details This is a fixed point type of the given signed base type whose bits, but for
+///   its sign bit, are all fraction bits. So it's for values from -1 up to but not including
+///   +1. Unlike the @c fixed class, it reserves no values for NaN or the infinities. Its
+///   operations saturate to its lowest and max values instead, like those of the DSP
+///   libraries' <code>Q15</code> and <code>Q31</code> types and the saturating vector
+///   instructions do.
+/// @note Its multiplication is the saturating rounding doubling multiply-high operation of
+///   instructions like <code>pmulhrsw</code> and <code>vqrdmulh</code>. That rounds halves
+///   upwards, rather than away from zero like the @c fixed class does.
+/// @note <code>fixed<std::int16_t, 15></code> and <code>fixed<std::int32_t, 31></code> are the
+///   same formats but with special values.
+/// @see fixed.
+/// @see https://en.wikipedia.org/wiki/Q_(number_format)
+template <typename BaseType>
+class fractional
+{
+public:
+
+    /// @brief Value type.
+    using value_type = BaseType;
+
+    static_assert(std::is_integral_v<value_type> && std::is_signed_v<value_type>);
+
+    /// @brief Bits per byte.
+    static constexpr auto bits_per_byte = 8u;
+
+    /// @brief Total number of bits.
+    static constexpr auto total_bits = static_cast<unsigned int>(sizeof(BaseType) * bits_per_byte);
+
+    /// @brief Fraction bits.
+    static constexpr auto fraction_bits = total_bits - 1u;
+
+    /// @brief Whole value bits.
+    /// @note This is only the sign bit.
+    static constexpr auto whole_bits = total_bits - fraction_bits;
+
+    /// @brief Scale factor.
+    /// @note This is of the wider type since the value type can't hold it.
+    static constexpr auto scale_factor = static_cast<typename detail::wider<value_type>::type>(
+        typename detail::wider<value_type>::type{1} << fraction_bits);
+
+    /// @brief Gets the min value this type is capable of expressing.
+    static constexpr auto get_min() noexcept -> fractional
+    {
+        return from_value(1);
+    }
+
+    /// @brief Gets the max value this type is capable of expressing.
+    /// @note This is one min value less than one.
+    static constexpr auto get_max() noexcept -> fractional
+    {
+        return from_value(numeric_limits::max());
+    }
+
+    /// @brief Gets the lowest value this type is capable of expressing.
+    /// @note This is minus one.
+    static constexpr auto get_lowest() noexcept -> fractional
+    {
+        return from_value(numeric_limits::lowest());
+    }
+
+    /// @brief Gets the value from a floating point value.
+    /// @details Rounds to the nearest value, saturating values beyond the range to its
+    ///   limits. NaN becomes zero since there's no value for it.
+    template <typename T>
+    static constexpr auto to_value(T val) noexcept
+        -> std::enable_if_t<std::is_floating_point_v<T>, value_type>
+    {
+        const auto scaled = static_cast<long double>(val) * scale_factor;
+        // Note: std::isnan(val) *NOT* constant expression, so can't use here!
+        return !(val <= 0 || val >= 0) // NOLINT(misc-redundant-expression)
+            ? value_type{0} // newline!
+            : (scaled >= static_cast<long double>(numeric_limits::max()) + 0.5L) // newline!
+                ? numeric_limits::max() // newline!
+                : (scaled <= static_cast<long double>(numeric_limits::lowest())) // newline!
+                    ? numeric_limits::lowest() // newline!
+                    : static_cast<value_type>(scaled + ((scaled < 0)? -0.5L: 0.5L));
+    }
+
+    /// @brief Gets the value from an integral value.
+    /// @details Only zero and minus one are expressible. Others saturate.
+    template <typename T>
+    static constexpr auto to_value(T val) noexcept
+        -> std::enable_if_t<std::is_integral_v<T>, value_type>
+    {
+        return (val > 0)? numeric_limits::max(): (val < 0)? numeric_limits::lowest(): value_type{0};
+    }
+
+    fractional() = default;
+
+    /// @brief Initializing constructor from any arithmetic type.
+    template <class U, std::enable_if_t<std::is_arithmetic_v<std::decay_t<U>>, int> = 0>
+    constexpr fractional(U&& val) noexcept:
+        m_value{to_value(std::forward<U>(val))}
+    {
+        // Intentionally empty
+    }
+
+    // Methods
+
+    /// @brief Converts the value to the expressed type.
+    template <typename T>
+    constexpr auto to_type() const noexcept -> std::enable_if_t<std::is_floating_point_v<T>, T>
+    {
+        return static_cast<T>(m_value) / static_cast<T>(scale_factor);
+    }
+
+    /// @brief Gets this value in its internal form.
+    /// @see from_value.
+    constexpr auto get_value() const noexcept -> value_type
+    {
+        return m_value;
+    }
+
+    /// @brief Gets the fractional value for the given value in internal form.
+    /// @see get_value.
+    static constexpr auto from_value(value_type val) noexcept -> fractional
+    {
+        auto result = fractional{};
+        result.m_value = val;
+        return result;
+    }
+
+    // Unary operations
+
+    /// @brief To floating point type operator.
+    template <class T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    explicit constexpr operator T() const noexcept
+    {
+        return to_type<T>();
+    }
+
+    /// @brief Negation operator.
+    /// @note The negation of minus one saturates to the max value.
+    constexpr auto operator- () const noexcept -> fractional
+    {
+        return from_value(saturate(-wider_type{m_value}));
+    }
+
+    /// @brief Positive operator.
+    constexpr auto operator+ () const noexcept -> fractional
+    {
+        return *this;
+    }
+
+    /// @brief Boolean operator.
+    explicit constexpr operator bool() const noexcept
+    {
+        return m_value != 0;
+    }
+
+    /// @brief Logical not operator.
+    constexpr bool operator! () const noexcept
+    {
+        return m_value == 0;
+    }
+
+    /// @brief Addition assignment operator.
+    /// @note This saturates.
+    constexpr auto operator+= (fractional val) noexcept -> fractional&
+    {
+        m_value = saturate(wider_type{m_value} + wider_type{val.m_value});
+        return *this;
+    }
+
+    /// @brief Subtraction assignment operator.
+    /// @note This saturates.
+    constexpr auto operator-= (fractional val) noexcept -> fractional&
+    {
+        m_value = saturate(wider_type{m_value} - wider_type{val.m_value});
+        return *this;
+    }
+
+    /// @brief Multiplication assignment operator.
+    /// @details This is the saturating rounding doubling multiply-high operation. Only the
+    ///   product of minus one with itself saturates.
+    constexpr auto operator*= (fractional val) noexcept -> fractional&
+    {
+        constexpr auto half = wider_type{1} << (fraction_bits - 1u);
+        const auto product = static_cast<wider_type>(wider_type{m_value} * wider_type{val.m_value});
+        m_value = saturate(static_cast<wider_type>((product + half) >> fraction_bits));
+        return *this;
+    }
+
+    /// @brief Gets this value's sign.
+    constexpr auto getsign() const noexcept -> int
+    {
+        return (m_value >= 0)? +1: -1;
+    }
+
+private:
+
+    /// @brief Widened type alias.
+    using wider_type = typename detail::wider<value_type>::type;
+
+    /// @brief Numeric limits type alias.
+    using numeric_limits = std::numeric_limits<value_type>;
+
+    /// @brief Saturates the given wide value to the range of this type.
+    static constexpr auto saturate(wider_type value) noexcept -> value_type
+    {
+        return (value > numeric_limits::max())? numeric_limits::max():
+            (value < numeric_limits::lowest())? numeric_limits::lowest():
+            static_cast<value_type>(value);
+    }
+
+    value_type m_value; ///< Value in internal form.
+};
+
+/// @brief Equality operator.
+template <typename BT>
+constexpr bool operator== (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    return lhs.get_value() == rhs.get_value();
+}
+
+/// @brief Inequality operator.
+template <typename BT>
+constexpr bool operator!= (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    return lhs.get_value() != rhs.get_value();
+}
+
+/// @brief Less-than operator.
+template <typename BT>
+constexpr bool operator< (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    return lhs.get_value() < rhs.get_value();
+}
+
+/// @brief Greater-than operator.
+template <typename BT>
+constexpr bool operator> (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    return lhs.get_value() > rhs.get_value();
+}
+
+/// @brief Less-than or equal-to operator.
+template <typename BT>
+constexpr bool operator<= (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    return lhs.get_value() <= rhs.get_value();
+}
+
+/// @brief Greater-than or equal-to operator.
+template <typename BT>
+constexpr bool operator>= (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    return lhs.get_value() >= rhs.get_value();
+}
+
+/// @brief Addition operator.
+template <typename BT>
+constexpr fractional<BT> operator+ (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    lhs += rhs;
+    return lhs;
+}
+
+/// @brief Subtraction operator.
+template <typename BT>
+constexpr fractional<BT> operator- (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+/// @brief Multiplication operator.
+template <typename BT>
+constexpr fractional<BT> operator* (fractional<BT> lhs, fractional<BT> rhs) noexcept
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+/// @brief Output stream operator.
+template <typename BT>
+inline ::std::ostream& operator<<(::std::ostream& os, const fractional<BT>& value)
+{
+    return os << static_cast<double>(value);
+}
+
+/// @brief 16-bit pure fraction type.
+/// @details This is the <code>Q15</code> type of DSP libraries. It's of the Q number-format
+///   <code>Q1.15</code>, counting the sign bit as a whole bit like the @c fixed aliases do.
+/// @note Maximum value is 0.999969482421875.
+/// @note Minimum value is 0.000030517578125.
+/// @see fractional
+using q15 = fractional<std::int16_t>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<q15>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<q15>); // trivially copyable & trivial default ctor
+
+/// @brief 32-bit pure fraction type.
+/// @details This is the <code>Q31</code> type of DSP libraries. It's of the Q number-format
+///   <code>Q1.31</code>, counting the sign bit as a whole bit like the @c fixed aliases do.
+/// @note Maximum value is 0.9999999995343387126922607421875.
+/// @note Minimum value is 0.0000000004656612873077392578125.
+/// @see fractional
+using q31 = fractional<std::int32_t>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<q31>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<q31>); // trivially copyable & trivial default ctor
+
+}
+
+#endif /* REALNUMB_FRACTIONAL_HPP */
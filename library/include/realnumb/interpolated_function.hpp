@@ -0,0 +1,345 @@
+#ifndef REALNUMB_INTERPOLATED_FUNCTION_HPP
+#define REALNUMB_INTERPOLATED_FUNCTION_HPP
+
+/// @file
+/// @brief Interpolated tables of unary functions of the fixed types.
+/// @details Where a function is too slow to call directly and its argument type too wide
+///   to tabulate exhaustively, it can instead be sampled over the domain of interest into a
+///   table small enough to stay in cache, and interpolated between the samples.
+/// @see tabulated.
+
+#include <algorithm> // for std::all_of, std::fill, std::max, std::min
+#include <cassert> // for assert
+#include <cstddef> // for std::size_t
+#include <mutex> // for std::call_once, std::once_flag
+#include <type_traits> // for std::is_same_v, std::make_unsigned, std::conditional_t
+#include <vector> // for std::vector
+
+#include <realnumb/fixed.hpp>
+#include <realnumb/fixed_math.hpp>
+#include <realnumb/tabulated.hpp>
+
+namespace realnumb {
+
+/// @brief Linear interpolation between the two samples around the argument.
+/// @details Its error is at most <code>h^2/8</code> times the function's second
+///   derivative's magnitude, for a sample spacing of @c h.
+struct linear_interpolation
+{
+    /// @brief Number of samples beyond the domain that this needs.
+    static constexpr auto extra_samples = std::size_t{1};
+};
+
+/// @brief Cubic interpolation through the four samples around the argument.
+/// @details This is the Catmull-Rom spline. Its error is on the order of <code>h^3</code>
+///   times the function's third derivative's magnitude, for a sample spacing of @c h.
+/// @see https://en.wikipedia.org/wiki/Cubic_Hermite_spline#Catmull%E2%80%93Rom_spline
+struct cubic_interpolation
+{
+    /// @brief Number of samples beyond the domain that this needs.
+    static constexpr auto extra_samples = std::size_t{3};
+};
+
+/// @brief Tabulation strategy of building the table when constructed.
+struct at_construction {};
+
+/// @brief Interpolated table of a unary function of a fixed type.
+/// @details This samples the function over the given domain at a spacing of a power of two
+///   internal units. That's the smallest spacing for which the samples fit the given memory
+///   budget. Evaluating the function then takes only integer operations on the argument's
+///   internal value: a subtraction, a shift and a mask to get the sample index and the
+///   position between samples, and a few multiplies to interpolate.
+/// @note Arguments outside of the domain, and arguments next to samples that aren't finite,
+///   are evaluated by calling the function directly.
+/// @note The function is given by address, like
+///   <code>interpolated_function<fixed32, &exp></code>. That picks the function of the given
+///   type from an overload set like the math functions' by way of the function pointer's type.
+/// @note This is neither copyable nor movable, since for the @c at_first_use strategy it
+///   holds the synchronization for building its table.
+/// @tparam T Fixed type.
+/// @tparam Function Function to interpolate.
+/// @tparam Interpolation Interpolation, like @c linear_interpolation or
+///   @c cubic_interpolation.
+/// @tparam When Tabulation strategy, like @c at_construction or @c at_first_use.
+template <class T, T (*Function)(T), class Interpolation = linear_interpolation,
+          class When = at_construction>
+class interpolated_function
+{
+public:
+    static_assert(std::is_same_v<Interpolation, linear_interpolation> ||
+                  std::is_same_v<Interpolation, cubic_interpolation>,
+                  "unknown interpolation");
+    static_assert(std::is_same_v<When, at_construction> || std::is_same_v<When, at_first_use>,
+                  "unknown tabulation strategy");
+
+    /// @brief Value type.
+    using value_type = T;
+
+    /// @brief Internal value type of the value type.
+    using raw_type = decltype(T{}.get_value());
+
+    /// @brief Default memory budget in bytes.
+    /// @note This is small enough for the table to stay in a level 1 data cache.
+    static constexpr auto default_memory_budget = std::size_t{4096};
+
+    /// @brief Initializing constructor.
+    /// @param lo Lowest argument of the domain to tabulate.
+    /// @param hi Highest argument of the domain to tabulate.
+    /// @param memory_budget Most bytes the table may take.
+    /// @pre @p lo and @p hi are finite and @p lo is less than @p hi.
+    /// @pre @p memory_budget has room for at least
+    ///   <code>Interpolation::extra_samples + 1</code> samples.
+    interpolated_function(value_type lo, value_type hi,
+                          std::size_t memory_budget = default_memory_budget):
+        m_lo{lo.get_value()}, m_hi{hi.get_value()}
+    {
+        assert(lo.isfinite());
+        assert(hi.isfinite());
+        assert(lo < hi);
+        const auto max_samples = memory_budget / sizeof(raw_type);
+        assert(max_samples > Interpolation::extra_samples);
+        const auto span = static_cast<unsigned_wider_type>(wider_type{m_hi} - wider_type{m_lo});
+        while ((span >> m_shift) + 1u + Interpolation::extra_samples > max_samples)
+        {
+            ++m_shift;
+        }
+        m_drop = (m_shift > position_bits)? m_shift - position_bits: 0u;
+        m_bits = m_shift - m_drop;
+        m_half = (m_bits > 0u)? (wider_type{1} << (m_bits - 1u)): wider_type{0};
+        if constexpr (std::is_same_v<When, at_construction>)
+        {
+            build();
+        }
+    }
+
+    interpolated_function(const interpolated_function&) = delete;
+    interpolated_function& operator=(const interpolated_function&) = delete;
+
+    /// @brief Gets the function's interpolated result for the given argument.
+    auto operator()(value_type arg) const -> value_type
+    {
+        ensure_built();
+        const auto raw = arg.get_value();
+        if ((raw < m_lo) || (raw > m_hi))
+        {
+            return Function(arg);
+        }
+        const auto result = interpolate(raw);
+        return result.isnan()? Function(arg): result;
+    }
+
+    /// @brief Gets the lowest argument of the domain.
+    auto lo() const noexcept -> value_type
+    {
+        return T::from_value(m_lo);
+    }
+
+    /// @brief Gets the highest argument of the domain.
+    auto hi() const noexcept -> value_type
+    {
+        return T::from_value(m_hi);
+    }
+
+    /// @brief Gets the spacing between samples in internal units, as a power of two.
+    auto spacing_bits() const noexcept -> unsigned int
+    {
+        return m_shift;
+    }
+
+    /// @brief Gets the number of samples in the table.
+    auto size() const -> std::size_t
+    {
+        ensure_built();
+        return m_samples.size();
+    }
+
+    /// @brief Gets the maximum error against calling the function directly.
+    /// @details This is measured when the table is built. For domains of up to
+    ///   <code>2^20</code> values, it's measured for every value of the domain, otherwise for
+    ///   eight evenly spaced values between each pair of samples.
+    auto max_error() const -> value_type
+    {
+        ensure_built();
+        return m_max_error;
+    }
+
+private:
+    /// @brief Widened type alias.
+    using wider_type = typename detail::wider<raw_type>::type;
+
+    /// @brief Unsigned widened type alias.
+    /// @note The @c limbs types are signed only so this is just the widened type for those.
+    ///   That still has plenty of bits for the spans between internal values.
+    using unsigned_wider_type = typename std::conditional_t<std::is_integral_v<wider_type>,
+        std::make_unsigned<wider_type>, std::common_type<wider_type>>::type;
+
+    /// @brief Total bits of the internal value type.
+    static constexpr auto total_bits = static_cast<unsigned int>(sizeof(raw_type) * 8u);
+
+    /// @brief Most bits of the position between samples that the interpolation uses.
+    /// @note This keeps the interpolation's products within the widened type.
+    static constexpr auto position_bits = total_bits - 6u;
+
+    /// @brief Number of samples before the domain's lowest argument.
+    static constexpr auto leading_samples =
+        std::is_same_v<Interpolation, cubic_interpolation>? std::size_t{1}: std::size_t{0};
+
+    /// @brief Highest of the domains that max_error is measured for at every value.
+    static constexpr auto exhaustive_span = unsigned_wider_type{1} << 20u;
+
+    /// @brief Checks whether the given internal value is of a finite value.
+    static constexpr auto isfinite(wider_type raw) noexcept -> bool
+    {
+        return (raw > T::get_negative_infinity().get_value()) &&
+            (raw < T::get_positive_infinity().get_value());
+    }
+
+    /// @brief Builds the table if it hasn't been built already.
+    void ensure_built() const
+    {
+        if constexpr (std::is_same_v<When, at_first_use>)
+        {
+            std::call_once(m_built, [this]{ build(); });
+        }
+    }
+
+    /// @brief Builds the table and measures its maximum error.
+    void build() const
+    {
+        const auto span = static_cast<unsigned_wider_type>(wider_type{m_hi} - wider_type{m_lo});
+        const auto count = static_cast<std::size_t>(span >> m_shift) + 1u + Interpolation::extra_samples;
+        const auto first = wider_type{m_lo} - (wider_type{static_cast<raw_type>(leading_samples)} << m_shift);
+        m_samples.resize(count);
+        auto lowest = count;
+        auto highest = std::size_t{0};
+        for (auto i = std::size_t{0}; i < count; ++i)
+        {
+            const auto position = first + (static_cast<wider_type>(i) << m_shift);
+            if (isfinite(position))
+            {
+                m_samples[i] = Function(T::from_value(static_cast<raw_type>(position))).get_value();
+                lowest = std::min(lowest, i);
+                highest = i;
+            }
+        }
+        // Samples beyond the type's range are extrapolated from their neighbors. With just
+        // one sample within it, like for a domain next to the type's max, there's nothing to
+        // extrapolate from so they're copies of that sample instead.
+        if (lowest == highest)
+        {
+            std::fill(m_samples.begin(), m_samples.end(), m_samples[lowest]);
+        }
+        else
+        {
+            for (auto i = lowest; i > 0u; --i)
+            {
+                m_samples[i - 1u] = extrapolate(m_samples[i], m_samples[i + 1u]);
+            }
+            for (auto i = highest + 1u; i < count; ++i)
+            {
+                m_samples[i] = extrapolate(m_samples[i - 1u], m_samples[i - 2u]);
+            }
+        }
+        m_finite = std::all_of(m_samples.begin(), m_samples.end(), [](raw_type sample){
+            return isfinite(sample);
+        });
+        measure();
+    }
+
+    /// @brief Extrapolates the next sample from the given two in the other direction.
+    static auto extrapolate(raw_type nearer, raw_type further) noexcept -> raw_type
+    {
+        if (!isfinite(nearer) || !isfinite(further))
+        {
+            return nearer;
+        }
+        return clamp(wider_type{2} * nearer - further);
+    }
+
+    /// @brief Clamps the given value to the range of the type's finite internal values.
+    static auto clamp(wider_type value) noexcept -> raw_type
+    {
+        return static_cast<raw_type>(std::min(std::max(value, wider_type{T::get_lowest().get_value()}),
+                                              wider_type{T::get_max().get_value()}));
+    }
+
+    /// @brief Measures the maximum error against calling the function directly.
+    void measure() const
+    {
+        const auto span = static_cast<unsigned_wider_type>(wider_type{m_hi} - wider_type{m_lo});
+        const auto step = (span <= exhaustive_span)? unsigned_wider_type{1}:
+            std::max(unsigned_wider_type{1}, (unsigned_wider_type{1} << m_shift) / 8u);
+        auto worst = unsigned_wider_type{0};
+        for (auto offset = unsigned_wider_type{0}; offset <= span; offset += step)
+        {
+            const auto raw = static_cast<raw_type>(wider_type{m_lo} + static_cast<wider_type>(offset));
+            const auto expected = Function(T::from_value(raw));
+            const auto actual = interpolate(raw);
+            if (expected.isfinite() && actual.isfinite())
+            {
+                const auto difference = wider_type{actual.get_value()} - wider_type{expected.get_value()};
+                worst = std::max(worst, static_cast<unsigned_wider_type>((difference < 0)? -difference: difference));
+            }
+        }
+        m_max_error = T::from_value(clamp(static_cast<wider_type>(worst)));
+    }
+
+    /// @brief Interpolates the samples for the given internal value within the domain.
+    /// @return Interpolated value or NaN if the samples needed aren't all finite.
+    auto interpolate(raw_type raw) const noexcept -> value_type
+    {
+        const auto offset = static_cast<unsigned_wider_type>(wider_type{raw} - wider_type{m_lo});
+        const auto index = static_cast<std::size_t>(offset >> m_shift);
+        const auto mask = (unsigned_wider_type{1} << m_shift) - 1u;
+        const auto t = static_cast<wider_type>((offset & mask) >> m_drop);
+        if constexpr (std::is_same_v<Interpolation, linear_interpolation>)
+        {
+            const auto y0 = wider_type{m_samples[index]};
+            const auto y1 = wider_type{m_samples[index + 1u]};
+            if (!m_finite && (!isfinite(y0) || !isfinite(y1)))
+            {
+                return T::get_nan();
+            }
+            // Result is between the two samples so it needs no clamping.
+            return T::from_value(static_cast<raw_type>(y0 + scale((y1 - y0) * t)));
+        }
+        else
+        {
+            const auto ym1 = wider_type{m_samples[index]};
+            const auto y0 = wider_type{m_samples[index + 1u]};
+            const auto y1 = wider_type{m_samples[index + 2u]};
+            const auto y2 = wider_type{m_samples[index + 3u]};
+            if (!m_finite && (!isfinite(ym1) || !isfinite(y0) || !isfinite(y1) || !isfinite(y2)))
+            {
+                return T::get_nan();
+            }
+            // Twice the Catmull-Rom polynomial, keeping its coefficients integral.
+            auto acc = 3 * (y0 - y1) + y2 - ym1;
+            acc = scale(acc * t) + 2 * ym1 - 5 * y0 + 4 * y1 - y2;
+            acc = scale(acc * t) + y1 - ym1;
+            acc = scale(acc * t) + 2 * y0;
+            return T::from_value(clamp(detail::round_shift(acc, 1u)));
+        }
+    }
+
+    /// @brief Divides the given product of a position between samples by the spacing.
+    auto scale(wider_type product) const noexcept -> wider_type
+    {
+        return (product + m_half) >> m_bits;
+    }
+
+    raw_type m_lo; ///< Lowest argument of the domain in internal form.
+    raw_type m_hi; ///< Highest argument of the domain in internal form.
+    unsigned int m_shift = 0u; ///< Spacing between samples as a power of two.
+    unsigned int m_drop = 0u; ///< Low bits of the position between samples that are dropped.
+    unsigned int m_bits = 0u; ///< Bits of the position between samples that are used.
+    wider_type m_half = 0; ///< Half of one in the position's units, for rounding.
+    mutable std::vector<raw_type> m_samples; ///< Samples in internal form.
+    mutable bool m_finite = false; ///< Whether all the samples are finite.
+    mutable value_type m_max_error{}; ///< Maximum error measured when built.
+    mutable std::once_flag m_built; ///< Flag of building for the at_first_use strategy.
+};
+
+}
+
+#endif /* REALNUMB_INTERPOLATED_FUNCTION_HPP */
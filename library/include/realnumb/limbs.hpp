@@ -0,0 +1,886 @@
+#ifndef REALNUMB_LIMBS_HPP
+#define REALNUMB_LIMBS_HPP
+
+/// @file
+/// @brief Definition of the @c limbs class template and closely related code.
+
+#include <array> // for std::array
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <limits> // for std::numeric_limits
+#include <type_traits> // for std::enable_if_t and more
+#include <utility> // for std::pair
+
+// Uses the built-in 128-bit integer types where they're fully supported. Defining
+// REALNUMB_NO_INT128 forces the portable code instead, like for testing it.
+#if defined(__SIZEOF_INT128__) && !defined(__STRICT_ANSI__) && !defined(REALNUMB_NO_INT128)
+#define REALNUMB_INT128 __int128_t
+#define REALNUMB_UINT128 __uint128_t
+#endif
+
+namespace realnumb {
+namespace detail {
+
+/// @brief Full product of two 64-bit limbs.
+struct limb_product
+{
+    std::uint64_t lo; ///< Low 64 bits.
+    std::uint64_t hi; ///< High 64 bits.
+};
+
+/// @brief Multiplies the two given limbs into their full 128-bit product.
+/// @note Without a built-in 128-bit integer type, this sums the four 32-bit by 32-bit
+///   partial products, which is what compilers generate for that type on 32-bit targets.
+constexpr auto multiply_limbs(std::uint64_t a, std::uint64_t b) noexcept -> limb_product
+{
+#ifdef REALNUMB_UINT128
+    const auto product = static_cast<REALNUMB_UINT128>(a) * b;
+    return {static_cast<std::uint64_t>(product), static_cast<std::uint64_t>(product >> 64u)};
+#else
+    constexpr auto mask = std::uint64_t{0xFFFFFFFFu};
+    const auto lo_lo = (a & mask) * (b & mask);
+    const auto hi_lo = (a >> 32u) * (b & mask);
+    const auto lo_hi = (a & mask) * (b >> 32u);
+    const auto hi_hi = (a >> 32u) * (b >> 32u);
+    // Can't overflow since (2^32 - 1)^2 + 2 (2^32 - 1) is 2^64 - 1...
+    const auto cross = (lo_lo >> 32u) + (hi_lo & mask) + lo_hi;
+    return {(cross << 32u) | (lo_lo & mask), hi_hi + (hi_lo >> 32u) + (cross >> 32u)};
+#endif
+}
+
+/// @brief Gets the number of bits needed to represent the given limb.
+constexpr auto limb_bit_width(std::uint64_t value) noexcept -> unsigned int
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (value == 0u)? 0u: static_cast<unsigned int>(
+        std::numeric_limits<unsigned long long>::digits - __builtin_clzll(value));
+#else
+    auto result = 0u;
+    for (; value != 0u; value >>= 1u)
+    {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+/// @brief Quotient and remainder of a division by a limb.
+struct limb_quotient
+{
+    std::uint64_t quotient; ///< Quotient.
+    std::uint64_t remainder; ///< Remainder.
+};
+
+/// @brief Divides the two limb value of the given high and low limbs by the given limb.
+/// @details This is Knuth's algorithm D for two 32-bit digit divisors, so all of the
+///   intermediate values fit 64-bit integers and it's the same with or without a built-in
+///   128-bit integer type.
+/// @pre The high limb is less than the divisor, so the quotient fits in a limb.
+/// @see https://en.wikipedia.org/wiki/Division_algorithm
+constexpr auto divide_limbs(std::uint64_t hi, std::uint64_t lo, std::uint64_t divisor) noexcept
+    -> limb_quotient
+{
+    if (hi == 0u)
+    {
+        return {lo / divisor, lo % divisor};
+    }
+    constexpr auto base = std::uint64_t{1} << 32u;
+    constexpr auto mask = base - 1u;
+    // Normalizes so the divisor's high bit is set...
+    const auto s = 64u - limb_bit_width(divisor);
+    const auto v = divisor << s;
+    const auto vn1 = v >> 32u;
+    const auto vn0 = v & mask;
+    const auto un32 = (s == 0u)? hi: ((hi << s) | (lo >> (64u - s)));
+    const auto un10 = lo << s;
+    const auto un1 = un10 >> 32u;
+    const auto un0 = un10 & mask;
+    // Estimates each quotient digit from the top digits then corrects it...
+    auto q1 = un32 / vn1;
+    auto rhat = un32 - q1 * vn1;
+    while ((q1 >= base) || (q1 * vn0 > ((rhat << 32u) | un1)))
+    {
+        --q1;
+        rhat += vn1;
+        if (rhat >= base)
+        {
+            break;
+        }
+    }
+    const auto un21 = (un32 << 32u) + un1 - q1 * v;
+    auto q0 = un21 / vn1;
+    rhat = un21 - q0 * vn1;
+    while ((q0 >= base) || (q0 * vn0 > ((rhat << 32u) | un0)))
+    {
+        --q0;
+        rhat += vn1;
+        if (rhat >= base)
+        {
+            break;
+        }
+    }
+    return {(q1 << 32u) | q0, ((un21 << 32u) + un0 - q0 * v) >> s};
+}
+
+} // namespace detail
+
+/// @brief Template class for signed integers of the given number of 64-bit limbs.
+/// @details This is a two's complement integer type, like the built-in signed integer
+///   types but of <code>64 N</code> bits, that satisfies the <code>LiteralType</code> named
+///   requirement. It's the wider type of the 128-bit base type of the @c fixed class, and
+///   of the 64-bit one where there's no built-in 128-bit integer type. So it has just what
+///   the @c fixed class and its math functions need of that: the
+///   arithmetic, bitwise, shift, and comparison operators, and conversions to and from
+///   the built-in integral types. Like for those types, conversions to narrower types and
+///   arithmetic that overflows wrap around.
+/// @note Multiplication only multiplies the limbs that are significant in the operands'
+///   magnitudes, using 64-bit by 64-bit to 128-bit partial products. So multiplying two
+///   values that came from 128-bit integers takes only four of those. For one or two limbs,
+///   it's the product of the limbs as they are instead, like the built-in types' is.
+/// @note Division by powers of two are shifts. Other divisions use Knuth's algorithm D with
+///   limbs as its digits.
+/// @see https://en.wikipedia.org/wiki/Arbitrary-precision_arithmetic
+/// @see https://en.cppreference.com/w/cpp/named_req/LiteralType
+template <std::size_t N>
+class limbs
+{
+public:
+    static_assert(N > 0u, "needs at least one limb");
+
+    /// @brief Limb type.
+    using limb_type = std::uint64_t;
+
+    /// @brief Limbs type.
+    /// @note The first element is the least significant limb.
+    using limbs_type = std::array<limb_type, N>;
+
+    /// @brief Bits per limb.
+    static constexpr auto limb_bits = 64u;
+
+    /// @brief Total number of bits.
+    static constexpr auto total_bits = static_cast<unsigned int>(N * limb_bits);
+
+    limbs() = default;
+
+    /// @brief Initializing constructor from any integral type.
+    template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+    constexpr limbs(T value) noexcept: // NOLINT(google-explicit-constructor)
+        m_limbs{}
+    {
+        using unsigned_type = std::make_unsigned_t<std::conditional_t<std::is_same_v<T, bool>, unsigned char, T>>;
+        constexpr auto digits = static_cast<unsigned int>(std::numeric_limits<unsigned_type>::digits);
+        const auto bits = static_cast<unsigned_type>(value);
+        const auto fill = (value < T{0})? ~limb_type{0}: limb_type{0};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            const auto shift = static_cast<unsigned int>(i * limb_bits);
+            if (shift >= digits)
+            {
+                m_limbs[i] = fill;
+                continue;
+            }
+            m_limbs[i] = static_cast<limb_type>(bits >> shift);
+            if (digits - shift < limb_bits)
+            {
+                // Sign extends the values of types narrower than a limb...
+                m_limbs[i] |= fill << (digits - shift);
+            }
+        }
+    }
+
+    /// @brief Initializing constructor from a narrower limbs type.
+    /// @note This sign extends the given value like the built-in types' widening does.
+    template <std::size_t M, std::enable_if_t<(M < N), int> = 0>
+    constexpr limbs(const limbs<M>& value) noexcept: // NOLINT(google-explicit-constructor)
+        m_limbs{}
+    {
+        const auto fill = value.is_negative()? ~limb_type{0}: limb_type{0};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_limbs[i] = (i < M)? value.get_limbs()[i]: fill;
+        }
+    }
+
+    /// @brief Initializing constructor from a wider limbs type.
+    /// @note This keeps the low limbs of the given value like conversions of the built-in
+    ///   types to narrower types do.
+    template <std::size_t M, std::enable_if_t<(M > N), int> = 0>
+    explicit constexpr limbs(const limbs<M>& value) noexcept:
+        m_limbs{}
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_limbs[i] = value.get_limbs()[i];
+        }
+    }
+
+    /// @brief Initializing constructor from any floating point type.
+    /// @note This truncates towards zero like conversions of floating point values to the
+    ///   built-in integral types do. Behavior is undefined if the truncated value isn't
+    ///   representable by this type.
+    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    explicit constexpr limbs(T value) noexcept:
+        m_limbs{}
+    {
+        // Uses long double for the scale of the highest limb which float can't hold...
+        auto rest = static_cast<long double>((value < 0)? -value: value);
+        auto scale = 1.0L;
+        for (auto i = std::size_t{1}; i < N; ++i)
+        {
+            scale *= limb_scale;
+        }
+        for (auto i = N; i > 0u; --i)
+        {
+            if (rest >= scale)
+            {
+                m_limbs[i - 1u] = static_cast<limb_type>(rest / scale);
+                rest -= static_cast<long double>(m_limbs[i - 1u]) * scale;
+            }
+            scale /= limb_scale;
+        }
+        if (value < 0)
+        {
+            *this = -*this;
+        }
+    }
+
+    /// @brief Gets the limbs value for the given limbs.
+    static constexpr auto from_limbs(const limbs_type& values) noexcept -> limbs
+    {
+        auto result = limbs{};
+        result.m_limbs = values;
+        return result;
+    }
+
+    /// @brief Gets the limbs of this value.
+    constexpr auto get_limbs() const noexcept -> const limbs_type&
+    {
+        return m_limbs;
+    }
+
+    /// @brief Gets whether this value is negative.
+    constexpr auto is_negative() const noexcept -> bool
+    {
+        return (m_limbs[N - 1u] >> (limb_bits - 1u)) != 0u;
+    }
+
+    /// @brief Gets the number of bits needed to represent this non-negative value.
+    /// @see detail::bit_width.
+    constexpr auto bit_width() const noexcept -> unsigned int
+    {
+        for (auto i = N; i > 0u; --i)
+        {
+            if (m_limbs[i - 1u] != 0u)
+            {
+                return static_cast<unsigned int>((i - 1u) * limb_bits) + detail::limb_bit_width(m_limbs[i - 1u]);
+            }
+        }
+        return 0u;
+    }
+
+    /// @brief Gets whether this value is a positive power of two.
+    constexpr auto is_power_of_two() const noexcept -> bool
+    {
+        auto found = false;
+        for (const auto limb: m_limbs)
+        {
+            if (limb != 0u)
+            {
+                if (found || ((limb & (limb - 1u)) != 0u))
+                {
+                    return false;
+                }
+                found = true;
+            }
+        }
+        return found && !is_negative();
+    }
+
+    /// @brief To integral type operator.
+    /// @note This keeps the low bits of this value like conversions of the built-in types do.
+    template <typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    explicit constexpr operator T() const noexcept
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+        constexpr auto digits = static_cast<unsigned int>(std::numeric_limits<unsigned_type>::digits);
+        auto result = unsigned_type{0};
+        for (auto i = std::size_t{0}; (i < N) && (i * limb_bits < digits); ++i)
+        {
+            result |= static_cast<unsigned_type>(static_cast<unsigned_type>(m_limbs[i]) << (i * limb_bits));
+        }
+        return static_cast<T>(result);
+    }
+
+    /// @brief To floating point type operator.
+    /// @note This rounds to nearest with ties to even like conversions of the built-in
+    ///   integral types to floating point types do.
+    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    explicit constexpr operator T() const noexcept
+    {
+        constexpr auto digits = static_cast<unsigned int>(std::numeric_limits<T>::digits);
+        auto value = magnitude();
+        const auto width = value.bit_width();
+        if (width > digits)
+        {
+            // Rounds to the digits of T first so that summing the limbs below is exact,
+            // since summing them as is would round twice...
+            const auto drop = width - digits;
+            auto kept = value;
+            kept.shift_right(drop, limb_type{0});
+            const auto rest = value - (kept << drop);
+            const auto half = limbs{1} << (drop - 1u);
+            if ((rest > half) || ((rest == half) && ((kept.m_limbs[0] & 1u) != 0u)))
+            {
+                kept += limbs{1};
+            }
+            value = kept << drop;
+        }
+        auto result = T{0};
+        for (auto i = N; i > 0u; --i)
+        {
+            result = result * static_cast<T>(limb_scale) + static_cast<T>(value.m_limbs[i - 1u]);
+        }
+        return is_negative()? -result: result;
+    }
+
+    /// @brief Boolean operator.
+    explicit constexpr operator bool() const noexcept
+    {
+        for (const auto limb: m_limbs)
+        {
+            if (limb != 0u)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Logical not operator.
+    constexpr bool operator! () const noexcept
+    {
+        return !static_cast<bool>(*this);
+    }
+
+    /// @brief Bitwise complement operator.
+    constexpr auto operator~ () const noexcept -> limbs
+    {
+        auto result = *this;
+        for (auto& limb: result.m_limbs)
+        {
+            limb = ~limb;
+        }
+        return result;
+    }
+
+    /// @brief Negation operator.
+    constexpr auto operator- () const noexcept -> limbs
+    {
+        auto result = ~*this;
+        for (auto& limb: result.m_limbs)
+        {
+            if (++limb != 0u)
+            {
+                break;
+            }
+        }
+        return result;
+    }
+
+    /// @brief Positive operator.
+    constexpr auto operator+ () const noexcept -> limbs
+    {
+        return *this;
+    }
+
+    /// @brief Addition assignment operator.
+    constexpr auto operator+= (const limbs& val) noexcept -> limbs&
+    {
+        auto carry = limb_type{0};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            const auto sum = m_limbs[i] + val.m_limbs[i];
+            const auto total = sum + carry;
+            carry = static_cast<limb_type>((sum < m_limbs[i]) || (total < sum));
+            m_limbs[i] = total;
+        }
+        return *this;
+    }
+
+    /// @brief Subtraction assignment operator.
+    constexpr auto operator-= (const limbs& val) noexcept -> limbs&
+    {
+        auto borrow = limb_type{0};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            const auto difference = m_limbs[i] - val.m_limbs[i];
+            const auto total = difference - borrow;
+            borrow = static_cast<limb_type>((m_limbs[i] < val.m_limbs[i]) || (difference < borrow));
+            m_limbs[i] = total;
+        }
+        return *this;
+    }
+
+    /// @brief Multiplication assignment operator.
+    constexpr auto operator*= (const limbs& val) noexcept -> limbs&
+    {
+        if constexpr (N <= 2u)
+        {
+            // The low limbs of the two's complement product don't depend on the signs...
+            const auto product = detail::multiply_limbs(m_limbs[0], val.m_limbs[0]);
+            if constexpr (N == 2u)
+            {
+                m_limbs[1] = product.hi + m_limbs[1] * val.m_limbs[0] + m_limbs[0] * val.m_limbs[1];
+            }
+            m_limbs[0] = product.lo;
+            return *this;
+        }
+        const auto negative = is_negative() != val.is_negative();
+        const auto a = magnitude();
+        const auto b = val.magnitude();
+        const auto na = a.significant_limbs();
+        const auto nb = b.significant_limbs();
+        auto result = limbs{};
+        for (auto i = std::size_t{0}; i < na; ++i)
+        {
+            auto carry = limb_type{0};
+            auto j = std::size_t{0};
+            for (; (j < nb) && (i + j < N); ++j)
+            {
+                const auto product = detail::multiply_limbs(a.m_limbs[i], b.m_limbs[j]);
+                const auto sum = result.m_limbs[i + j] + product.lo;
+                const auto total = sum + carry;
+                carry = product.hi + static_cast<limb_type>(sum < product.lo) + static_cast<limb_type>(total < sum);
+                result.m_limbs[i + j] = total;
+            }
+            if (i + j < N)
+            {
+                result.m_limbs[i + j] = carry;
+            }
+        }
+        *this = negative? -result: result;
+        return *this;
+    }
+
+    /// @brief Division assignment operator.
+    /// @note This truncates towards zero like the built-in types' division does.
+    constexpr auto operator/= (const limbs& val) noexcept -> limbs&
+    {
+        if (!val.is_negative() && val.is_power_of_two())
+        {
+            // Biases negative values so the arithmetic shift truncates towards zero too...
+            if (is_negative())
+            {
+                *this += val;
+                *this -= limbs{1};
+            }
+            return *this >>= (val.bit_width() - 1u);
+        }
+        const auto negative = is_negative() != val.is_negative();
+        const auto quotient = divide(magnitude(), val.magnitude()).first;
+        *this = negative? -quotient: quotient;
+        return *this;
+    }
+
+    /// @brief Modulo assignment operator.
+    /// @note The result has the sign of this value like the built-in types' remainder does.
+    constexpr auto operator%= (const limbs& val) noexcept -> limbs&
+    {
+        const auto negative = is_negative();
+        const auto remainder = divide(magnitude(), val.magnitude()).second;
+        *this = negative? -remainder: remainder;
+        return *this;
+    }
+
+    /// @brief Bitwise and assignment operator.
+    constexpr auto operator&= (const limbs& val) noexcept -> limbs&
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_limbs[i] &= val.m_limbs[i];
+        }
+        return *this;
+    }
+
+    /// @brief Bitwise or assignment operator.
+    constexpr auto operator|= (const limbs& val) noexcept -> limbs&
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_limbs[i] |= val.m_limbs[i];
+        }
+        return *this;
+    }
+
+    /// @brief Bitwise exclusive or assignment operator.
+    constexpr auto operator^= (const limbs& val) noexcept -> limbs&
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            m_limbs[i] ^= val.m_limbs[i];
+        }
+        return *this;
+    }
+
+    /// @brief Left shift assignment operator.
+    constexpr auto operator<<= (unsigned int n) noexcept -> limbs&
+    {
+        const auto whole = n / limb_bits;
+        const auto part = n % limb_bits;
+        for (auto i = N; i > 0u; --i)
+        {
+            const auto to = i - 1u;
+            auto limb = limb_type{0};
+            if (to >= whole)
+            {
+                const auto from = to - whole;
+                limb = m_limbs[from] << part;
+                if ((part != 0u) && (from > 0u))
+                {
+                    limb |= m_limbs[from - 1u] >> (limb_bits - part);
+                }
+            }
+            m_limbs[to] = limb;
+        }
+        return *this;
+    }
+
+    /// @brief Right shift assignment operator.
+    /// @note This is an arithmetic shift, so negative values stay negative.
+    constexpr auto operator>>= (unsigned int n) noexcept -> limbs&
+    {
+        return shift_right(n, is_negative()? ~limb_type{0}: limb_type{0});
+    }
+
+    /// @brief Addition operator.
+    friend constexpr auto operator+ (limbs lhs, const limbs& rhs) noexcept -> limbs
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    /// @brief Subtraction operator.
+    friend constexpr auto operator- (limbs lhs, const limbs& rhs) noexcept -> limbs
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    /// @brief Multiplication operator.
+    friend constexpr auto operator* (limbs lhs, const limbs& rhs) noexcept -> limbs
+    {
+        lhs *= rhs;
+        return lhs;
+    }
+
+    /// @brief Division operator.
+    friend constexpr auto operator/ (limbs lhs, const limbs& rhs) noexcept -> limbs
+    {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    /// @brief Modulo operator.
+    friend constexpr auto operator% (limbs lhs, const limbs& rhs) noexcept -> limbs
+    {
+        lhs %= rhs;
+        return lhs;
+    }
+
+    /// @brief Bitwise and operator.
+    friend constexpr auto operator& (limbs lhs, const limbs& rhs) noexcept -> limbs
+    {
+        lhs &= rhs;
+        return lhs;
+    }
+
+    /// @brief Bitwise or operator.
+    friend constexpr auto operator| (limbs lhs, const limbs& rhs) noexcept -> limbs
+    {
+        lhs |= rhs;
+        return lhs;
+    }
+
+    /// @brief Bitwise exclusive or operator.
+    friend constexpr auto operator^ (limbs lhs, const limbs& rhs) noexcept -> limbs
+    {
+        lhs ^= rhs;
+        return lhs;
+    }
+
+    /// @brief Left shift operator.
+    friend constexpr auto operator<< (limbs lhs, unsigned int rhs) noexcept -> limbs
+    {
+        lhs <<= rhs;
+        return lhs;
+    }
+
+    /// @brief Right shift operator.
+    friend constexpr auto operator>> (limbs lhs, unsigned int rhs) noexcept -> limbs
+    {
+        lhs >>= rhs;
+        return lhs;
+    }
+
+    /// @brief Equality operator.
+    friend constexpr bool operator== (const limbs& lhs, const limbs& rhs) noexcept
+    {
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            if (lhs.m_limbs[i] != rhs.m_limbs[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Inequality operator.
+    friend constexpr bool operator!= (const limbs& lhs, const limbs& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /// @brief Less-than operator.
+    friend constexpr bool operator< (const limbs& lhs, const limbs& rhs) noexcept
+    {
+        if (lhs.is_negative() != rhs.is_negative())
+        {
+            return lhs.is_negative();
+        }
+        for (auto i = N; i > 0u; --i)
+        {
+            if (lhs.m_limbs[i - 1u] != rhs.m_limbs[i - 1u])
+            {
+                return lhs.m_limbs[i - 1u] < rhs.m_limbs[i - 1u];
+            }
+        }
+        return false;
+    }
+
+    /// @brief Greater-than operator.
+    friend constexpr bool operator> (const limbs& lhs, const limbs& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    /// @brief Less-than or equal-to operator.
+    friend constexpr bool operator<= (const limbs& lhs, const limbs& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    /// @brief Greater-than or equal-to operator.
+    friend constexpr bool operator>= (const limbs& lhs, const limbs& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+
+    /// @brief Two to the power of the bits per limb.
+    static constexpr auto limb_scale = 18446744073709551616.0L;
+
+    /// @brief Gets the magnitude of this value.
+    /// @note The magnitude of the lowest value is itself, which is still right when
+    ///   treated as unsigned like the division algorithm does.
+    constexpr auto magnitude() const noexcept -> limbs
+    {
+        return is_negative()? -*this: *this;
+    }
+
+    /// @brief Gets the number of limbs up to and including the highest non-zero one.
+    constexpr auto significant_limbs() const noexcept -> std::size_t
+    {
+        auto n = N;
+        while ((n > 0u) && (m_limbs[n - 1u] == 0u))
+        {
+            --n;
+        }
+        return n;
+    }
+
+    /// @brief Shifts this value right by the given amount, filling in with the given limb.
+    constexpr auto shift_right(unsigned int n, limb_type fill) noexcept -> limbs&
+    {
+        const auto whole = n / limb_bits;
+        const auto part = n % limb_bits;
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            const auto from = i + whole;
+            const auto lo = (from < N)? m_limbs[from]: fill;
+            const auto hi = (from + 1u < N)? m_limbs[from + 1u]: fill;
+            m_limbs[i] = (part == 0u)? lo: ((lo >> part) | (hi << (limb_bits - part)));
+        }
+        return *this;
+    }
+
+    /// @brief Divides the given magnitudes.
+    /// @details Divisors that are powers of two just shift. Others use Knuth's algorithm D
+    ///   with limbs as its digits. That gets each quotient limb from dividing the top two
+    ///   limbs of the remaining dividend by the top limb of the divisor, so single limb
+    ///   divisors need nothing more.
+    /// @note Behavior is undefined for a divisor of zero, like it is for the built-in types.
+    /// @return Quotient and remainder.
+    /// @see https://en.wikipedia.org/wiki/Division_algorithm
+    static constexpr auto divide(const limbs& u, const limbs& v) noexcept -> std::pair<limbs, limbs>
+    {
+        if (v.is_power_of_two())
+        {
+            auto quotient = u;
+            quotient.shift_right(v.bit_width() - 1u, limb_type{0});
+            return {quotient, u & (v - limbs{1})};
+        }
+        auto quotient = limbs{};
+        const auto m = u.significant_limbs();
+        const auto n = v.significant_limbs();
+        if (n == 1u)
+        {
+            const auto divisor = v.m_limbs[0];
+            auto rest = limb_type{0};
+            auto i = m;
+            if ((i > 0u) && (u.m_limbs[i - 1u] < divisor))
+            {
+                rest = u.m_limbs[--i];
+            }
+            for (; i > 0u; --i)
+            {
+                const auto result = detail::divide_limbs(rest, u.m_limbs[i - 1u], divisor);
+                quotient.m_limbs[i - 1u] = result.quotient;
+                rest = result.remainder;
+            }
+            return {quotient, limbs{rest}};
+        }
+        if (m < n)
+        {
+            return {quotient, u};
+        }
+        // Normalizes so the divisor's highest limb has its high bit set...
+        const auto s = limb_bits - detail::limb_bit_width(v.m_limbs[n - 1u]);
+        const auto vn = v << s;
+        auto un = std::array<limb_type, N + 1u>{};
+        for (auto i = std::size_t{0}; i < m; ++i)
+        {
+            un[i] |= u.m_limbs[i] << s;
+            un[i + 1u] = (s == 0u)? limb_type{0}: (u.m_limbs[i] >> (limb_bits - s));
+        }
+        const auto d1 = vn.m_limbs[n - 1u];
+        const auto d0 = vn.m_limbs[n - 2u];
+        for (auto j = m - n + 1u; j > 0u; --j)
+        {
+            const auto k = j - 1u;
+            // Estimates the quotient limb from the top two limbs then corrects it...
+            auto qhat = ~limb_type{0};
+            auto rhat = un[k + n - 1u] + d1;
+            auto overflow = rhat < d1;
+            if (un[k + n] < d1)
+            {
+                const auto estimate = detail::divide_limbs(un[k + n], un[k + n - 1u], d1);
+                qhat = estimate.quotient;
+                rhat = estimate.remainder;
+                overflow = false;
+            }
+            while (!overflow)
+            {
+                const auto product = detail::multiply_limbs(qhat, d0);
+                if ((product.hi < rhat) || ((product.hi == rhat) && (product.lo <= un[k + n - 2u])))
+                {
+                    break;
+                }
+                --qhat;
+                rhat += d1;
+                overflow = rhat < d1;
+            }
+            // Multiplies and subtracts...
+            auto carry = limb_type{0};
+            auto borrow = limb_type{0};
+            for (auto i = std::size_t{0}; i <= n; ++i)
+            {
+                auto lo = carry;
+                if (i < n)
+                {
+                    const auto product = detail::multiply_limbs(qhat, vn.m_limbs[i]);
+                    lo += product.lo;
+                    carry = product.hi + static_cast<limb_type>(lo < product.lo);
+                }
+                const auto difference = un[i + k] - lo;
+                const auto total = difference - borrow;
+                borrow = static_cast<limb_type>((un[i + k] < lo) || (difference < borrow));
+                un[i + k] = total;
+            }
+            if (borrow != 0u)
+            {
+                // Estimate was one too big so adds back...
+                --qhat;
+                carry = limb_type{0};
+                for (auto i = std::size_t{0}; i < n; ++i)
+                {
+                    const auto sum = un[i + k] + vn.m_limbs[i];
+                    const auto total = sum + carry;
+                    carry = static_cast<limb_type>((sum < un[i + k]) || (total < sum));
+                    un[i + k] = total;
+                }
+                un[k + n] += carry;
+            }
+            quotient.m_limbs[k] = qhat;
+        }
+        auto remainder = limbs{};
+        for (auto i = std::size_t{0}; i < n; ++i)
+        {
+            remainder.m_limbs[i] = (s == 0u)? un[i]: ((un[i] >> s) | (un[i + 1u] << (limb_bits - s)));
+        }
+        return {quotient, remainder};
+    }
+
+    limbs_type m_limbs; ///< Limbs of the value in two's complement form.
+};
+
+namespace detail {
+
+/// @brief Gets the number of bits needed to represent the given non-negative value.
+/// @note This finds the highest non-zero limb rather than looping over every bit.
+template <std::size_t N>
+constexpr auto bit_width(const limbs<N>& value) noexcept -> unsigned int
+{
+    return value.bit_width();
+}
+
+} // namespace detail
+
+} // namespace realnumb
+
+/// @brief Template specialization of numeric limits for limbs types.
+/// @details This is like that of the built-in signed integer types, so code that checks how
+///   many bits a wider type has works for these too.
+/// @see https://en.cppreference.com/w/cpp/types/numeric_limits.
+template <std::size_t N>
+class std::numeric_limits<realnumb::limbs<N>>
+{
+public:
+    static constexpr bool is_specialized = true; ///< Type is specialized.
+
+    /// @brief Gets the min value available for the type.
+    static constexpr realnumb::limbs<N> min() noexcept { return realnumb::limbs<N>{1} << (N * 64u - 1u); }
+
+    /// @brief Gets the max value available for the type.
+    static constexpr realnumb::limbs<N> max() noexcept { return ~min(); }
+
+    /// @brief Gets the lowest value available for the type.
+    static constexpr realnumb::limbs<N> lowest() noexcept { return min(); }
+
+    /// @brief Number of radix digits that can be represented.
+    static constexpr int digits = static_cast<int>(N * 64u - 1u);
+
+    /// @brief Number of decimal digits that can be represented.
+    /// @note This is the number of radix digits times log10(2) rounded down.
+    static constexpr int digits10 = static_cast<int>((N * 64u - 1u) * 30103u / 100000u);
+
+    static constexpr bool is_signed = true; ///< Identifies signed types.
+    static constexpr bool is_integer = true; ///< Identifies integer types.
+    static constexpr bool is_exact = true; ///< Identifies exact type.
+    static constexpr int radix = 2; ///< Radix used by the type.
+    static constexpr bool is_bounded = true; ///< Whether the set of values is finite.
+    static constexpr bool is_modulo = true; ///< Whether arithmetic wraps around.
+};
+
+#endif // REALNUMB_LIMBS_HPP
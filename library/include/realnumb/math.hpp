@@ -6,12 +6,55 @@
 
 namespace realnumb {
 
+/// @brief Selects the first value if the mask is set, or the second value otherwise.
+/// @note This is the scalar form of the blends of SIMD lane types. Code written in terms of
+///   this and comparisons, rather than branches, works for either kind of type.
+template <class T>
+constexpr auto select(bool mask, const T& a, const T& b) -> T
+{
+    return mask? a: b;
+}
+
+/// @brief Selects the lanes of the first value where the mask is set, and of the second
+///   value elsewhere.
+/// @note This is for SIMD lane types having a @c where function found by argument
+///   dependent lookup, like <code>std::experimental::simd</code>.
+/// @see https://en.cppreference.com/w/cpp/experimental/simd/where
+template <class M, class T>
+constexpr auto select(const M& mask, const T& a, T b) -> decltype(where(mask, b) = a, T{})
+{
+    where(mask, b) = a;
+    return b;
+}
+
+/// @brief Checks whether all of the mask is set.
+/// @note This is the scalar form of the reductions of SIMD masks.
+constexpr auto all_of(bool mask) noexcept -> bool
+{
+    return mask;
+}
+
+/// @brief Checks whether any of the mask is set.
+/// @note This is the scalar form of the reductions of SIMD masks.
+constexpr auto any_of(bool mask) noexcept -> bool
+{
+    return mask;
+}
+
+/// @brief Checks whether none of the mask is set.
+/// @note This is the scalar form of the reductions of SIMD masks.
+constexpr auto none_of(bool mask) noexcept -> bool
+{
+    return !mask;
+}
+
 /// @brief Computes the absolute value of the value given.
+/// @note This blends rather than branches. So it works for SIMD lane types too.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/fabs
 template <class T>
-constexpr auto abs(T arg) -> decltype(((arg < T())? -arg: arg), T{})
+constexpr auto abs(T arg) -> decltype(select(arg < T(), -arg, arg))
 {
-    return (arg < T())? -arg: arg;
+    return select(arg < T(), -arg, arg);
 }
 
 /// @brief Computes the factorial.
@@ -0,0 +1,1192 @@
+#ifndef REALNUMB_MINIMAX_HPP
+#define REALNUMB_MINIMAX_HPP
+
+/// @file
+/// @brief Minimax polynomial coefficients for the kernels of the fixed math functions.
+/// @note Generated by the realnumb_coeffgen tool using __float128.
+///   Don't edit this by hand, regenerate it instead.
+
+#include <array> // for std::array
+#include <cstdint> // for std::int64_t
+
+namespace realnumb::detail {
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35].
+/// @note Primary template for working and accuracy precisions without a table.
+template <unsigned int WorkingBits, unsigned int AccuracyBits>
+struct minimax_exp
+{
+    static constexpr auto available = false; ///< Whether there's a table.
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 30 fraction bits,
+///   accurate to 9 fraction bits.
+/// @note Maximum measured error is 2^-9.11489.
+template <>
+struct minimax_exp<30u, 9u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        1073572930ll,
+        1090265526ll,
+        543752627ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 30 fraction bits,
+///   accurate to 13 fraction bits.
+/// @note Maximum measured error is 2^-13.6327.
+template <>
+struct minimax_exp<30u, 13u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        1073657491ll,
+        1073674365ll,
+        542372212ll,
+        180606968ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 30 fraction bits,
+///   accurate to 18 fraction bits.
+/// @note Maximum measured error is 2^-18.4711.
+template <>
+struct minimax_exp<30u, 18u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        1073741996ll,
+        1073699695ll,
+        536852658ll,
+        180331280ll,
+        45059870ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 30 fraction bits,
+///   accurate to 23 fraction bits.
+/// @note Maximum measured error is 2^-23.5695.
+template <>
+struct minimax_exp<30u, 23u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 6>{
+        1073741910ll,
+        1073741898ll,
+        536858281ll,
+        178953162ll,
+        45013967ll,
+        9000172ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 30 fraction bits,
+///   accurate to 28 fraction bits.
+/// @note Maximum measured error is 2^-28.8328.
+template <>
+struct minimax_exp<30u, 28u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 7>{
+        1073741824ll,
+        1073741867ll,
+        536870931ll,
+        178954165ll,
+        44738591ll,
+        8993620ll,
+        1498664ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 30 fraction bits,
+///   accurate to 33 fraction bits.
+/// @note Maximum measured error is 2^-33.4154.
+template <>
+struct minimax_exp<30u, 33u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 8>{
+        1073741824ll,
+        1073741824ll,
+        536870924ll,
+        178956974ll,
+        44738742ll,
+        8947754ll,
+        1497845ll,
+        213952ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 9 fraction bits.
+/// @note Maximum measured error is 2^-9.11489.
+template <>
+struct minimax_exp<62u, 9u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        4610960622348173070ll,
+        4682654776628674895ll,
+        2335399751278782243ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 13 fraction bits.
+/// @note Maximum measured error is 2^-13.6327.
+template <>
+struct minimax_exp<62u, 13u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        4611323810256700912ll,
+        4611396285637869930ll,
+        2329470911114609459ll,
+        775701019206389639ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 18 fraction bits.
+/// @note Maximum measured error is 2^-18.4712.
+template <>
+struct minimax_exp<62u, 18u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        4611686757592704345ll,
+        4611505075265234425ll,
+        2305764609663136591ll,
+        774516948999629630ll,
+        193530669113557175ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 23 fraction bits.
+/// @note Maximum measured error is 2^-23.5721.
+template <>
+struct minimax_exp<62u, 23u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 6>{
+        4611686387756772392ll,
+        4611686334984472753ll,
+        2305788761107775038ll,
+        768597977268953408ll,
+        193333517466333013ll,
+        38655446279591136ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 28 fraction bits.
+/// @note Maximum measured error is 2^-28.895.
+template <>
+struct minimax_exp<62u, 28u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 7>{
+        4611686018023561171ll,
+        4611686202998576357ll,
+        2305843091608115620ll,
+        768602286937432752ll,
+        192150787077221574ll,
+        38627301750780555ll,
+        6436711610164735ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 34 fraction bits.
+/// @note Maximum measured error is 2^-34.4103.
+template <>
+struct minimax_exp<62u, 34u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 8>{
+        4611686018225557287ll,
+        4611686018247985368ll,
+        2305843061927582478ll,
+        768614352511000909ll,
+        192151433178322404ll,
+        38430310553398162ll,
+        6433195432437477ll,
+        918916344176289ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 40 fraction bits.
+/// @note Maximum measured error is 2^-40.0954.
+template <>
+struct minimax_exp<62u, 40u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 9>{
+        4611686018427525230ll,
+        4611686018326505287ll,
+        2305843009167737157ll,
+        768614347383213677ll,
+        192153586662749565ll,
+        38430394271940543ll,
+        6405068103006368ll,
+        918525821708740ll,
+        114805968146366ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 45 fraction bits.
+/// @note Maximum measured error is 2^-45.9324.
+template <>
+struct minimax_exp<62u, 45u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 10>{
+        4611686018427456549ll,
+        4611686018427450308ll,
+        2305843009185678400ll,
+        768614336395905452ll,
+        192153585930457512ll,
+        38430717166126969ll,
+        6405077667606125ll,
+        915011312680271ll,
+        114766929054452ll,
+        12751092568291ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 51 fraction bits.
+/// @note Maximum measured error is 2^-51.9064.
+template <>
+struct minimax_exp<62u, 51u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 11>{
+        4611686018427387872ll,
+        4611686018427422219ll,
+        2305843009213709809ll,
+        768614336398962762ll,
+        192153584099825588ll,
+        38430717076279750ll,
+        6405119510772709ll,
+        915012290607061ll,
+        114376554430870ll,
+        12747544540354ll,
+        1274695334637ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 57 fraction bits.
+/// @note Maximum measured error is 2^-57.9936.
+template <>
+struct minimax_exp<62u, 57u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 12>{
+        4611686018427387888ll,
+        4611686018427387889ll,
+        2305843009213703309ll,
+        768614336404567570ll,
+        192153584100250116ll,
+        38430716820059164ll,
+        6405119501069239ll,
+        915017071410750ll,
+        114376644958726ll,
+        12708517498954ll,
+        1274399733822ll,
+        115850387830ll
+    };
+};
+
+/// @brief Minimax coefficients for e^r for r in [-0.35, 0.35] with 62 fraction bits,
+///   accurate to 63 fraction bits.
+/// @note Maximum measured error is 2^-63.9234.
+template <>
+struct minimax_exp<62u, 63u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 13>{
+        4611686018427387904ll,
+        4611686018427387896ll,
+        2305843009213693948ll,
+        768614336404566470ll,
+        192153584101141592ll,
+        38430716820109445ll,
+        6405119470019111ll,
+        915017070472577ll,
+        114377133795368ll,
+        12708525157504ll,
+        1270852615193ll,
+        115827653748ll,
+        9652033883ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79].
+/// @note Primary template for working and accuracy precisions without a table.
+template <unsigned int WorkingBits, unsigned int AccuracyBits>
+struct minimax_sin
+{
+    static constexpr auto available = false; ///< Whether there's a table.
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 30 fraction bits,
+///   accurate to 11 fraction bits.
+/// @note Maximum measured error is 2^-11.2994.
+template <>
+struct minimax_sin<30u, 11u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 2>{
+        1073315781ll,
+        -173454884ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 30 fraction bits,
+///   accurate to 19 fraction bits.
+/// @note Maximum measured error is 2^-19.3643.
+template <>
+struct minimax_sin<30u, 19u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        1073740233ll,
+        -178910963ll,
+        8750483ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 30 fraction bits,
+///   accurate to 27 fraction bits.
+/// @note Maximum measured error is 2^-27.9999.
+template <>
+struct minimax_sin<30u, 27u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        1073741821ll,
+        -178956793ll,
+        8946424ll,
+        -209381ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 30 fraction bits,
+///   accurate to 34 fraction bits.
+/// @note Maximum measured error is 2^-34.1792.
+template <>
+struct minimax_sin<30u, 34u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        1073741824ll,
+        -178956970ll,
+        8947843ll,
+        -213021ll,
+        2917ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 11 fraction bits.
+/// @note Maximum measured error is 2^-11.2994.
+template <>
+struct minimax_sin<62u, 11u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 2>{
+        4609856179773646461ll,
+        -744983054089459565ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 19 fraction bits.
+/// @note Maximum measured error is 2^-19.3647.
+template <>
+struct minimax_sin<62u, 19u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        4611679187028554494ll,
+        -768416736519093257ll,
+        37583038664287262ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 28 fraction bits.
+/// @note Maximum measured error is 2^-28.2102.
+template <>
+struct minimax_sin<62u, 28u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        4611686003576882415ll,
+        -768613573878793264ll,
+        38424597385720911ll,
+        -899282954237556ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 37 fraction bits.
+/// @note Maximum measured error is 2^-37.6686.
+template <>
+struct minimax_sin<62u, 37u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        4611686018406277764ll,
+        -768614334711961721ll,
+        38430695104091677ll,
+        -914919514355803ll,
+        12529513743395ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 47 fraction bits.
+/// @note Maximum measured error is 2^-47.6318.
+template <>
+struct minimax_sin<62u, 47u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 6>{
+        4611686018427366757ll,
+        -768614336402123751ll,
+        38430716774574489ll,
+        -915016754821741ll,
+        12707604237097ll,
+        -114153716355ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 57 fraction bits.
+/// @note Maximum measured error is 2^-57.9801.
+template <>
+struct minimax_sin<62u, 57u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 7>{
+        4611686018427387888ll,
+        -768614336404562180ll,
+        38430716820164861ll,
+        -915017066538793ll,
+        12708567585190ll,
+        -115525891170ll,
+        732927353ll
+    };
+};
+
+/// @brief Minimax coefficients for sin(r) / r in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 63 fraction bits.
+/// @note Maximum measured error is 2^-63.7778.
+template <>
+struct minimax_sin<62u, 63u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 8>{
+        4611686018427387904ll,
+        -768614336404564649ll,
+        38430716820228170ll,
+        -915017067147492ll,
+        12708570372024ll,
+        -115532440753ll,
+        740560046ll,
+        -3494406ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79].
+/// @note Primary template for working and accuracy precisions without a table.
+template <unsigned int WorkingBits, unsigned int AccuracyBits>
+struct minimax_cos
+{
+    static constexpr auto available = false; ///< Whether there's a table.
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 30 fraction bits,
+///   accurate to 8 fraction bits.
+/// @note Maximum measured error is 2^-8.99036.
+template <>
+struct minimax_cos<30u, 8u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 2>{
+        1071630614ll,
+        -509523587ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 30 fraction bits,
+///   accurate to 16 fraction bits.
+/// @note Maximum measured error is 2^-16.5645.
+template <>
+struct minimax_cos<30u, 16u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        1073730745ll,
+        -536550190ll,
+        43361810ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 30 fraction bits,
+///   accurate to 25 fraction bits.
+/// @note Maximum measured error is 2^-25.0387.
+template <>
+struct minimax_cos<30u, 25u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        1073741793ll,
+        -536869319ll,
+        44726451ll,
+        -1458397ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 30 fraction bits,
+///   accurate to 31 fraction bits.
+/// @note Maximum measured error is 2^-31.4807.
+template <>
+struct minimax_cos<30u, 31u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        1073741824ll,
+        -536870908ll,
+        44739187ll,
+        -1491059ll,
+        26172ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 8 fraction bits.
+/// @note Maximum measured error is 2^-8.99036.
+template <>
+struct minimax_cos<62u, 8u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 2>{
+        4602618442195698629ll,
+        -2188387144845952846ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 16 fraction bits.
+/// @note Maximum measured error is 2^-16.5645.
+template <>
+struct minimax_cos<62u, 16u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        4611638435674390556ll,
+        -2304465517935649326ll,
+        186237554040707309ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 25 fraction bits.
+/// @note Maximum measured error is 2^-25.0448.
+template <>
+struct minimax_cos<62u, 25u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        4611685885194400907ll,
+        -2305836165954548294ll,
+        192098644535611893ll,
+        -6263768607002215ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 34 fraction bits.
+/// @note Maximum measured error is 2^-34.2123.
+template <>
+struct minimax_cos<62u, 34u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        4611686018195683365ll,
+        -2305842990632994672ll,
+        192153345671077464ll,
+        -6404048150269212ll,
+        112409906123841ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 43 fraction bits.
+/// @note Maximum measured error is 2^-43.9337.
+template <>
+struct minimax_cos<62u, 43u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 6>{
+        4611686018427113428ll,
+        -2305843009182010637ll,
+        192153583508498068ll,
+        -6405115415216774ll,
+        114364588348652ll,
+        -1252949080338ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 54 fraction bits.
+/// @note Maximum measured error is 2^-54.1174.
+template <>
+struct minimax_cos<62u, 54u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 7>{
+        4611686018427387668ll,
+        -2305843009213656930ll,
+        192153584100191667ll,
+        -6405119460905419ll,
+        114377091557495ll,
+        -1270758622897ll,
+        9512800835ll
+    };
+};
+
+/// @brief Minimax coefficients for cos(r) in z = r^2 for r in [-0.79, 0.79] with 62 fraction bits,
+///   accurate to 63 fraction bits.
+/// @note Maximum measured error is 2^-63.3939.
+template <>
+struct minimax_cos<62u, 63u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 8>{
+        4611686018427387904ll,
+        -2305843009213693921ll,
+        192153584101140103ll,
+        -6405119470024457ll,
+        114377133308010ll,
+        -1270856745196ll,
+        9627150449ll,
+        -52351926ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172].
+/// @note Primary template for working and accuracy precisions without a table.
+template <unsigned int WorkingBits, unsigned int AccuracyBits>
+struct minimax_atanh
+{
+    static constexpr auto available = false; ///< Whether there's a table.
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 30 fraction bits,
+///   accurate to 15 fraction bits.
+/// @note Maximum measured error is 2^-15.4337.
+template <>
+struct minimax_atanh<30u, 15u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 2>{
+        1073717564ll,
+        364404473ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 30 fraction bits,
+///   accurate to 22 fraction bits.
+/// @note Maximum measured error is 2^-22.9769.
+template <>
+struct minimax_atanh<30u, 22u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        1073741954ll,
+        357835436ll,
+        221749807ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 30 fraction bits,
+///   accurate to 29 fraction bits.
+/// @note Maximum measured error is 2^-29.9847.
+template <>
+struct minimax_atanh<30u, 29u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        1073741823ll,
+        357914757ll,
+        214611454ll,
+        160704317ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 30 fraction bits,
+///   accurate to 35 fraction bits.
+/// @note Maximum measured error is 2^-35.3586.
+template <>
+struct minimax_atanh<30u, 35u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        1073741824ll,
+        357913933ll,
+        214750472ll,
+        153193798ll,
+        126838131ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 62 fraction bits,
+///   accurate to 15 fraction bits.
+/// @note Maximum measured error is 2^-15.4337.
+template <>
+struct minimax_atanh<62u, 15u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 2>{
+        4611581823686124923ll,
+        1565105294613506606ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 62 fraction bits,
+///   accurate to 22 fraction bits.
+/// @note Maximum measured error is 2^-22.9773.
+template <>
+struct minimax_atanh<62u, 22u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        4611686576907019362ll,
+        1536891495853750663ll,
+        952408167966936190ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 62 fraction bits,
+///   accurate to 30 fraction bits.
+/// @note Maximum measured error is 2^-30.3977.
+template <>
+struct minimax_atanh<62u, 30u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        4611686015167319286ll,
+        1537232177631969438ll,
+        921749175642666807ll,
+        690219787265733875ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 62 fraction bits,
+///   accurate to 37 fraction bits.
+/// @note Maximum measured error is 2^-37.745.
+template <>
+struct minimax_atanh<62u, 37u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        4611686018447408656ll,
+        1537228639142581597ll,
+        922346256102645727ll,
+        657962351299554591ll,
+        544765626249852217ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 62 fraction bits,
+///   accurate to 45 fraction bits.
+/// @note Maximum measured error is 2^-45.0437.
+template <>
+struct minimax_atanh<62u, 45u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 6>{
+        4611686018427260742ll,
+        1537228673117277820ll,
+        922337082732138744ll,
+        658829629001729254ll,
+        511289209827939407ll,
+        452341365210972565ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 62 fraction bits,
+///   accurate to 52 fraction bits.
+/// @note Maximum measured error is 2^-52.3073.
+template <>
+struct minimax_atanh<62u, 52u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 7>{
+        4611686018427388731ll,
+        1537228672806399143ll,
+        922337205156148674ll,
+        658811991496548497ll,
+        512438042752045697ll,
+        417846063898913761ll,
+        388460091885893309ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 62 fraction bits,
+///   accurate to 59 fraction bits.
+/// @note Maximum measured error is 2^-59.4228.
+template <>
+struct minimax_atanh<62u, 59u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 8>{
+        4611686018427387899ll,
+        1537228672809152931ll,
+        922337203668762958ll,
+        658812292848603947ll,
+        512408962789754042ll,
+        419286776577383848ll,
+        353062383917024988ll,
+        341699844184152469ll
+    };
+};
+
+/// @brief Minimax coefficients for atanh(s) / s in z = s^2 for s in [-0.172, 0.172] with 62 fraction bits,
+///   accurate to 65 fraction bits.
+/// @note Maximum measured error is 2^-65.5549.
+template <>
+struct minimax_atanh<62u, 65u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 9>{
+        4611686018427387904ll,
+        1537228672809129100ll,
+        922337203685658141ll,
+        658812288284326061ll,
+        512409568413203740ll,
+        419243133537280723ll,
+        354804847225368679ll,
+        305471944098600663ll,
+        306015905631608302ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268].
+/// @note Primary template for working and accuracy precisions without a table.
+template <unsigned int WorkingBits, unsigned int AccuracyBits>
+struct minimax_atan
+{
+    static constexpr auto available = false; ///< Whether there's a table.
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 30 fraction bits,
+///   accurate to 13 fraction bits.
+/// @note Maximum measured error is 2^-13.0287.
+template <>
+struct minimax_atan<30u, 13u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 2>{
+        1073613330ll,
+        -343239399ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 30 fraction bits,
+///   accurate to 19 fraction bits.
+/// @note Maximum measured error is 2^-19.3621.
+template <>
+struct minimax_atan<30u, 19u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        1073740231ll,
+        -357507342ll,
+        199269133ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 30 fraction bits,
+///   accurate to 25 fraction bits.
+/// @note Maximum measured error is 2^-25.5406.
+template <>
+struct minimax_atan<30u, 25u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        1073741802ll,
+        -357904223ll,
+        214060068ll,
+        -137598187ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 30 fraction bits,
+///   accurate to 30 fraction bits.
+/// @note Maximum measured error is 2^-30.6545.
+template <>
+struct minimax_atan<30u, 30u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        1073741824ll,
+        -357913726ll,
+        214724096ll,
+        -152427429ll,
+        103416677ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 13 fraction bits.
+/// @note Maximum measured error is 2^-13.0287.
+template <>
+struct minimax_atan<62u, 13u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 2>{
+        4611134140307870803ll,
+        -1474201993725177425ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 19 fraction bits.
+/// @note Maximum measured error is 2^-19.3623.
+template <>
+struct minimax_atan<62u, 19u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 3>{
+        4611679175731074472ll,
+        -1535482340044415038ll,
+        855854407759240335ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 25 fraction bits.
+/// @note Maximum measured error is 2^-25.5737.
+template <>
+struct minimax_atan<62u, 25u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 4>{
+        4611685926081865253ll,
+        -1537186934697270680ll,
+        919380991210298563ll,
+        -590979711461219179ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 31 fraction bits.
+/// @note Maximum measured error is 2^-31.7123.
+template <>
+struct minimax_atan<62u, 31u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 5>{
+        4611686017116691880ll,
+        -1537227749460077214ll,
+        922232970204975630ll,
+        -654670824242138048ll,
+        444171247247796668ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 37 fraction bits.
+/// @note Maximum measured error is 2^-37.8026.
+template <>
+struct minimax_atan<62u, 37u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 6>{
+        4611686018408151254ll,
+        -1537228653328545242ll,
+        922334004240034534ll,
+        -658619523777337146ll,
+        507121575541944885ll,
+        -351096309467554082ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 43 fraction bits.
+/// @note Maximum measured error is 2^-43.8585.
+template <>
+struct minimax_atan<62u, 43u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 7>{
+        4611686018427098755ll,
+        -1537228672411087972ll,
+        922337114174897318ll,
+        -658804725729795403ll,
+        512104060712438681ll,
+        -412853873968631629ll,
+        286974726501918967ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 49 fraction bits.
+/// @note Maximum measured error is 2^-49.8885.
+template <>
+struct minimax_atan<62u, 49u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 8>{
+        4611686018427383479ll,
+        -1537228672801181697ll,
+        922337201342492524ll,
+        -658812024886460008ll,
+        512394972949171033ll,
+        -418803630636279662ll,
+        347298557129841344ll,
+        -240229440422774545ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 55 fraction bits.
+/// @note Maximum measured error is 2^-55.8915.
+template <>
+struct minimax_atan<62u, 55u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 9>{
+        4611686018427387835ll,
+        -1537228672808973350ll,
+        922337203627149541ll,
+        -658812279940466998ll,
+        512408949696170609ll,
+        -419219414979548476ll,
+        354148985864015094ll,
+        -298989403742149106ll,
+        204726144312520837ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 61 fraction bits.
+/// @note Maximum measured error is 2^-61.794.
+template <>
+struct minimax_atan<62u, 61u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 10>{
+        4611686018427387903ll,
+        -1537228672809126283ll,
+        922337203684081339ll,
+        -658812288096128419ll,
+        512409534727968857ll,
+        -419242981972501940ll,
+        354706526493575385ll,
+        -306675389508970109ll,
+        261855369829548188ll,
+        -176911047016952280ll
+    };
+};
+
+/// @brief Minimax coefficients for atan(t) / t in z = t^2 for t in [-0.268, 0.268] with 62 fraction bits,
+///   accurate to 66 fraction bits.
+/// @note Maximum measured error is 2^-66.8929.
+template <>
+struct minimax_atan<62u, 66u>
+{
+    static constexpr auto available = true; ///< Whether there's a table.
+    /// @brief Coefficients in order of increasing power.
+    static constexpr auto coefficients = std::array<std::int64_t, 11>{
+        4611686018427387904ll,
+        -1537228672809129244ll,
+        922337203685445194ll,
+        -658812288339689433ll,
+        512409556808576181ll,
+        -419244131417242960ll,
+        354742945516026532ll,
+        -307389423378119674ll,
+        270314026389496948ll,
+        -232380975443494104ll,
+        154583080474835353ll
+    };
+};
+
+} // namespace realnumb::detail
+
+#endif // REALNUMB_MINIMAX_HPP
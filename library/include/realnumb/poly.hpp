@@ -0,0 +1,118 @@
+#ifndef REALNUMB_POLY_HPP
+#define REALNUMB_POLY_HPP
+
+/// @file
+/// @brief Polynomial evaluation functions.
+/// @see https://en.wikipedia.org/wiki/Polynomial_evaluation
+
+#include <array> // for std::array
+#include <cmath> // for std::fma
+#include <cstddef> // for std::size_t
+
+namespace realnumb::poly {
+
+/// @brief Multiply-add operation of separately rounded multiplication and addition.
+/// @note This only needs the type's multiplication and addition operators. So it works
+///   for the fixed types, the floating point types, and SIMD lane types alike.
+struct multiply_add
+{
+    /// @brief Computes <code>a * b + c</code>.
+    template <class T>
+    constexpr auto operator()(const T& a, const T& b, const T& c) const -> T
+    {
+        return a * b + c;
+    }
+};
+
+/// @brief Multiply-add operation of a fused multiplication and addition.
+/// @note This uses the @c fma function found for the type through argument dependent
+///   lookup, or <code>std::fma</code> for the floating point types.
+/// @see https://en.cppreference.com/w/cpp/numeric/math/fma
+struct fused_multiply_add
+{
+    /// @brief Computes <code>a * b + c</code> with a single rounding.
+    template <class T>
+    constexpr auto operator()(const T& a, const T& b, const T& c) const -> T
+    {
+        using std::fma;
+        return fma(a, b, c);
+    }
+};
+
+/// @brief Converts the given coefficients to the given type.
+/// @note This is meant for compile-time use in setting up coefficients in the type that
+///   the polynomial is to be evaluated in. Like from <code>long double</code> literals.
+template <class T, class U, std::size_t N>
+constexpr auto convert(const std::array<U, N>& coefficients) -> std::array<T, N>
+{
+    auto result = std::array<T, N>{};
+    for (auto i = std::size_t{0}; i < N; ++i)
+    {
+        result[i] = T(coefficients[i]);
+    }
+    return result;
+}
+
+/// @brief Evaluates the polynomial of the given coefficients at the given value using
+///   Horner's method.
+/// @details This takes <code>N - 1</code> multiply-adds, each depending on the previous one.
+///   So this is the scheme with the fewest operations but the longest dependency chain.
+/// @param x Value to evaluate the polynomial at.
+/// @param coefficients Coefficients in order of increasing power, starting from the
+///   constant term.
+/// @param op Multiply-add operation to use.
+/// @see https://en.wikipedia.org/wiki/Horner%27s_method
+template <class T, std::size_t N, class MultiplyAdd = multiply_add>
+constexpr auto horner(const T& x, const std::array<T, N>& coefficients,
+                      MultiplyAdd op = MultiplyAdd{}) -> T
+{
+    static_assert(N > 0u, "polynomial needs at least one coefficient");
+    auto result = coefficients[N - 1u];
+    for (auto i = N - 1u; i > 0u; --i)
+    {
+        result = op(result, x, coefficients[i - 1u]);
+    }
+    return result;
+}
+
+/// @brief Evaluates the polynomial of the given coefficients at the given value using
+///   Estrin's scheme.
+/// @details This pairs up the terms as <code>c[2i] + c[2i+1] x</code>, then pairs those up
+///   with <code>x^2</code>, then with <code>x^4</code>, and so on. The pairings within each
+///   level are independent of each other so they can execute in parallel. That shortens
+///   the dependency chain to about <code>log2(N)</code> multiply-adds at the cost of
+///   computing the squared powers of the value.
+/// @param x Value to evaluate the polynomial at.
+/// @param coefficients Coefficients in order of increasing power, starting from the
+///   constant term.
+/// @param op Multiply-add operation to use.
+/// @see https://en.wikipedia.org/wiki/Estrin%27s_scheme
+template <class T, std::size_t N, class MultiplyAdd = multiply_add>
+constexpr auto estrin(const T& x, const std::array<T, N>& coefficients,
+                      MultiplyAdd op = MultiplyAdd{}) -> T
+{
+    static_assert(N > 0u, "polynomial needs at least one coefficient");
+    auto terms = coefficients;
+    auto power = x;
+    for (auto n = N; n > 1u; n = (n + 1u) / 2u)
+    {
+        for (auto i = std::size_t{0}; i < n / 2u; ++i)
+        {
+            terms[i] = op(terms[2u * i + 1u], power, terms[2u * i]);
+        }
+        if (n % 2u != 0u)
+        {
+            terms[n / 2u] = terms[n - 1u];
+        }
+        if (n > 2u)
+        {
+            // Squares through the operation too for any scaling that it does...
+            power = op(power, power, T{});
+        }
+    }
+    return terms[0];
+}
+
+} // namespace realnumb::poly
+
+#endif // REALNUMB_POLY_HPP
@@ -0,0 +1,109 @@
+#ifndef REALNUMB_TABULATED_HPP
+#define REALNUMB_TABULATED_HPP
+
+/// @file
+/// @brief Exhaustively tabulated unary functions of the 16-bit fixed types.
+/// @details A 16-bit fixed type has only 65536 values. So any unary function of one can
+///   be tabulated for every value in a table of 128 KiB, after which evaluating the
+///   function is a single load.
+
+#include <array> // for std::array
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint16_t
+#include <type_traits> // for std::is_same_v
+
+#include <realnumb/fixed.hpp>
+
+namespace realnumb {
+
+/// @brief Tabulation strategy of building the table the first time it's needed.
+/// @details The table is built in a function-local static variable. So its one-time
+///   initialization is thread-safe.
+struct at_first_use {};
+
+/// @brief Tabulation strategy of building the table at compile time.
+/// @note This evaluates the function for every value at compile time. That takes the
+///   compiler seconds per table and may need its constant expression evaluation limits
+///   raised, like GCC's <code>-fconstexpr-ops-limit</code>.
+struct at_compile_time {};
+
+/// @brief Exhaustively tabulated unary function of a 16-bit fixed type.
+/// @details Constructing one of these makes sure the table is built. Calling it is then
+///   a single load from the table, indexed by the argument's internal value.
+/// @note The function is given by address, like <code>tabulated<fixed16, &sin></code>.
+///   That picks the function of the given type from an overload set like the math
+///   functions' by way of the function pointer's type.
+/// @tparam T 16-bit fixed type.
+/// @tparam Function Function to tabulate. This must be @c constexpr for the
+///   @c at_compile_time strategy.
+/// @tparam When Tabulation strategy, like @c at_first_use or @c at_compile_time.
+/// @see fixed16.
+template <class T, T (*Function)(T), class When = at_first_use>
+class tabulated
+{
+public:
+    static_assert(sizeof(T) == 2u, "only 16-bit types can be exhaustively tabulated");
+    static_assert(std::is_same_v<When, at_first_use> || std::is_same_v<When, at_compile_time>,
+                  "unknown tabulation strategy");
+
+    /// @brief Value type.
+    using value_type = T;
+
+    /// @brief Number of values of the value type and so of entries in the table.
+    static constexpr auto size = std::size_t{1} << 16u;
+
+    /// @brief Table type.
+    /// @note Entries are the internal values of the function's results, indexed by the
+    ///   arguments' internal values reinterpreted as unsigned.
+    using table_type = std::array<decltype(T{}.get_value()), size>;
+
+    /// @brief Builds the table by evaluating the function for every value.
+    static constexpr auto make_table() noexcept -> table_type
+    {
+        auto result = table_type{};
+        for (auto i = std::size_t{0}; i < size; ++i)
+        {
+            const auto arg = T::from_value(static_cast<decltype(T{}.get_value())>(i));
+            result[i] = Function(arg).get_value();
+        }
+        return result;
+    }
+
+    /// @brief Gets the table, building it first if it hasn't been built already.
+    static auto table() noexcept -> const table_type&
+    {
+        if constexpr (std::is_same_v<When, at_compile_time>)
+        {
+            return compiled_table;
+        }
+        else
+        {
+            static const auto instance = make_table();
+            return instance;
+        }
+    }
+
+    /// @brief Default constructor.
+    /// @details Gets the table, building it first if it hasn't been built already.
+    tabulated() noexcept: m_table{&table()}
+    {
+        // Intentionally empty.
+    }
+
+    /// @brief Gets the function's result for the given argument from the table.
+    auto operator()(value_type arg) const noexcept -> value_type
+    {
+        return T::from_value((*m_table)[static_cast<std::uint16_t>(arg.get_value())]);
+    }
+
+private:
+    /// @brief Table built at compile time.
+    /// @note This is only instantiated for the @c at_compile_time strategy.
+    static constexpr table_type compiled_table = make_table();
+
+    const table_type* m_table; ///< Table.
+};
+
+}
+
+#endif /* REALNUMB_TABULATED_HPP */
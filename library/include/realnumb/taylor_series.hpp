@@ -3,50 +3,436 @@
 
 /// @file
 /// @brief Taylor series functions.
+/// @details These are written with comparisons and blends rather than branches on
+///   values. So they work for SIMD lane types like <code>fixed_simd</code> and
+///   <code>std::experimental::simd</code> as well as for scalar types, evaluating every
+///   lane of their argument per call. For fixed types, they evaluate the series in a
+///   wider working type and round the result just once, whatever the accuracy tier. With
+///   the @c round_each_step tag instead, like <code>sin<8, round_each_step>(x)</code>,
+///   they evaluate the series in their argument's type. That's several times faster but
+///   much less accurate.
 /// @see https://en.wikipedia.org/wiki/Taylor_series
 
+#include <array> // for std::array
 #include <cassert> // for assert
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <type_traits> // for std::enable_if_t, std::is_floating_point_v, std::conditional_t, std::is_same_v
 
+#include <realnumb/accuracy.hpp> // for realnumb::precise
+#include <realnumb/fixed.hpp>
+#include <realnumb/fixed_math.hpp> // for realnumb::detail::reciprocal_factorials
+#include <realnumb/fixed_simd.hpp>
 #include <realnumb/numbers.hpp>
 #include <realnumb/is_arithmetic.hpp> // for is_arithmetic_v
-#include <realnumb/math.hpp> // for realnumb::abs
+#include <realnumb/math.hpp> // for realnumb::abs, realnumb::select
 
 namespace realnumb::taylor_series {
 
+/// @brief Tag to give the series functions in place of an accuracy tier to evaluate the
+///   series in the argument's type, rounding at every step.
+/// @note This isn't an accuracy tier since it's not within the bounds of any of them. For
+///   fixed32 values from -3 to 3, it gave errors of about two ulps for @c sin and
+///   @c cos, and of about 20 for @c exp.
+struct round_each_step
+{
+};
+
+namespace detail {
+
+/// @brief Coefficient traits of the series functions for the given type.
+/// @details Coefficients are stored in the given type itself and the series terms get
+///   multiplied by them.
+template <class T, class = void>
+struct coefficient
+{
+    /// @brief Type the coefficients are stored in.
+    using type = T;
+
+    /// @brief Multiplies the given value by the given coefficient.
+    static constexpr auto multiply(T value, type c) -> T
+    {
+        return value * c;
+    }
+};
+
+/// @brief Coefficient traits of the series functions for fixed types.
+/// @details Coefficients are stored in the base type with all but two of its bits as
+///   fraction bits, whatever the fixed type's number of fraction bits. Multiplying by
+///   one then rounds just once and small coefficients don't lose their precision.
+template <typename BT, unsigned int FB>
+struct coefficient<fixed<BT, FB>>
+{
+    /// @brief Type the coefficients are stored in.
+    using type = BT;
+
+    /// @brief Number of fraction bits of the stored coefficients.
+    static constexpr auto fraction_bits = fixed<BT, FB>::total_bits - 2u;
+
+    /// @brief Multiplies the given value by the given coefficient.
+    /// @note The result is rounded to nearest with halfway cases away from zero.
+    ///   Non-finite values are returned as is.
+    static constexpr auto multiply(fixed<BT, FB> value, type c) -> fixed<BT, FB>
+    {
+        using wider_type = typename realnumb::detail::wider<BT>::type;
+        if (!value.isfinite())
+        {
+            return value;
+        }
+        constexpr auto half = wider_type{1} << (fraction_bits - 1u);
+        const auto product = wider_type{value.get_value()} * c;
+        const auto result = (product < 0) // newline!
+            ? -((half - product) >> fraction_bits) // newline!
+            : (product + half) >> fraction_bits;
+        return fixed<BT, FB>::from_value(static_cast<BT>(result));
+    }
+};
+
+/// @brief Coefficient traits of the series functions for SIMD lane types of fixed types.
+/// @details Coefficients are stored like they are for the lanes' fixed type and each
+///   lane gets multiplied by them in the same way.
+template <class T, std::size_t N>
+struct coefficient<fixed_simd<T, N>>
+{
+    /// @brief Type the coefficients are stored in.
+    using type = typename coefficient<T>::type;
+
+    /// @brief Number of fraction bits of the stored coefficients.
+    static constexpr auto fraction_bits = coefficient<T>::fraction_bits;
+
+    /// @brief Multiplies the given value by the given coefficient.
+    /// @note This rounds like the lanes' fixed type's multiply does, but without branches.
+    static constexpr auto multiply(const fixed_simd<T, N>& value, type c) -> fixed_simd<T, N>
+    {
+        using raw_type = typename fixed_simd<T, N>::raw_type;
+        using wider_type = typename realnumb::detail::wider<raw_type>::type;
+        constexpr auto half = wider_type{1} << (fraction_bits - 1u);
+        constexpr auto ninf = T::get_negative_infinity().get_value();
+        constexpr auto pinf = T::get_positive_infinity().get_value();
+        const auto& values = value.get_values();
+        auto result = typename fixed_simd<T, N>::values_type{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            const auto v = values[i];
+            const auto product = wider_type{v} * c;
+            const auto sign = -static_cast<wider_type>(product < 0);
+            const auto magnitude = (product ^ sign) - sign;
+            const auto rounded = static_cast<raw_type>((((magnitude + half) >> fraction_bits) ^ sign) - sign);
+            result[i] = ((v > ninf) && (v < pinf))? rounded: v;
+        }
+        return fixed_simd<T, N>::from_values(result);
+    }
+};
+
+/// @brief Coefficient traits of the series functions for SIMD lane types of floating
+///   point types, like <code>std::experimental::simd<float></code>.
+/// @details Coefficients are stored in the lanes' type and broadcast to multiply by.
+template <class T>
+struct coefficient<T, std::enable_if_t<std::is_floating_point_v<typename T::value_type>>>
+{
+    /// @brief Type the coefficients are stored in.
+    using type = typename T::value_type;
+
+    /// @brief Multiplies the given value by the given coefficient.
+    static constexpr auto multiply(const T& value, type c) -> T
+    {
+        return value * T(c);
+    }
+};
+
+/// @brief Converts the given constant to the given type.
+/// @note SIMD lane types of floating point types are only constructible from values that
+///   convert to their lanes' type without loss. So for them the value is converted to the
+///   lanes' type first.
+template <class T, class U>
+constexpr auto constant(U value) -> T
+{
+    using lane_type = typename coefficient<T>::type;
+    if constexpr (std::is_floating_point_v<lane_type> && !std::is_same_v<lane_type, T>)
+    {
+        return T(static_cast<lane_type>(value));
+    }
+    else
+    {
+        return T(value);
+    }
+}
+
+/// @brief Working type traits of the series functions for evaluating in the given type
+///   itself.
+template <class T>
+struct unwidened
+{
+    /// @brief Type the series get evaluated in.
+    using type = T;
+
+    /// @brief Converts the given value to the working type.
+    static constexpr auto to(const T& value) -> type
+    {
+        return value;
+    }
+
+    /// @brief Converts the given value from the working type.
+    static constexpr auto from(const type& value) -> T
+    {
+        return value;
+    }
+
+    /// @brief Gets the magnitude below which terms can't change the result for the given
+    ///   accuracy tier.
+    template <class Tier>
+    static constexpr auto negligible() -> type
+    {
+        return type();
+    }
+};
+
+/// @brief Working type traits of the series functions for the given type.
+/// @details The series functions evaluate their terms and sums in the working type and
+///   convert the result back just once. For most types, that's the type itself.
+template <class T, class = void>
+struct working: unwidened<T>
+{
+};
+
+/// @brief Working type traits of the series functions for fixed types having a wider
+///   type whose arithmetic has a wider type too.
+/// @details The working type has twice the bits, two more integer bits, and the rest as
+///   guard bits below the fixed type's fraction bits. So the terms and sums don't
+///   round to the fixed type's resolution at every step, and terms too small for the
+///   accuracy tier can be dropped.
+template <typename BT, unsigned int FB>
+struct working<fixed<BT, FB>, std::void_t<typename realnumb::detail::wider<
+    typename realnumb::detail::wider<BT>::type>::type>>
+{
+    /// @brief Number of bits below the fixed type's fraction bits.
+    /// @note That's all of the wider type's extra bits except for the two extra integer
+    ///   bits, whatever the fixed type's number of fraction bits.
+    static constexpr auto guard_bits = fixed<BT, FB>::total_bits - 2u;
+    static_assert(guard_bits >= 4u, "too few guard bits for the negligible terms");
+
+    /// @brief Type the series get evaluated in.
+    using type = fixed<typename realnumb::detail::wider<BT>::type, FB + guard_bits>;
+
+    /// @brief Converts the given value to the working type.
+    /// @note This is exact.
+    static constexpr auto to(fixed<BT, FB> value) -> type
+    {
+        using wider_type = typename realnumb::detail::wider<BT>::type;
+        if (value.isnan())
+        {
+            return type::get_nan();
+        }
+        if (!value.isfinite())
+        {
+            return (value < fixed<BT, FB>{})? type::get_negative_infinity(): type::get_positive_infinity();
+        }
+        return type::from_value(wider_type{value.get_value()} * (wider_type{1} << guard_bits));
+    }
+
+    /// @brief Converts the given value from the working type.
+    /// @return Value rounded to nearest with halfway cases away from zero, that saturates
+    ///   to the infinities.
+    static constexpr auto from(type value) -> fixed<BT, FB>
+    {
+        constexpr auto half = decltype(value.get_value()){1} << (guard_bits - 1u);
+        if (value.isnan())
+        {
+            return fixed<BT, FB>::get_nan();
+        }
+        if (!value.isfinite())
+        {
+            return (value < type{})? fixed<BT, FB>::get_negative_infinity(): fixed<BT, FB>::get_positive_infinity();
+        }
+        const auto v = value.get_value();
+        const auto rounded = (v < 0)? -((half - v) >> guard_bits): (v + half) >> guard_bits;
+        if (rounded > fixed<BT, FB>::get_max().get_value())
+        {
+            return fixed<BT, FB>::get_positive_infinity();
+        }
+        if (rounded < fixed<BT, FB>::get_lowest().get_value())
+        {
+            return fixed<BT, FB>::get_negative_infinity();
+        }
+        return fixed<BT, FB>::from_value(static_cast<BT>(rounded));
+    }
+
+    /// @brief Gets the magnitude below which terms can't change the result for the given
+    ///   accuracy tier.
+    /// @details That's two bits below what the tier's accuracy needs, or the working
+    ///   type's resolution if that's coarser. So the @c precise tier keeps terms down to
+    ///   <code>2^-14</code> of the fixed type's resolution, and the @c balanced tier down
+    ///   to a sixteenth of it.
+    template <class Tier>
+    static constexpr auto negligible() -> type
+    {
+        constexpr auto shift = static_cast<int>(guard_bits) - Tier::guard_bits - 2;
+        return type::from_value(decltype(type{}.get_value()){1} << ((shift > 0)? shift: 0));
+    }
+};
+
+/// @brief Working type traits of the series functions for SIMD lane types of fixed types
+///   whose own working type is wider.
+/// @details Every lane gets converted like it is for the lanes' fixed type.
+template <class T, std::size_t N>
+struct working<fixed_simd<T, N>, std::enable_if_t<!std::is_same_v<typename working<T>::type, T>>>
+{
+    /// @brief Type the series get evaluated in.
+    using type = fixed_simd<typename working<T>::type, N>;
+
+    /// @brief Converts the given value to the working type.
+    static constexpr auto to(const fixed_simd<T, N>& value) -> type
+    {
+        auto result = std::array<typename working<T>::type, N>{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            result[i] = working<T>::to(value[i]);
+        }
+        return type(result);
+    }
+
+    /// @brief Converts the given value from the working type.
+    static constexpr auto from(const type& value) -> fixed_simd<T, N>
+    {
+        auto result = std::array<T, N>{};
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            result[i] = working<T>::from(value[i]);
+        }
+        return fixed_simd<T, N>(result);
+    }
+
+    /// @brief Gets the magnitude below which terms can't change the result for the given
+    ///   accuracy tier.
+    template <class Tier>
+    static constexpr auto negligible() -> type
+    {
+        return type(working<T>::template negligible<Tier>());
+    }
+};
+
+/// @brief Working type traits of the series functions for the given accuracy tier or
+///   @c round_each_step tag.
+/// @details The accuracy tiers evaluate the series in the type's working type, since the
+///   term count rather than the tier sets how accurate they are. The tag evaluates them in
+///   the type itself.
+template <class Tier, class T>
+using tier_working = std::conditional_t<std::is_same_v<Tier, round_each_step>, unwidened<T>, working<T>>;
+
+/// @brief Gets the reciprocals of the factorials from <code>0!</code> up to but not
+///   including <code>N!</code> as coefficients for the given type.
+/// @note Floating point coefficients come from dividing by each number in turn, so
+///   there's no overflowing of the factorials for any table size. Integer coefficients
+///   come from the fixed math functions' table in the wider type. That's correctly
+///   rounded and only goes as far as the factorials that don't round to zero.
+template <class T, std::size_t N>
+constexpr auto reciprocal_factorials() noexcept
+{
+    using type = typename coefficient<T>::type;
+    auto result = std::array<type, N>{};
+    if constexpr (std::is_floating_point_v<type>)
+    {
+        auto value = 1.0L;
+        for (auto i = std::size_t{0}; i < N; ++i)
+        {
+            if (i > 1u)
+            {
+                value /= static_cast<long double>(i);
+            }
+            result[i] = static_cast<type>(value);
+        }
+    }
+    else
+    {
+        using wider_type = typename realnumb::detail::wider<type>::type;
+        constexpr auto one = wider_type{1} << coefficient<T>::fraction_bits;
+        constexpr auto nonzero = [one]() {
+            auto count = std::size_t{0};
+            for (auto factorial = wider_type{1}; (count < N) && (factorial <= (one << 1u));)
+            {
+                ++count;
+                factorial *= static_cast<wider_type>(count);
+            }
+            return count;
+        }();
+        constexpr auto table = realnumb::detail::reciprocal_factorials<wider_type, nonzero>(one);
+        for (auto i = std::size_t{0}; i < nonzero; ++i)
+        {
+            result[i] = static_cast<type>(table[i]);
+        }
+    }
+    return result;
+}
+
+/// @brief Gets the reciprocals of the numbers from zero up to but not including @c N as
+///   coefficients for the given type.
+/// @note The element for zero is zero as there's no reciprocal of zero. Integer
+///   coefficients are correctly rounded.
+template <class T, std::size_t N>
+constexpr auto reciprocals() noexcept
+{
+    using type = typename coefficient<T>::type;
+    auto result = std::array<type, N>{};
+    for (auto i = std::size_t{1}; i < N; ++i)
+    {
+        if constexpr (std::is_floating_point_v<type>)
+        {
+            result[i] = static_cast<type>(1.0L / static_cast<long double>(i));
+        }
+        else
+        {
+            constexpr auto one = type{1} << coefficient<T>::fraction_bits;
+            const auto divisor = static_cast<type>(i);
+            result[i] = static_cast<type>((one + divisor / 2) / divisor);
+        }
+    }
+    return result;
+}
+
+} // namespace detail
+
 /// @brief Computes Euler's number raised to the given power argument.
 /// @note Uses Maclaurin approximation.
+/// @tparam Tier Accuracy tier, which evaluates the series in the working type and rounds
+///   just once, or @c round_each_step to evaluate it in the argument's type.
+/// @see detail::working.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/exp
 /// @see https://en.wikipedia.org/wiki/Exponentiation
 /// @see https://en.wikipedia.org/wiki/Exponential_function
-template <int N, class T>
+template <int N, class Tier = precise, class T>
 constexpr auto exp(T arg) -> std::enable_if_t<is_arithmetic_v<T>, T>
 {
-    const auto doReciprocal = (arg < 0);
-    if (doReciprocal)
-    {
-        arg = -arg;
-    }
+    using working = detail::tier_working<Tier, T>;
+    using W = typename working::type;
+    auto x = working::to(arg);
+    const auto doReciprocal = (x < W());
+    x = select(doReciprocal, -x, x);
     // Maclaurin series approximation...
     // e^x = sum(x^n/n!) for n =0 to infinity.
     // e^x = 1 + x + x^2/2! + x^3/3! + ...
     // Note: e^(x+y) = e^x * e^y.
-    // Note: convergence is slower for arg > 2 and overflow happens by i == 9
-    auto res = arg + 1;
-    auto last = arg;
-    for (auto i = 2; (last != 0) && (i < N); ++i)
+    // Note: convergence is slower for arg > 2.
+    constexpr auto reciprocals = detail::reciprocals<W, (N > 2)? static_cast<std::size_t>(N): std::size_t{2}>();
+    const auto negligible = working::template negligible<Tier>();
+    auto res = x + W(1);
+    auto last = x;
+    for (auto i = 2; any_of(last > negligible) && (i < N); ++i)
     {
         // have to avoid unnecessarily overflowing...
-        last /= i; // for factorial
-        last *= arg;
+        last = detail::coefficient<W>::multiply(last, reciprocals[i]); // for factorial
+        last *= x;
         res += last;
     }
-    return doReciprocal? 1 / res: res;
+    return working::from(select(doReciprocal, W(1) / res, res));
 }
 
 /// @brief Computes the sine of the given angle via Maclaurin series approximation.
 /// @param arg Angle in radians.
 /// @note Most accurate for angles between −π/2 and π/2.
-template <int N, class T>
+/// @tparam Tier Accuracy tier, which evaluates the series in the working type and rounds
+///   just once, or @c round_each_step to evaluate it in the argument's type.
+/// @see detail::working.
+template <int N, class Tier = precise, class T>
 constexpr auto sin(T arg) -> std::enable_if_t<is_arithmetic_v<T>, T>
 {
     // Maclaurin series approximation...
@@ -57,41 +443,44 @@ constexpr auto sin(T arg) -> std::enable_if_t<is_arithmetic_v<T>, T>
     // 2 - 8/6 + 32/120 = 0.9333
     // 2 - 8/6 + 32/120 - 128/5040 = 0.90793650793
     // 2 - 8/6 + 32/120 - 128/5040 + 512/362880 = 0.90934744268
-    auto res = arg;
+    using working = detail::tier_working<Tier, T>;
+    using W = typename working::type;
+    using mask_type = decltype(W() < W());
+    const auto x = working::to(arg);
+    const auto negligible = working::template negligible<Tier>();
+    auto res = x;
     auto sgn = -1;
     constexpr auto last = 2 * N + 1;
-    auto pt = arg;
-    auto ft = 1;
-#ifndef NDEBUG
-    auto last_ft = ft;
-#endif
-    auto last_term = T(7); // more than 2 Pi radian
+    constexpr auto factorials = detail::reciprocal_factorials<W, std::size_t{last} + 1u>();
+    auto pt = x;
+    auto last_term = W(7); // more than 2 Pi radian
+    auto active = mask_type(true); // lanes whose terms are still getting smaller
     for (auto i = 3; i <= last; i += 2)
     {
-        ft *= (i - 1) * i;
-#ifndef NDEBUG
-        assert(ft > last_ft); // confirm no overflow of ft
-        last_ft = ft;
-#endif
-        pt *= arg * arg;
-        const auto term = pt / ft;
-        if (abs(term) >= abs(last_term)) {
+        pt *= x * x;
+        const auto term = detail::coefficient<W>::multiply(pt, factorials[i]);
+        active = active && !(abs(term) >= abs(last_term)) && !(abs(term) < negligible);
+        if (none_of(active)) {
             break;
         }
-        last_term = term;
-        res += sgn * term;
+        last_term = select(active, term, last_term);
+        res += select(active, (sgn < 0)? -term: term, W());
         sgn = -sgn;
     }
+    const auto result = working::from(res);
 #ifndef NDEBUG
-    assert(res >= T(-1));
-    assert(res <= T(+1));
+    assert(all_of(result >= T(-1)));
+    assert(all_of(result <= T(+1)));
 #endif
-    return res;
+    return result;
 }
 
 /// @brief Computes the cosine of the given argument via Maclaurin series approximation.
 /// @param arg Angle in radians.
-template <int N, class T>
+/// @tparam Tier Accuracy tier, which evaluates the series in the working type and rounds
+///   just once, or @c round_each_step to evaluate it in the argument's type.
+/// @see detail::working.
+template <int N, class Tier = precise, class T>
 constexpr auto cos(T arg) -> std::enable_if_t<is_arithmetic_v<T>, T>
 {
     // Maclaurin series approximation...
@@ -100,64 +489,73 @@ constexpr auto cos(T arg) -> std::enable_if_t<is_arithmetic_v<T>, T>
     // 1 - 2^2/2 = -1
     // 1 - 2^2/2 + 2^4/24 = -0.3333
     // 1 - 2^2/2 + 2^4/24 - 2^6/720 = -0.422
-    auto res = T(1);
+    using working = detail::tier_working<Tier, T>;
+    using W = typename working::type;
+    using mask_type = decltype(W() < W());
+    const auto x = working::to(arg);
+    const auto negligible = working::template negligible<Tier>();
+    auto res = W(1);
     auto sgn = -1;
     constexpr auto last = 2 * N;
-    auto ft = 1;
-    auto pt = T(1);
-    auto last_term = T(7);
+    constexpr auto factorials = detail::reciprocal_factorials<W, std::size_t{last} + 1u>();
+    auto pt = W(1);
+    auto last_term = W(7);
+    auto active = mask_type(true); // lanes whose terms are still getting smaller
     for (auto i = 2; i <= last; i += 2)
     {
-        ft *= (i - 1) * i;
-        pt *= arg * arg;
-        const auto term = pt / ft;
-        if (abs(term) >= abs(last_term)) {
+        pt *= x * x;
+        const auto term = detail::coefficient<W>::multiply(pt, factorials[i]);
+        active = active && !(abs(term) >= abs(last_term)) && !(abs(term) < negligible);
+        if (none_of(active)) {
             break;
         }
-        last_term = term;
-        res += sgn * term;
+        last_term = select(active, term, last_term);
+        res += select(active, (sgn < 0)? -term: term, W());
         sgn = -sgn;
     }
+    const auto result = working::from(res);
 #ifndef NDEBUG
-    assert(res >= T(-1));
-    assert(res <= T(+1));
+    assert(all_of(result >= T(-1)));
+    assert(all_of(result <= T(+1)));
 #endif
-    return res;
+    return result;
 }
 
 /// @brief Computes the arctangent of the given argument via Maclaurin series approximation.
+/// @tparam Tier Accuracy tier, which evaluates the series in the working type and rounds
+///   just once, or @c round_each_step to evaluate it in the argument's type.
+/// @note This sums all its terms, so its accuracy comes from the term count alone. The
+///   series converges slowly for arguments of magnitudes near one.
+/// @see detail::working.
 /// @see https://en.cppreference.com/w/cpp/numeric/math/atan
-template <int N, class T>
+template <int N, class Tier = precise, class T>
 constexpr auto atan(T arg) -> std::enable_if_t<is_arithmetic_v<T>, T>
 {
     // Note: if (x > 0) then arctan(x) ==  Pi/2 - arctan(1/x)
     //       if (x < 0) then arctan(x) == -Pi/2 - arctan(1/x).
-    const auto doReciprocal = (abs(arg) > T(1));
-    if (doReciprocal)
-    {
-        arg = 1 / arg;
-    }
+    using working = detail::tier_working<Tier, T>;
+    using W = typename working::type;
+    auto x = working::to(arg);
+    const auto doReciprocal = (abs(x) > W(1));
+    // Divides by one instead in the other lanes, which may be of zero.
+    x = select(doReciprocal, W(1) / select(doReciprocal, x, W(1)), x);
     // Maclaurin series approximation...
     // For |arg| <= 1, arg != +/- i
     // If |arg| > 1 the result is too wrong which is why the reciprocal is done then.
-    auto res = arg;
+    auto res = x;
     auto sgn = -1;
-    const auto last = 2 * N + 1;
-    auto pt = arg;
+    constexpr auto last = 2 * N + 1;
+    constexpr auto reciprocals = detail::reciprocals<W, std::size_t{last} + 1u>();
+    auto pt = x;
     for (auto i = 3; i <= last; i += 2)
     {
-        pt *= arg * arg;
-        const auto term = pt / i;
-        res += sgn * term;
+        pt *= x * x;
+        const auto term = detail::coefficient<W>::multiply(pt, reciprocals[i]);
+        res += W(sgn) * term;
         sgn = -sgn;
     }
-    if (doReciprocal)
-    {
-        return (arg > 0) // newline!
-            ? +T(realnumb::numbers::pi) / 2 - res // newline!
-            : -T(realnumb::numbers::pi) / 2 - res;
-    }
-    return res;
+    const auto half_pi = detail::constant<W>(realnumb::numbers::pi) / W(2);
+    return working::from(select(doReciprocal, select(x > W(), half_pi - res, -half_pi - res), res));
 }
 
 }
@@ -0,0 +1,598 @@
+#ifndef REALNUMB_UFIXED_HPP
+#define REALNUMB_UFIXED_HPP
+
+/// @file
+/// @brief Definition of the @c ufixed class and closely related code.
+
+#include <cassert> // for assert macro
+#include <cstdint> // for types like std::uint32_t
+#include <limits> // for std::numeric_limits
+#include <type_traits> // for std::enable_if_t and more
+#include <iostream>
+#include <utility> // for std::forward
+
+#include <realnumb/fixed.hpp>
+
+namespace realnumb {
+namespace detail {
+
+/// @brief Rescales the given non-negative internal value between numbers of fraction bits.
+/// @details Shifts left to more fraction bits or right to fewer, rounding half upwards.
+/// @return The rescaled value, or one more than the given max if it's greater than that.
+///   That's the internal form of positive infinity for both the @c fixed and @c ufixed
+///   types.
+template <typename R, typename U>
+constexpr auto rescale(U value, unsigned int from_bits, unsigned int to_bits, R max) noexcept -> R
+{
+    // Takes unsigned types, or the limbs types standing in for wider ones...
+    static_assert(!std::is_signed_v<R> && !std::is_signed_v<U>);
+    if (from_bits > to_bits)
+    {
+        const auto n = from_bits - to_bits;
+        const auto result = static_cast<U>(static_cast<U>((value >> (n - 1u)) + 1u) >> 1u);
+        return (result > max)? static_cast<R>(max + 1u): static_cast<R>(result);
+    }
+    const auto n = to_bits - from_bits;
+    const auto limit = (n < static_cast<unsigned int>(std::numeric_limits<R>::digits))
+        ? static_cast<R>(max >> n): R{0};
+    return (value > limit)? static_cast<R>(max + 1u):
+        (value == 0u)? R{0}: static_cast<R>(static_cast<R>(value) << n);
+}
+
+} // namespace detail
+
+/// @brief Template class for unsigned fixed-point real-like numbers.
+/// @details This is a fixed point type of the given unsigned base type using the given
+///   number of fraction bits. Having no sign bit, it has one more bit of precision or range
+///   than the @c fixed type of the same size. It's for values that are never negative, like
+///   magnitudes, distances and probabilities.
+/// @note Its top two values are reserved for NaN and for positive infinity. Having no
+///   negative values, results that would be negative saturate to zero.
+/// @note Since its values are never negative, checking whether a value is finite is one
+///   comparison and the shifts need no sign handling.
+/// @see fixed.
+/// @see https://en.wikipedia.org/wiki/Q_(number_format)
+template <typename BaseType, unsigned int FractionBits>
+class ufixed
+{
+public:
+
+    /// @brief Value type.
+    using value_type = BaseType;
+
+    static_assert(std::is_integral_v<value_type> && std::is_unsigned_v<value_type>);
+
+    /// @brief Bits per byte.
+    static constexpr auto bits_per_byte = 8u;
+
+    /// @brief Total number of bits.
+    static constexpr auto total_bits = static_cast<unsigned int>(sizeof(BaseType) * bits_per_byte);
+
+    /// @brief Fraction bits.
+    static constexpr auto fraction_bits = FractionBits;
+
+    static_assert(fraction_bits <= total_bits);
+
+    /// @brief Whole value bits.
+    static constexpr auto whole_bits = total_bits - fraction_bits;
+
+    /// @brief Scale factor.
+    /// @note This is of the wider type for formats without whole bits, like
+    ///   <code>ufixed<std::uint16_t, 16></code>, since the value type can't hold it.
+    static constexpr auto scale_factor = [] {
+        using type = std::conditional_t<(whole_bits > 0u), value_type, typename detail::wider<value_type>::type>;
+        return static_cast<type>(type{1} << fraction_bits);
+    }();
+
+    /// @brief Gets the min value this type is capable of expressing.
+    static constexpr auto get_min() noexcept -> ufixed
+    {
+        return from_value(1);
+    }
+
+    /// @brief Gets a NaN value for this type.
+    static constexpr auto get_nan() noexcept -> ufixed
+    {
+        return from_value(numeric_limits::max());
+    }
+
+    /// @brief Gets an infinite value for this type.
+    static constexpr auto get_positive_infinity() noexcept -> ufixed
+    {
+        // max reserved for NaN
+        return from_value(numeric_limits::max() - 1u);
+    }
+
+    /// @brief Gets the max value this type is capable of expressing.
+    static constexpr auto get_max() noexcept -> ufixed
+    {
+        // max reserved for NaN
+        // max - 1 reserved for +inf
+        return from_value(numeric_limits::max() - 2u);
+    }
+
+    /// @brief Gets the lowest value this type is capable of expressing.
+    /// @note This is zero.
+    static constexpr auto get_lowest() noexcept -> ufixed
+    {
+        return from_value(0);
+    }
+
+    /// @brief Gets the value from a floating point value.
+    /// @details Negative values, including negative infinity, saturate to zero.
+    template <typename T>
+    static constexpr auto to_value(T val) noexcept
+        -> std::enable_if_t<std::is_floating_point_v<T>, value_type>
+    {
+        // Note: std::isnan(val) *NOT* constant expression, so can't use here!
+        return !(val <= 0 || val >= 0) // NOLINT(misc-redundant-expression)
+            ? get_nan().m_value // newline!
+            : (static_cast<long double>(val) > static_cast<long double>(get_max())) // newline!
+                ? get_positive_infinity().m_value // newline!
+                : (val < 0) // newline!
+                    ? value_type{0} // newline!
+                    : static_cast<value_type>(static_cast<long double>(val) * scale_factor);
+    }
+
+    /// @brief Gets the value from a signed integral value.
+    /// @details Negative values saturate to zero.
+    template <typename T>
+    static constexpr auto to_value(T val) noexcept
+        -> std::enable_if_t<std::is_integral_v<T> && std::is_signed_v<T>, value_type>
+    {
+        return (val < 0)? value_type{0}: to_value(static_cast<std::make_unsigned_t<T>>(val));
+    }
+
+    /// @brief Gets the value from an unsigned integral value.
+    template <typename T>
+    static constexpr auto to_value(T val) noexcept
+        -> std::enable_if_t<std::is_integral_v<T> && !std::is_signed_v<T>, value_type>
+    {
+        return detail::rescale(val, 0u, fraction_bits, get_max().m_value);
+    }
+
+    ufixed() = default;
+
+    /// @brief Initializing constructor from any arithmetic type.
+    template <class U, std::enable_if_t<std::is_arithmetic_v<std::decay_t<U>>, int> = 0>
+    constexpr ufixed(U&& val) noexcept:
+        m_value{to_value(std::forward<U>(val))}
+    {
+        // Intentionally empty
+    }
+
+    /// @brief Copy constructor for copying from any unsigned fixed type.
+    /// @details This shifts the value to this type's fraction bits, rounding half upwards.
+    template <typename BT, unsigned int FB>
+    constexpr ufixed(const ufixed<BT, FB> val) noexcept:
+        m_value{val.isnan()? get_nan().m_value: !val.isfinite()? get_positive_infinity().m_value:
+            detail::rescale(val.get_value(), FB, fraction_bits, get_max().m_value)}
+    {
+        // Intentionally empty
+    }
+
+    /// @brief Converting constructor from a signed fixed type.
+    /// @details This shifts the value to this type's fraction bits, rounding half upwards.
+    ///   Negative values, including negative infinity, saturate to zero.
+    template <typename BT, unsigned int FB>
+    explicit constexpr ufixed(const fixed<BT, FB> val) noexcept:
+        m_value{val.isnan()? get_nan().m_value: (val.get_value() <= 0)? value_type{0}:
+            !val.isfinite()? get_positive_infinity().m_value:
+            detail::rescale(static_cast<std::make_unsigned_t<BT>>(val.get_value()), FB, fraction_bits,
+                            get_max().m_value)}
+    {
+        // Intentionally empty
+    }
+
+    // Methods
+
+    /// @brief Converts the value to the expressed type.
+    template <typename T>
+    constexpr auto to_type() const noexcept -> std::enable_if_t<std::is_floating_point_v<T>, T>
+    {
+        return isnan() // newline!
+            ? std::numeric_limits<T>::signaling_NaN() // newline!
+            : !isfinite() // newline!
+                ? std::numeric_limits<T>::infinity() // newline!
+                : static_cast<T>(m_value) / static_cast<T>(scale_factor);
+    }
+
+    /// @brief Gets this value in its internal form.
+    /// @see from_value.
+    constexpr auto get_value() const noexcept -> value_type
+    {
+        return m_value;
+    }
+
+    /// @brief Gets the unsigned fixed value for the given value in internal form.
+    /// @note This is the inverse of <code>get_value</code>.
+    /// @see get_value.
+    static constexpr auto from_value(value_type val) noexcept -> ufixed
+    {
+        auto result = ufixed{};
+        result.m_value = val;
+        return result;
+    }
+
+    /// @brief Compares this value to the given one.
+    constexpr auto compare(const ufixed other) const noexcept -> ordering
+    {
+        if (isnan() || other.isnan())
+        {
+            return ordering::unordered;
+        }
+        if (m_value < other.m_value)
+        {
+            return ordering::less;
+        }
+        if (m_value > other.m_value)
+        {
+            return ordering::greater;
+        }
+        return ordering::equivalent;
+    }
+
+    // Unary operations
+
+    /// @brief To floating point type operator.
+    template <class T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+    explicit constexpr operator T() const noexcept
+    {
+        return to_type<T>();
+    }
+
+    /// @brief To unsigned integral type operator.
+    /// @details This truncates the fraction bits away.
+    template <class T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    explicit constexpr operator T() const noexcept
+    {
+        return static_cast<T>((fraction_bits < total_bits)? (m_value >> (fraction_bits % total_bits)): 0u);
+    }
+
+    /// @brief To signed fixed type operator.
+    /// @details This shifts the value to the fixed type's fraction bits, rounding half
+    ///   upwards.
+    template <typename BT, unsigned int FB>
+    explicit constexpr operator fixed<BT, FB>() const noexcept
+    {
+        using type = fixed<BT, FB>;
+        using unsigned_type = std::make_unsigned_t<BT>;
+        constexpr auto max = static_cast<unsigned_type>(type::get_max().get_value());
+        return isnan()? type::get_nan(): !isfinite()? type::get_positive_infinity():
+            type::from_value(static_cast<BT>(detail::rescale(m_value, fraction_bits, FB, max)));
+    }
+
+    /// @brief Positive operator.
+    constexpr auto operator+ () const noexcept -> ufixed
+    {
+        return *this;
+    }
+
+    /// @brief Boolean operator.
+    explicit constexpr operator bool() const noexcept
+    {
+        return m_value != 0;
+    }
+
+    /// @brief Logical not operator.
+    constexpr bool operator! () const noexcept
+    {
+        return m_value == 0;
+    }
+
+    /// @brief Addition assignment operator.
+    constexpr auto operator+= (ufixed val) noexcept -> ufixed&
+    {
+        if (isnan() || val.isnan())
+        {
+            *this = get_nan();
+        }
+        else if (!isfinite() || !val.isfinite())
+        {
+            *this = get_positive_infinity();
+        }
+        else
+        {
+            m_value = (val.m_value > get_max().m_value - m_value) // newline!
+                ? get_positive_infinity().m_value // overflow
+                : static_cast<value_type>(m_value + val.m_value);
+        }
+        return *this;
+    }
+
+    /// @brief Subtraction assignment operator.
+    /// @note Results that would be negative saturate to zero.
+    constexpr auto operator-= (ufixed val) noexcept -> ufixed&
+    {
+        if (isnan() || val.isnan() || (!isfinite() && !val.isfinite()))
+        {
+            *this = get_nan();
+        }
+        else if (isfinite())
+        {
+            m_value = (val.m_value > m_value)? value_type{0}: static_cast<value_type>(m_value - val.m_value);
+        }
+        return *this;
+    }
+
+    /// @brief Multiplication assignment operator.
+    /// @details This rounds halves upwards, which is away from zero as the @c fixed type's
+    ///   multiplication does.
+    constexpr auto operator*= (ufixed val) noexcept -> ufixed&
+    {
+        if (isnan() || val.isnan())
+        {
+            *this = get_nan();
+        }
+        else if (!isfinite() || !val.isfinite())
+        {
+            *this = ((m_value == 0) || (val.m_value == 0))? get_nan(): get_positive_infinity();
+        }
+        else
+        {
+            const auto product = static_cast<wider_type>(wider_type{m_value} * wider_type{val.m_value});
+            const auto max = static_cast<wider_type>(get_max().m_value);
+            m_value = static_cast<value_type>(detail::rescale(product, fraction_bits, 0u, max));
+        }
+        return *this;
+    }
+
+    /// @brief Division assignment operator.
+    /// @details This rounds halves upwards. Dividing a non-zero value by zero results in
+    ///   positive infinity, and zero by zero in NaN.
+    constexpr auto operator/= (ufixed val) noexcept -> ufixed&
+    {
+        if (isnan() || val.isnan() || (!isfinite() && !val.isfinite()) || ((m_value == 0) && (val.m_value == 0)))
+        {
+            *this = get_nan();
+        }
+        else if (!isfinite() || (val.m_value == 0))
+        {
+            *this = get_positive_infinity();
+        }
+        else if (!val.isfinite())
+        {
+            *this = 0;
+        }
+        else
+        {
+            const auto dividend = static_cast<wider_type>(wider_type{m_value} << fraction_bits);
+            const auto result = static_cast<wider_type>((dividend + val.m_value / 2u) / val.m_value);
+            m_value = (result > get_max().m_value) // newline!
+                ? get_positive_infinity().m_value // newline!
+                : static_cast<value_type>(result);
+        }
+        return *this;
+    }
+
+    /// @brief Modulo operator.
+    constexpr auto operator%= (ufixed val) noexcept -> ufixed&
+    {
+        assert(!isnan());
+        assert(!val.isnan());
+        m_value %= val.m_value;
+        return *this;
+    }
+
+    /// @brief Left shift assignment operator.
+    /// @details Multiplies this value by two to the given power. This is exact unless the
+    ///   result saturates to infinity. Negative amounts shift right instead.
+    constexpr auto operator<<= (int n) noexcept -> ufixed&
+    {
+        return (n < 0)? shift_right(0u - static_cast<unsigned int>(n)): shift_left(static_cast<unsigned int>(n));
+    }
+
+    /// @brief Right shift assignment operator.
+    /// @details Divides this value by two to the given power, rounding halves upwards like
+    ///   the division operator does. Negative amounts shift left instead.
+    constexpr auto operator>>= (int n) noexcept -> ufixed&
+    {
+        return (n < 0)? shift_left(0u - static_cast<unsigned int>(n)): shift_right(static_cast<unsigned int>(n));
+    }
+
+    /// @brief Is finite.
+    constexpr auto isfinite() const noexcept -> bool
+    {
+        return m_value < get_positive_infinity().m_value;
+    }
+
+    /// @brief Is NaN.
+    constexpr auto isnan() const noexcept -> bool
+    {
+        return m_value == get_nan().m_value;
+    }
+
+    /// @brief Gets this value's sign.
+    /// @note This is always positive.
+    constexpr auto getsign() const noexcept -> int
+    {
+        return +1;
+    }
+
+private:
+
+    /// @brief Widened type alias.
+    using wider_type = typename detail::wider<value_type>::type;
+
+    /// @brief Numeric limits type alias.
+    using numeric_limits = std::numeric_limits<value_type>;
+
+    /// @brief Shifts this value left by the given amount, saturating to infinity.
+    constexpr auto shift_left(unsigned int n) noexcept -> ufixed&
+    {
+        if (isfinite())
+        {
+            m_value = detail::rescale(m_value, 0u, n, get_max().m_value);
+        }
+        return *this;
+    }
+
+    /// @brief Shifts this value right by the given amount, rounding halves upwards.
+    constexpr auto shift_right(unsigned int n) noexcept -> ufixed&
+    {
+        if (isfinite() && (n != 0u))
+        {
+            m_value = (n <= total_bits)? detail::rescale(m_value, n, 0u, get_max().m_value): value_type{0};
+        }
+        return *this;
+    }
+
+    value_type m_value; ///< Value in internal form.
+};
+
+/// @brief Equality operator.
+template <typename BT, unsigned int FB>
+constexpr bool operator== (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    return lhs.compare(rhs) == ordering::equivalent;
+}
+
+/// @brief Inequality operator.
+template <typename BT, unsigned int FB>
+constexpr bool operator!= (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    return lhs.compare(rhs) != ordering::equivalent;
+}
+
+/// @brief Less-than operator.
+template <typename BT, unsigned int FB>
+constexpr bool operator< (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    return lhs.compare(rhs) == ordering::less;
+}
+
+/// @brief Greater-than operator.
+template <typename BT, unsigned int FB>
+constexpr bool operator> (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    return lhs.compare(rhs) == ordering::greater;
+}
+
+/// @brief Less-than or equal-to operator.
+template <typename BT, unsigned int FB>
+constexpr bool operator<= (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return result == ordering::less || result == ordering::equivalent;
+}
+
+/// @brief Greater-than or equal-to operator.
+template <typename BT, unsigned int FB>
+constexpr bool operator>= (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    const auto result = lhs.compare(rhs);
+    return result == ordering::greater || result == ordering::equivalent;
+}
+
+/// @brief Addition operator.
+template <typename BT, unsigned int FB>
+constexpr ufixed<BT, FB> operator+ (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    lhs += rhs;
+    return lhs;
+}
+
+/// @brief Subtraction operator.
+template <typename BT, unsigned int FB>
+constexpr ufixed<BT, FB> operator- (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+/// @brief Multiplication operator.
+template <typename BT, unsigned int FB>
+constexpr ufixed<BT, FB> operator* (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+/// @brief Division operator.
+template <typename BT, unsigned int FB>
+constexpr ufixed<BT, FB> operator/ (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    lhs /= rhs;
+    return lhs;
+}
+
+/// @brief Modulo operator.
+template <typename BT, unsigned int FB>
+constexpr ufixed<BT, FB> operator% (ufixed<BT, FB> lhs, ufixed<BT, FB> rhs) noexcept
+{
+    lhs %= rhs;
+    return lhs;
+}
+
+/// @brief Left shift operator.
+/// @see ufixed::operator<<=.
+template <typename BT, unsigned int FB>
+constexpr ufixed<BT, FB> operator<< (ufixed<BT, FB> lhs, int rhs) noexcept
+{
+    lhs <<= rhs;
+    return lhs;
+}
+
+/// @brief Right shift operator.
+/// @see ufixed::operator>>=.
+template <typename BT, unsigned int FB>
+constexpr ufixed<BT, FB> operator>> (ufixed<BT, FB> lhs, int rhs) noexcept
+{
+    lhs >>= rhs;
+    return lhs;
+}
+
+/// @brief Output stream operator.
+template <typename BT, unsigned int FB>
+inline ::std::ostream& operator<<(::std::ostream& os, const ufixed<BT, FB>& value)
+{
+    return os << static_cast<double>(value);
+}
+
+/// @brief 8-bit unsigned fixed precision type.
+/// @details This has the fraction bits of @c fixed8 and one more whole bit, for a Q
+///   number-format of <code>UQ4.4</code>.
+/// @note Maximum value is 15.8125.
+/// @see ufixed, fixed8
+using ufixed8 = ufixed<std::uint8_t, detail::fixed_default<std::int8_t>::fraction_bits>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<ufixed8>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<ufixed8>); // trivially copyable & trivial default ctor
+
+/// @brief 16-bit unsigned fixed precision type.
+/// @details This has the fraction bits of @c fixed16 and one more whole bit, for a Q
+///   number-format of <code>UQ8.8</code>.
+/// @note Maximum value is 255.98828125.
+/// @see ufixed, fixed16
+using ufixed16 = ufixed<std::uint16_t, detail::fixed_default<std::int16_t>::fraction_bits>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<ufixed16>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<ufixed16>); // trivially copyable & trivial default ctor
+
+/// @brief 32-bit unsigned fixed precision type.
+/// @details This has the fraction bits of @c fixed32 and one more whole bit, for a Q
+///   number-format of <code>UQ23.9</code>.
+/// @note Maximum value is approximately 8388607.994140625.
+/// @see ufixed, fixed32
+using ufixed32 = ufixed<std::uint32_t, detail::fixed_default<std::int32_t>::fraction_bits>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<ufixed32>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<ufixed32>); // trivially copyable & trivial default ctor
+
+/// @brief 64-bit unsigned fixed precision type.
+/// @details This has the fraction bits of @c fixed64 and one more whole bit, for a Q
+///   number-format of <code>UQ40.24</code>.
+/// @note Maximum value is approximately 1099511627776.
+/// @see ufixed, fixed64
+using ufixed64 = ufixed<std::uint64_t, detail::fixed_default<std::int64_t>::fraction_bits>;
+
+// Assert basic type traits...
+static_assert(std::is_trivially_copyable_v<ufixed64>); // can safely copy with std::memcpy!
+static_assert(std::is_trivial_v<ufixed64>); // trivially copyable & trivial default ctor
+
+}
+
+#endif /* REALNUMB_UFIXED_HPP */
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <cmath> // for std::sin, etc.
+#include <cstdint> // for std::uint32_t
+
+#include <realnumb/angle.hpp>
+
+using namespace realnumb;
+using realnumb::numbers::pi;
+
+template <typename T>
+class angle_: public testing::Test {
+public:
+    using type = T;
+};
+
+using angle_types = ::testing::Types<
+    ::realnumb::angle32
+    , ::realnumb::angle64
+>;
+TYPED_TEST_SUITE(angle_, angle_types);
+
+TEST(angle, constexpr_support)
+{
+    constexpr auto quarter = angle32::from_value(std::int32_t{1} << 30);
+    static_assert((quarter + quarter + quarter + quarter).get_value() == 0);
+    static_assert(sin(quarter) == fixed32(1));
+    static_assert(cos(quarter) == fixed32(0));
+    static_assert(angle32(fixed32(0)).get_value() == 0);
+    SUCCEED();
+}
+
+TYPED_TEST(angle_, default_construction)
+{
+    using type = typename TestFixture::type;
+    EXPECT_EQ(type{}.get_value(), 0);
+}
+
+TYPED_TEST(angle_, quadrant)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    constexpr auto quarter = value_type{1} << (type::total_bits - 2u);
+    EXPECT_EQ(type::from_value(0).quadrant(), 0u);
+    EXPECT_EQ(type::from_value(quarter).quadrant(), 1u);
+    EXPECT_EQ(type::from_value(std::numeric_limits<value_type>::lowest()).quadrant(), 2u);
+    EXPECT_EQ(type::from_value(-quarter).quadrant(), 3u);
+    EXPECT_EQ(type::from_value(quarter / 2 - 1).quadrant(), 0u);
+    EXPECT_EQ(type::from_value(quarter / 2).quadrant(), 1u);
+    EXPECT_EQ(type::from_value(quarter / 2).quadrant_offset(), -quarter / 2);
+    EXPECT_EQ(type::from_value(quarter / 2 - 1).quadrant_offset(), quarter / 2 - 1);
+}
+
+TYPED_TEST(angle_, additions_wrap)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    const auto max = type::from_value(std::numeric_limits<value_type>::max());
+    const auto lowest = type::from_value(std::numeric_limits<value_type>::lowest());
+    const auto one = type::from_value(1);
+    EXPECT_EQ(max + one, lowest);
+    EXPECT_EQ(lowest - one, max);
+    EXPECT_EQ(-lowest, lowest);
+    EXPECT_EQ(-one + one, type{});
+    EXPECT_EQ(lowest * value_type{2}, type{});
+    EXPECT_EQ(value_type{4} * type::from_value(value_type{1} << (type::total_bits - 2u)), type{});
+}
+
+TEST(angle, from_radians)
+{
+    constexpr auto unit = 4294967296.0 / (2 * pi); // units per radian
+    EXPECT_EQ(angle32(fixed32(0)).get_value(), 0);
+    EXPECT_NEAR(double(angle32(fixed32(+pi / 2)).get_value()), +pi / 2 * unit, unit / 512);
+    EXPECT_NEAR(double(angle32(fixed32(-pi / 2)).get_value()), -pi / 2 * unit, unit / 512);
+    EXPECT_NEAR(double(angle32(fixed32(+1)).get_value()), +1 * unit, unit / 512);
+    EXPECT_NEAR(double(angle32(fixed32(-1)).get_value()), -1 * unit, unit / 512);
+    EXPECT_NEAR(double(angle32(fixed32(+3)).get_value()), +3 * unit, unit / 512);
+    EXPECT_NEAR(double(angle32(fixed32(2 * pi + 1)).get_value()), (2 * pi + 1 - 2 * pi) * unit, unit / 512);
+    EXPECT_EQ(angle32(fixed32::get_positive_infinity()).get_value(), 0);
+    EXPECT_EQ(angle32(fixed32::get_nan()).get_value(), 0);
+}
+
+TYPED_TEST(angle_, to_radians)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    using fixed_type = fixed<value_type, detail::fixed_default<value_type>::fraction_bits>;
+    constexpr auto quarter = value_type{1} << (type::total_bits - 2u);
+    const auto tolerance = double(fixed_type::get_min());
+    EXPECT_EQ(fixed_type(type::from_value(0)), fixed_type(0));
+    EXPECT_NEAR(double(fixed_type(type::from_value(+quarter))), +pi / 2, tolerance);
+    EXPECT_NEAR(double(fixed_type(type::from_value(-quarter))), -pi / 2, tolerance);
+    EXPECT_NEAR(double(fixed_type(type::from_value(std::numeric_limits<value_type>::lowest()))),
+                -pi, tolerance);
+    for (auto i = -179; i <= +179; ++i) {
+        const auto radians = fixed_type(i * pi / 180);
+        std::ostringstream os;
+        os << "for angle of " << i << " degrees, or " << radians << " radians";
+        SCOPED_TRACE(os.str());
+        EXPECT_NEAR(double(fixed_type(type(radians))), double(radians), tolerance);
+    }
+}
+
+TYPED_TEST(angle_, sin_and_cos)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    using fixed_type = fixed<value_type, detail::fixed_default<value_type>::fraction_bits>;
+    for (auto i = -720; i <= +720; ++i) {
+        const auto radians = fixed_type(i * pi / 180);
+        const auto value = type(radians);
+        std::ostringstream os;
+        os << "for angle of " << i << " degrees";
+        SCOPED_TRACE(os.str());
+        EXPECT_EQ(sin(value), sin(radians));
+        EXPECT_EQ(cos(value), cos(radians));
+        const auto both = sincos(value);
+        EXPECT_EQ(both.first, sin(value));
+        EXPECT_EQ(both.second, cos(value));
+    }
+}
+
+TEST(angle, sin_with_more_fraction_bits)
+{
+    for (auto i = -180; i <= +180; ++i) {
+        const auto value = angle32::from_value(static_cast<std::int32_t>(
+            static_cast<std::uint32_t>(std::int64_t{i} * (std::int64_t{1} << 32) / 360)));
+        const auto expected = std::sin(i * pi / 180);
+        std::ostringstream os;
+        os << "for angle of " << i << " degrees";
+        SCOPED_TRACE(os.str());
+        EXPECT_NEAR(double(sin<16>(value)), expected, 0.00003);
+        EXPECT_NEAR(double(sin(value)), expected, double(fixed32::get_min()) * 2);
+    }
+}
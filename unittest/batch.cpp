@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath> // for std::abs, std::fabs, std::ldexp
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <type_traits> // for std::is_same_v
+#include <vector>
+
+#include <realnumb/batch.hpp>
+#include <realnumb/fixed_math.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+/// @brief Gets the special values, the range limits, small values and values scattered
+///   over the whole range of the given type.
+/// @note The count isn't a multiple of the block size so the last block is partial.
+template <class T>
+auto test_values() -> std::vector<T>
+{
+    using value_type = decltype(T{}.get_value());
+    auto result = std::vector<T>{
+        T::get_nan(), T::get_negative_infinity(), T::get_lowest(), T(-1000.5), T(-3), T(-1),
+        T(-0.5), -T::get_min(), T(0), T::get_min(), T(0.5), T(1), T(2.25), T(3), T(1000.5),
+        T::get_max(), T::get_positive_infinity(),
+    };
+    auto state = std::uint64_t{12345u};
+    for (auto i = 0; i < 3000; ++i) {
+        state = state * 6364136223846793005u + 1442695040888963407u; // LCG by Knuth
+        const auto bits = static_cast<value_type>(state >> 11u);
+        result.push_back(T::from_value(bits));
+        result.push_back(T::from_value(static_cast<value_type>(bits >> (T::total_bits / 2u))));
+        result.push_back(T::from_value(static_cast<value_type>(bits >> (T::total_bits - 6u))));
+    }
+    return result;
+}
+
+/// @brief Gets the pairs of the given values with the same values in another order.
+template <class T>
+auto shuffled(const std::vector<T>& values) -> std::vector<T>
+{
+    auto result = values;
+    for (auto i = std::size_t{0}; i < result.size(); ++i) {
+        result[i] = values[(i * 7u + 3u) % values.size()];
+    }
+    return result;
+}
+
+/// @brief Checks that the given values have the same internal values.
+/// @note Unlike comparing the vectors, this treats the not-a-number values as equal.
+template <class T>
+void expect_same(const std::vector<T>& values, const std::vector<T>& expected)
+{
+    ASSERT_EQ(values.size(), expected.size());
+    for (auto i = std::size_t{0}; i < values.size(); ++i) {
+        EXPECT_EQ(values[i].get_value(), expected[i].get_value()) << i;
+    }
+}
+
+/// @brief Gets whether the given exact value in ulps is within
+///   <code>2^-KernelGuardBits</code> of an ulp of a rounding boundary.
+auto near_tie(long double exact) -> bool
+{
+    const auto distance = std::fabs(exact - std::floor(exact) - 0.5L);
+    return distance < std::ldexp(1.0L, -static_cast<int>(detail::KernelGuardBits));
+}
+
+/// @brief Checks that the given batch result is correctly rounded from the given exact
+///   value for the @c precise tier, except near a tie, and within an ulp of it for the
+///   other tiers.
+template <class T, class Tier>
+void expect_rounded(T result, long double exact)
+{
+    const auto to_ulps = std::ldexp(1.0L, static_cast<int>(T::fraction_bits));
+    const auto max = static_cast<long double>(T::get_max().get_value());
+    const auto ulps = exact * to_ulps;
+    if (ulps > max + 0.5L) {
+        EXPECT_EQ(result, T::get_positive_infinity());
+        return;
+    }
+    const auto value = static_cast<long double>(result.get_value());
+    if (std::is_same_v<Tier, precise> && !near_tie(ulps)) {
+        EXPECT_EQ(value, std::round(ulps));
+    }
+    EXPECT_LT(std::fabs(value - ulps), 1.0L);
+}
+
+/// @brief Checks the given unary batch function against the given exact function, and
+///   against the given scalar function. That's to within an ulp, or exactly for the given
+///   special arguments.
+template <class T, class Tier, class Batch, class Exact, class Scalar, class Special>
+void expect_unary(Batch batch, Exact exact, Scalar scalar, Special special)
+{
+    const auto to_ulps = std::ldexp(1.0L, static_cast<int>(T::fraction_bits));
+    const auto args = test_values<T>();
+    auto results = std::vector<T>(args.size());
+    batch(args.data(), args.size(), results.data());
+    for (auto i = std::size_t{0}; i < args.size(); ++i) {
+        const auto arg = args[i];
+        if (special(arg)) {
+            EXPECT_EQ(results[i].get_value(), scalar(arg).get_value()) << arg;
+        }
+        else {
+            SCOPED_TRACE(arg);
+            expect_rounded<T, Tier>(results[i], exact(arg.get_value() / to_ulps));
+            if (std::is_same_v<Tier, precise>) {
+                EXPECT_LE(std::abs(results[i].get_value() - scalar(arg).get_value()), 1);
+            }
+        }
+    }
+}
+
+/// @brief Checks that the given unary batch function matches the given scalar function.
+template <class T, class Batch, class Scalar>
+void expect_unary(Batch batch, Scalar scalar)
+{
+    const auto args = test_values<T>();
+    auto results = std::vector<T>(args.size());
+    batch(args.data(), args.size(), results.data());
+    for (auto i = std::size_t{0}; i < args.size(); ++i) {
+        EXPECT_EQ(results[i].get_value(), scalar(args[i]).get_value()) << args[i];
+    }
+}
+
+/// @brief Checks that the given binary batch function matches the given scalar function.
+template <class T, class Batch, class Scalar>
+void expect_binary(Batch batch, Scalar scalar)
+{
+    const auto firsts = test_values<T>();
+    const auto seconds = shuffled(firsts);
+    auto results = std::vector<T>(firsts.size());
+    batch(firsts.data(), seconds.data(), firsts.size(), results.data());
+    for (auto i = std::size_t{0}; i < firsts.size(); ++i) {
+        EXPECT_EQ(results[i].get_value(), scalar(firsts[i], seconds[i]).get_value())
+            << firsts[i] << ", " << seconds[i];
+    }
+}
+
+template <class T>
+void expect_roots_match()
+{
+    expect_unary<T>([](auto... a) { batch::sqrt(a...); }, [](T x) { return sqrt(x); });
+    expect_binary<T>([](auto... a) { batch::hypot(a...); }, [](T x, T y) { return hypot(x, y); });
+}
+
+template <class T, class Tier>
+void expect_all_rounded()
+{
+    const auto special = [](T x) { return !x.isfinite(); };
+    expect_unary<T, Tier>([](auto... a) { batch::sin<Tier>(a...); },
+                          [](long double x) { return std::sin(x); },
+                          [](T x) { return sin<Tier>(x); }, special);
+    expect_unary<T, Tier>([](auto... a) { batch::cos<Tier>(a...); },
+                          [](long double x) { return std::cos(x); },
+                          [](T x) { return cos<Tier>(x); }, special);
+    expect_unary<T, Tier>([](auto... a) { batch::exp<Tier>(a...); },
+                          [](long double x) { return std::exp(x); },
+                          [](T x) { return exp<Tier>(x); }, special);
+    expect_unary<T, Tier>([](auto... a) { batch::log<Tier>(a...); },
+                          [](long double x) { return std::log(x); },
+                          [](T x) { return log<Tier>(x); },
+                          [](T x) { return !x.isfinite() || (x <= 0); });
+    const auto ys = test_values<T>();
+    const auto xs = shuffled(ys);
+    auto results = std::vector<T>(ys.size());
+    batch::atan2<Tier>(ys.data(), xs.data(), ys.size(), results.data());
+    for (auto i = std::size_t{0}; i < ys.size(); ++i) {
+        const auto y = ys[i];
+        const auto x = xs[i];
+        if (!y.isfinite() || !x.isfinite() || (x == 0)) {
+            EXPECT_EQ(results[i].get_value(), atan2<Tier>(y, x).get_value()) << y << ", " << x;
+        }
+        else {
+            SCOPED_TRACE(::testing::Message() << y << ", " << x);
+            const auto exact = std::atan2(static_cast<long double>(y.get_value()),
+                                          static_cast<long double>(x.get_value()));
+            expect_rounded<T, Tier>(results[i], exact);
+        }
+    }
+}
+
+}
+
+TEST(batch, fixed32_rounded)
+{
+    expect_all_rounded<fixed32, precise>();
+}
+
+TEST(batch, fixed32_balanced_within_an_ulp)
+{
+    expect_all_rounded<fixed32, balanced>();
+}
+
+TEST(batch, fixed32_fast_within_an_ulp)
+{
+    expect_all_rounded<fixed32, fast>();
+}
+
+TEST(batch, fixed16_rounded)
+{
+    expect_all_rounded<fixed16, precise>();
+}
+
+TEST(batch, fixed32_roots_match_scalar)
+{
+    expect_roots_match<fixed32>();
+}
+
+TEST(batch, fixed16_roots_match_scalar)
+{
+    expect_roots_match<fixed16>();
+}
+
+TEST(batch, fixed64_roots_match_scalar)
+{
+    expect_roots_match<fixed64>();
+}
+
+TEST(batch, sincos)
+{
+    const auto args = test_values<fixed32>();
+    auto sines = std::vector<fixed32>(args.size());
+    auto cosines = std::vector<fixed32>(args.size());
+    batch::sincos(args, sines, cosines);
+    auto expected = std::vector<fixed32>(args.size());
+    batch::sin(args, expected);
+    expect_same(sines, expected);
+    batch::cos(args, expected);
+    expect_same(cosines, expected);
+}
+
+TEST(batch, ranges)
+{
+    const auto args = std::array<fixed32, 4>{fixed32(-2), fixed32(0), fixed32(0.25), fixed32(9)};
+    auto results = std::vector<fixed32>(args.size());
+    batch::sqrt(args, results);
+    EXPECT_TRUE(results[0].isnan());
+    EXPECT_EQ(results[1], fixed32(0));
+    EXPECT_EQ(results[2], fixed32(0.5));
+    EXPECT_EQ(results[3], fixed32(3));
+    auto xs = std::vector<fixed32>{fixed32(3), fixed32(-1)};
+    auto ys = std::vector<fixed32>{fixed32(4), fixed32(0)};
+    auto pair = std::array<fixed32, 2>{};
+    batch::hypot(xs, ys, pair);
+    EXPECT_EQ(pair[0], fixed32(5));
+    EXPECT_EQ(pair[1], fixed32(1));
+    batch::atan2(ys, xs, pair);
+    EXPECT_EQ(pair[0], fixed32(0.927734375));
+    EXPECT_EQ(pair[1], (detail::FixedPi<std::int32_t, 9>));
+}
+
+TEST(batch, in_place)
+{
+    const auto args = test_values<fixed32>();
+    auto expected = std::vector<fixed32>(args.size());
+    batch::exp(args, expected);
+    auto values = args;
+    batch::exp(values, values);
+    expect_same(values, expected);
+    const auto others = shuffled(args);
+    batch::atan2(args, others, expected);
+    values = args;
+    batch::atan2(values, others, values);
+    expect_same(values, expected);
+    batch::atan2(others, args, expected);
+    values = args;
+    batch::atan2(others, values, values);
+    expect_same(values, expected);
+}
+
+TEST(batch, empty)
+{
+    auto results = std::vector<fixed32>{};
+    batch::sin(std::vector<fixed32>{}, results);
+    EXPECT_TRUE(results.empty());
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <algorithm> // for std::max
+#include <cmath> // for std::floor
 #include <iostream>
 #include <limits> // for std::numeric_limits
 
@@ -15,8 +17,9 @@ public:
 
 using fixed_types = ::testing::Types<
     ::realnumb::fixed32
-#ifdef REALNUMB_INT128
     , ::realnumb::fixed64
+#ifdef REALNUMB_INT128
+    , ::realnumb::fixed128
 #endif
 >;
 TYPED_TEST_SUITE(fixed_, fixed_types);
@@ -58,6 +61,19 @@ TYPED_TEST(fixed_, to_value_from_floating)
     EXPECT_EQ(type::to_value(-std::numeric_limits<float>::infinity()), -fixed_infinity_as_vt);
 }
 
+TYPED_TEST(fixed_, get_value_and_from_value)
+{
+    using type = typename TestFixture::type;
+    EXPECT_EQ(type(0).get_value(), 0);
+    EXPECT_EQ(type(1).get_value(), type::scale_factor);
+    EXPECT_EQ(type(-2).get_value(), -2 * type::scale_factor);
+    EXPECT_EQ(type::get_min().get_value(), 1);
+    EXPECT_EQ(type::from_value(1), type::get_min());
+    EXPECT_EQ(type::from_value(type::scale_factor), type(1));
+    EXPECT_EQ(type::from_value(type::get_max().get_value()), type::get_max());
+    EXPECT_TRUE(type::from_value(type::get_nan().get_value()).isnan());
+}
+
 TYPED_TEST(fixed_, int_construction_and_compare)
 {
     using type = typename TestFixture::type;
@@ -115,31 +131,45 @@ TYPED_TEST(fixed_, FloatConstruction)
 
 TEST(fixed, get_min)
 {
+    EXPECT_GT(fixed8::get_min(), fixed8(0));
+    EXPECT_LT(fixed8::get_min(), fixed8(1));
+    EXPECT_EQ(fixed8::get_min(), fixed8(0, 1u));
+    EXPECT_EQ(static_cast<double>(fixed8::get_min()), 0.0625);
+    EXPECT_EQ(static_cast<double>(fixed16::get_min()), 0.00390625);
     EXPECT_GT(fixed32::get_min(), fixed32(0));
     EXPECT_LT(fixed32::get_min(), fixed32(1));
     EXPECT_EQ(fixed32::get_min(), fixed32(0, 1u));
     EXPECT_NEAR(static_cast<double>(fixed32::get_min()), 0.001953125, 0.00001);
-#ifdef REALNUMB_INT128
     EXPECT_GT(fixed64::get_min(), fixed64(0));
     EXPECT_LT(fixed64::get_min(), fixed64(1));
     EXPECT_EQ(fixed64::get_min(), fixed64(0, 1u));
     EXPECT_NEAR(static_cast<double>(fixed64::get_min()), 5.9604644775390625e-08, 0.0);
+#ifdef REALNUMB_INT128
+    EXPECT_GT(fixed128::get_min(), fixed128(0));
+    EXPECT_LT(fixed128::get_min(), fixed128(1));
+    EXPECT_EQ(static_cast<double>(fixed128::get_min()), 0x1p-64);
 #endif
 }
 
 TEST(fixed, get_max)
 {
+    EXPECT_EQ(static_cast<double>(fixed8::get_max()), 7.875);
+    EXPECT_EQ(static_cast<double>(fixed16::get_max()), 127.9921875);
     EXPECT_NEAR(static_cast<double>(fixed32::get_max()), 4194303.99609375, 0.0001);
-#ifdef REALNUMB_INT128
     EXPECT_NEAR(static_cast<double>(fixed64::get_max()), 549755813888.0, 0.0);
+#ifdef REALNUMB_INT128
+    EXPECT_EQ(static_cast<double>(fixed128::get_max()), 9223372036854775808.0);
 #endif
 }
 
 TEST(fixed, get_lowest)
 {
+    EXPECT_EQ(static_cast<double>(fixed8::get_lowest()), -7.875);
+    EXPECT_EQ(static_cast<double>(fixed16::get_lowest()), -127.9921875);
     EXPECT_EQ(static_cast<double>(fixed32::get_lowest()), -4194303.99609375);
-#ifdef REALNUMB_INT128
     EXPECT_EQ(static_cast<double>(fixed64::get_lowest()), -549755813888.0);
+#ifdef REALNUMB_INT128
+    EXPECT_EQ(static_cast<double>(fixed128::get_lowest()), -9223372036854775808.0);
 #endif
 }
 
@@ -238,7 +268,15 @@ TYPED_TEST(fixed_, Multiplication)
     EXPECT_EQ(type(0.5) * type(0.5), type(0.25));
     EXPECT_NEAR(double(type(-0.05) * type(0.05)), double(type(-0.0025)), 0.0001);
     EXPECT_EQ(type::get_min() * type::get_min(), type(0));
-    EXPECT_EQ(type::get_min() * type::scale_factor, type(1));
+    if constexpr (type::whole_bits > type::fraction_bits)
+    {
+        EXPECT_EQ(type::get_min() * type::scale_factor, type(1));
+    }
+    else
+    {
+        // The scale factor is too big for types having as many fraction bits as whole bits...
+        EXPECT_EQ(type::get_min() * (type::scale_factor / 4), type(0.25));
+    }
 }
 
 TYPED_TEST(fixed_, Division)
@@ -259,8 +297,10 @@ TYPED_TEST(fixed_, Division)
         const auto d = 3.0;
         const auto result = type(n) / type(d);
         const auto expected = type(n / d);
-        const auto expected_hi = expected + type::get_min();
-        const auto expected_lo = expected - type::get_min();
+        // Types with more fraction bits than double has need more than a min of tolerance...
+        const auto tolerance = std::max(type::get_min(), type(n / d * std::numeric_limits<double>::epsilon()));
+        const auto expected_hi = expected + tolerance;
+        const auto expected_lo = expected - tolerance;
         EXPECT_LE(result, expected_hi);
         EXPECT_GE(result, expected_lo);
     }
@@ -488,6 +528,36 @@ TYPED_TEST(fixed_, DivisionAssignment)
     EXPECT_EQ(foo, type::get_negative_infinity());
 }
 
+TYPED_TEST(fixed_, ShiftAssignment)
+{
+    using type = typename TestFixture::type;
+    type foo;
+    foo = type::get_nan();
+    foo <<= 1;
+    EXPECT_TRUE(foo.isnan());
+    foo = 3;
+    foo <<= 2;
+    EXPECT_EQ(foo, type(12));
+    foo >>= 3;
+    EXPECT_EQ(foo, type(1.5));
+    foo >>= -1;
+    EXPECT_EQ(foo, type(3));
+    foo = type::get_max();
+    foo <<= 1;
+    EXPECT_EQ(foo, type::get_positive_infinity());
+    foo = type::get_lowest();
+    foo <<= 1;
+    EXPECT_EQ(foo, type::get_negative_infinity());
+    foo = type::get_min();
+    foo >>= 1;
+    EXPECT_EQ(foo, type::get_min());
+    foo = -type::get_min();
+    foo >>= 1;
+    EXPECT_EQ(foo, -type::get_min());
+    foo >>= 2;
+    EXPECT_EQ(foo, type(0));
+}
+
 TYPED_TEST(fixed_, GetSign)
 {
     using type = typename TestFixture::type;
@@ -505,15 +575,52 @@ TEST(fixed, StreamOut_fixed32)
     EXPECT_STREQ(os.str().c_str(), "2.19922");
 }
 
-#ifdef REALNUMB_INT128
 TEST(fixed, StreamOut_fixed64)
 {
     std::ostringstream os;
     os << fixed64(2.2f);
     EXPECT_STREQ(os.str().c_str(), "2.2");
 }
+
+#ifdef REALNUMB_INT128
+
+TEST(fixed, fixed128)
+{
+    static_assert(fixed128::fraction_bits == 64u);
+    static_assert(fixed128::whole_bits == 64u);
+    static_assert(fixed128(3) * fixed128(4) == fixed128(12));
+    static_assert(fixed128(1) / fixed128(4) == fixed128(0.25));
+    // Products and quotients need all of the 256-bit wider type...
+    const auto big = fixed128(0x1p62);
+    const auto tiny = fixed128::get_min();
+    EXPECT_EQ(big * fixed128(1.5), fixed128(0x1.8p62));
+    EXPECT_EQ(big * fixed128(2.5), fixed128::get_positive_infinity());
+    EXPECT_EQ(-big * fixed128(2.5), fixed128::get_negative_infinity());
+    EXPECT_EQ((tiny * fixed128(0.5)).get_value(), 1); // half rounds away from zero
+    EXPECT_EQ((tiny * fixed128(0.25)).get_value(), 0);
+    EXPECT_EQ(big / tiny, fixed128::get_positive_infinity());
+    EXPECT_EQ(tiny / big, fixed128(0));
+    EXPECT_EQ((fixed128(1) / fixed128(3)).get_value(), 0x5555555555555555);
+    EXPECT_EQ((fixed128(-2) / fixed128(3)).get_value(), -static_cast<REALNUMB_INT128>(0xAAAAAAAAAAAAAAABu));
+    EXPECT_EQ(fixed128(fixed64(100.5)), fixed128(100.5));
+    EXPECT_EQ(static_cast<long long>(fixed128(-1234567.75)), -1234567);
+}
+
+TEST(fixed, StreamOut_fixed128)
+{
+    std::ostringstream os;
+    os << fixed128(2.2f);
+    EXPECT_STREQ(os.str().c_str(), "2.2");
+}
 #endif
 
+TEST(fixed, StreamOut_fixed8)
+{
+    std::ostringstream os;
+    os << fixed8(2.2f) << ' ' << fixed16(2.2f);
+    EXPECT_STREQ(os.str().c_str(), "2.1875 2.19922");
+}
+
 TEST(fixed, Int32TypeAnd0bits)
 {
     using fixed = fixed<std::int32_t, 0>;
@@ -545,8 +652,129 @@ TEST(fixed, Int32TypeAnd0bits)
     EXPECT_EQ(two - two, zero);
 }
 
+TEST(fixed, Int16TypeAnd15bits)
+{
+    using fixed = fixed<std::int16_t, 15>;
+    static_assert(fixed::whole_bits == 1u);
+    static_assert(fixed::scale_factor == 32768);
+
+    EXPECT_EQ(fixed(0.5).get_value(), 16384);
+    EXPECT_EQ(fixed(-0.25).get_value(), -8192);
+    EXPECT_EQ(fixed(0.5) * fixed(0.5), fixed(0.25));
+    EXPECT_EQ(fixed(0.5) * fixed(-0.25), fixed(-0.125));
+    EXPECT_EQ(fixed(0.25) / fixed(0.5), fixed(0.5));
+    EXPECT_EQ(fixed(0.75) - fixed(0.5), fixed(0.25));
+    EXPECT_EQ(fixed(0.75) + fixed(0.5), fixed::get_positive_infinity());
+    EXPECT_EQ(fixed(0), fixed::from_value(0));
+    EXPECT_EQ(fixed(1), fixed::get_positive_infinity());
+    EXPECT_EQ(fixed(-1), fixed::get_negative_infinity());
+    EXPECT_EQ(static_cast<int>(fixed(0.5)), 0);
+    EXPECT_EQ(static_cast<double>(fixed::get_min()), 1.0 / 32768);
+}
+
+TEST(fixed, Int32TypeAnd31bits)
+{
+    using fixed = fixed<std::int32_t, 31>;
+    static_assert(fixed::whole_bits == 1u);
+    static_assert(fixed::scale_factor == 2147483648);
+
+    EXPECT_EQ(fixed(0.5).get_value(), 1073741824);
+    EXPECT_EQ(fixed(0.5) * fixed(0.5), fixed(0.25));
+    EXPECT_EQ(fixed(0.375) / fixed(0.75), fixed(0.5));
+    EXPECT_EQ(fixed(-0.75) - fixed(0.5), fixed::get_negative_infinity());
+    EXPECT_EQ(fixed(2), fixed::get_positive_infinity());
+    EXPECT_EQ(static_cast<double>(fixed::get_max()), 1.0 - 2.0 / 2147483648);
+}
+
 TEST(fixed, less)
 {
     using fixed_32_0 = fixed<std::int32_t, 0>;
     EXPECT_LT(fixed_32_0(0), fixed_32_0(1));
 }
+
+namespace {
+
+/// @brief Gets the internal value that the given exact result of an operation on finite
+///   values should round to, which is to nearest with halves away from zero.
+template <class T>
+auto expected_value(double exact) -> decltype(T{}.get_value())
+{
+    const auto scaled = exact * T::scale_factor;
+    const auto rounded = (scaled < 0)? -std::floor(-scaled + 0.5): std::floor(scaled + 0.5);
+    return (rounded > T::get_max().get_value())? T::get_positive_infinity().get_value():
+        (rounded < T::get_lowest().get_value())? T::get_negative_infinity().get_value():
+        static_cast<decltype(T{}.get_value())>(rounded);
+}
+
+template <typename T>
+class small_fixed_: public testing::Test {
+public:
+    using type = T;
+};
+
+using small_fixed_types = ::testing::Types<::realnumb::fixed8, ::realnumb::fixed16>;
+
+}
+
+TYPED_TEST_SUITE(small_fixed_, small_fixed_types);
+
+TYPED_TEST(small_fixed_, arithmetic_is_correctly_rounded)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    // Every pair of the 8-bit type's values but only every 61st right-hand value of the
+    // 16-bit type's, to keep this quick.
+    constexpr auto step = (sizeof(value_type) == 1u)? 1: 61;
+    constexpr auto min = static_cast<int>(std::numeric_limits<value_type>::min());
+    constexpr auto max = static_cast<int>(std::numeric_limits<value_type>::max());
+    for (auto i = min + 2; i < max; ++i) {
+        const auto a = type::from_value(static_cast<value_type>(i));
+        const auto x = static_cast<double>(a);
+        for (auto j = min + 2; j < max; j += step) {
+            const auto b = type::from_value(static_cast<value_type>(j));
+            const auto y = static_cast<double>(b);
+            ASSERT_EQ((a + b).get_value(), expected_value<type>(x + y)) << x << " + " << y;
+            ASSERT_EQ((a - b).get_value(), expected_value<type>(x - y)) << x << " - " << y;
+            ASSERT_EQ((a * b).get_value(), expected_value<type>(x * y)) << x << " * " << y;
+            if (j != 0) {
+                ASSERT_EQ((a / b).get_value(), expected_value<type>(x / y)) << x << " / " << y;
+            }
+            ASSERT_EQ(a < b, x < y);
+            ASSERT_EQ(a <= b, x <= y);
+            ASSERT_EQ(a == b, x == y);
+        }
+    }
+}
+
+TYPED_TEST(small_fixed_, special_values)
+{
+    using type = typename TestFixture::type;
+    const auto inf = type::get_positive_infinity();
+    EXPECT_TRUE((type::get_nan() + type(1)).isnan());
+    EXPECT_TRUE((inf - inf).isnan());
+    EXPECT_TRUE((inf * type(0)).isnan());
+    EXPECT_EQ(inf * type(-2), type::get_negative_infinity());
+    EXPECT_EQ(type(1) / inf, type(0));
+    EXPECT_EQ(type::get_max() + type::get_min(), inf);
+    EXPECT_EQ(type::get_lowest() - type::get_min(), type::get_negative_infinity());
+    EXPECT_EQ(type(1e9), inf);
+    EXPECT_EQ(type(-1e9), type::get_negative_infinity());
+    EXPECT_EQ(type(1000), inf);
+    EXPECT_EQ(type(-1000), type::get_negative_infinity());
+    EXPECT_FALSE(type::get_nan() == type::get_nan());
+}
+
+TYPED_TEST(small_fixed_, conversions)
+{
+    using type = typename TestFixture::type;
+    EXPECT_EQ(static_cast<int>(type(3.75)), 3);
+    EXPECT_EQ(static_cast<int>(type(-3.75)), -3);
+    EXPECT_EQ(static_cast<double>(type(-3.75)), -3.75);
+    EXPECT_EQ(static_cast<float>(type(0.5)), 0.5f);
+    EXPECT_EQ(type(7) / 2, type(3.5));
+    EXPECT_EQ(1 + type(2), type(3));
+    EXPECT_EQ(type(2) * 3, type(6));
+    EXPECT_EQ(type(5) % type(3), type(2));
+    EXPECT_EQ(type(3) >> 1, type(1.5));
+    EXPECT_EQ(type(0.75) << 2, type(3));
+}
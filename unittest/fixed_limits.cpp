@@ -4,6 +4,7 @@
 #include <realnumb/fixed_limits.hpp>
 
 #include <iostream>
+#include <type_traits> // for std::is_same_v
 
 using namespace realnumb;
 
@@ -14,10 +15,12 @@ public:
 };
 
 using fixed_types = ::testing::Types<
-    ::realnumb::fixed32
-#ifdef REALNUMB_INT128
+    ::realnumb::fixed8
+    , ::realnumb::fixed16
+    , ::realnumb::fixed32
     , ::realnumb::fixed64
-#endif
+    , ::realnumb::fixed<std::int64_t, 48>
+    , ::realnumb::fixed<std::int64_t, 56>
 >;
 TYPED_TEST_SUITE(fixed_limits_, fixed_types);
 
@@ -111,3 +114,13 @@ TYPED_TEST(fixed_limits_, DivisionAssignment)
     foo /= type(0.5);
     EXPECT_EQ(foo, type::get_negative_infinity());
 }
+
+TYPED_TEST(fixed_limits_, EpsilonAndRoundError)
+{
+    using type = typename TestFixture::type;
+    static_assert(std::is_same_v<decltype(std::numeric_limits<type>::epsilon()), type>);
+    static_assert(std::numeric_limits<type>::radix == 2);
+    EXPECT_EQ(std::numeric_limits<type>::epsilon(), type::get_min());
+    EXPECT_GT(type(1) + std::numeric_limits<type>::epsilon(), type(1));
+    EXPECT_EQ(std::numeric_limits<type>::round_error(), type(0.5));
+}
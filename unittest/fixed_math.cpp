@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <algorithm> // for std::max
 #include <cmath> // for std::isnan, etc.
+#include <utility> // for std::make_pair
 
 #include <realnumb/fixed_math.hpp>
+#include <realnumb/is_arithmetic.hpp>
 
 using namespace realnumb;
 using realnumb::numbers::pi;
@@ -23,6 +26,79 @@ auto next_after(T from, T to) -> decltype(nextafter(from, to))
     return from;
 }
 
+/// @brief Gets the largest error in ulps of the given function over evenly spaced values
+///   from the first bound to the second, compared to the given reference function.
+/// @note Values whose reference result's magnitude exceeds the given limit are skipped.
+template <class T, class F, class G>
+auto max_ulps(F function, G reference, T lo, T hi, long double limit = 1e30L) -> long double
+{
+    using value_type = typename T::value_type;
+    const auto to_ulps = std::ldexp(1.0L, static_cast<int>(T::fraction_bits));
+    const auto step = std::max(static_cast<value_type>(hi.get_value() / 100000 - lo.get_value() / 100000),
+                               value_type{1});
+    auto result = 0.0L;
+    // Counts in at least an int so the bound and the steps can't overflow narrow types.
+    using count_type = decltype(+value_type{});
+    for (auto v = count_type{lo.get_value()}; v <= hi.get_value() - step; v += step) {
+        const auto exact = reference(static_cast<long double>(v) / to_ulps);
+        if (std::fabs(exact) <= limit) {
+            const auto value = function(T::from_value(static_cast<value_type>(v))).get_value();
+            result = std::max(result, std::fabs(static_cast<long double>(value) - exact * to_ulps));
+        }
+    }
+    return result;
+}
+
+/// @brief Gets the largest difference in ulps between the finite results of the given
+///   functions over evenly spaced values from the first bound to the second.
+template <class T, class F, class G>
+auto max_ulps_apart(F function, G other, T lo, T hi) -> long double
+{
+    using value_type = typename T::value_type;
+    const auto step = std::max(static_cast<value_type>(hi.get_value() / 10000 - lo.get_value() / 10000),
+                               value_type{1});
+    auto result = 0.0L;
+    for (auto v = lo.get_value(); v <= hi.get_value() - step; v += step) {
+        const auto a = function(T::from_value(v));
+        const auto b = other(T::from_value(v));
+        if (a.isfinite() && b.isfinite()) {
+            result = std::max(result, std::fabs(static_cast<long double>(a.get_value()) - b.get_value()));
+        }
+    }
+    return result;
+}
+
+/// @brief Expects the functions of the given accuracy tier to be within the given number
+///   of ulps of the default tier's.
+template <class T, class Tier>
+void expect_tier_within(long double bound)
+{
+    const auto max = T::get_max();
+    const auto tiny = nextafter(T(0), T(1));
+#define EXPECT_TIER(f, lo, hi) \
+    EXPECT_LE(max_ulps_apart([](T x) { return f<Tier>(x); }, [](T x) { return f(x); }, lo, hi), bound) << #f
+    EXPECT_TIER(sin, T(-8), T(8));
+    EXPECT_TIER(cos, T(-8), T(8));
+    EXPECT_TIER(tan, T(-1.5), T(1.5));
+    EXPECT_TIER(atan, T(-100), T(100));
+    EXPECT_TIER(asin, T(-1), T(1));
+    EXPECT_TIER(acos, T(-1), T(1));
+    EXPECT_TIER(log, tiny, max);
+    EXPECT_TIER(log, tiny, T(4));
+    EXPECT_TIER(log2, tiny, max);
+    EXPECT_TIER(log10, tiny, max);
+    EXPECT_TIER(log1p, T(-1), T(1000));
+    EXPECT_TIER(exp, -log(max), log(max));
+    EXPECT_TIER(exp2, -log2(max), log2(max));
+    EXPECT_TIER(expm1, -log(max), log(max));
+    EXPECT_TIER(sinh, -log(max), log(max));
+    EXPECT_TIER(cosh, -log(max), log(max));
+    EXPECT_TIER(tanh, T(-32), T(32));
+    EXPECT_TIER(sqrt, T(0), max);
+    EXPECT_TIER(cbrt, -max, max);
+#undef EXPECT_TIER
+}
+
 }
 
 template <typename T>
@@ -33,9 +109,7 @@ public:
 
 using fixed_types = ::testing::Types<
     ::realnumb::fixed32
-#ifdef REALNUMB_INT128
     , ::realnumb::fixed64
-#endif
 >;
 TYPED_TEST_SUITE(fixed_math_, fixed_types);
 
@@ -61,6 +135,45 @@ TYPED_TEST(fixed_math_, angular_normalize)
     EXPECT_EQ(detail::angular_normalize(-type(pi) * 3.0), -type(pi) * 1.0);
 }
 
+TYPED_TEST(fixed_math_, quadrant_reduce)
+{
+    using type = typename TestFixture::type;
+    for (auto i = -3600; i <= +3600; i += 5) {
+        const auto value = type(i * pi / 180);
+        const auto reduced = detail::quadrant_reduce(value);
+        const auto k = std::nearbyint(double(value) / (pi / 2));
+        const auto expected_angle = double(value) - k * (pi / 2);
+        const auto expected_quadrant = static_cast<unsigned int>(static_cast<long long>(k) & 3);
+        std::ostringstream os;
+        os << "for angle of " << i << " degrees, or " << value << " radians";
+        SCOPED_TRACE(os.str());
+        if (std::abs(std::abs(expected_angle) - pi / 4) > double(type::get_min())) {
+            EXPECT_EQ(reduced.quadrant, expected_quadrant);
+            EXPECT_NEAR(double(reduced.angle), expected_angle, double(type::get_min()));
+        }
+        EXPECT_LE(abs(reduced.angle), type(pi / 4) + type::get_min());
+    }
+}
+
+TYPED_TEST(fixed_math_, quadrant_reduce_large_angles)
+{
+    using type = typename TestFixture::type;
+    const auto max = static_cast<double>(type::get_max());
+    for (auto v = 1.0; v < max; v *= 3.1) {
+        for (const auto sign: {+1.0, -1.0}) {
+            const auto value = type(v * sign);
+            const auto reduced = detail::quadrant_reduce(value);
+            // Note: double precision pi isn't precise enough for the larger values...
+            constexpr auto half_pi = 3.14159265358979323846264338327950288L / 2;
+            const auto expected = std::remainder(static_cast<long double>(value), half_pi);
+            std::ostringstream os;
+            os << "for angle of " << value << " radians";
+            SCOPED_TRACE(os.str());
+            EXPECT_NEAR(double(reduced.angle), double(expected), double(type::get_min()));
+        }
+    }
+}
+
 TYPED_TEST(fixed_math_, isfinite)
 {
     using type = typename TestFixture::type;
@@ -122,7 +235,8 @@ TYPED_TEST(fixed_math_, log_error_handling_as_specified)
 TEST(fixed_math, log_fixed32)
 {
     ASSERT_DOUBLE_EQ(std::log(0.1), -2.3025850929940455);
-    EXPECT_NEAR(static_cast<double>(log(fixed32(0.1))), std::log(0.1),
+    // Note: fixed32(0.1) is about 0.0996 whose log is over 2 ULPs away from log(0.1)
+    EXPECT_NEAR(static_cast<double>(log(fixed32(0.1))), std::log(double(fixed32(0.1))),
                 double(fixed32::get_min() * 1));
 
     ASSERT_DOUBLE_EQ(std::log(0.5), -0.69314718055994529);
@@ -162,6 +276,128 @@ TEST(fixed_math, log_fixed32)
                 1.517);
 }
 
+TYPED_TEST(fixed_math_, log_within_1ulp)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    const auto max = type::get_max().get_value();
+    const auto tolerance = double(type::get_min());
+    for (auto v = value_type{1}; v < max; v = (max - v > v / 97 + 1)? v + v / 97 + 1: max) {
+        const auto value = type::from_value(v);
+        std::ostringstream os;
+        os << "for value of " << value;
+        SCOPED_TRACE(os.str());
+        EXPECT_NEAR(double(log(value)), std::log(static_cast<long double>(value)), tolerance);
+        EXPECT_NEAR(double(log2(value)), std::log2(static_cast<long double>(value)), tolerance);
+        EXPECT_NEAR(double(log10(value)), std::log10(static_cast<long double>(value)), tolerance);
+    }
+}
+
+TYPED_TEST(fixed_math_, log2_exact_for_powers_of_two)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    static_assert(log2(type(8)) == type(3));
+    for (auto i = 0u; i < type::total_bits - 1u; ++i) {
+        const auto value = type::from_value(value_type{1} << i);
+        EXPECT_EQ(log2(value), type(static_cast<int>(i) - static_cast<int>(type::fraction_bits)));
+    }
+}
+
+TYPED_TEST(fixed_math_, log2_and_log10_error_handling)
+{
+    using type = typename TestFixture::type;
+    EXPECT_TRUE(isnan(log2(type::get_nan())));
+    EXPECT_TRUE(isnan(log2(type(-1))));
+    EXPECT_EQ(log2(type(0)), type::get_negative_infinity());
+    EXPECT_EQ(log2(type::get_positive_infinity()), type::get_positive_infinity());
+    EXPECT_TRUE(isnan(log10(type::get_nan())));
+    EXPECT_TRUE(isnan(log10(type(-1))));
+    EXPECT_EQ(log10(type(0)), type::get_negative_infinity());
+    EXPECT_EQ(log10(type::get_positive_infinity()), type::get_positive_infinity());
+    EXPECT_EQ(log10(type(1)), type(0));
+    EXPECT_EQ(log10(type(1000)), type(3));
+}
+
+TEST(fixed_math, minimax_tables_have_fewer_terms)
+{
+    using exp_table = detail::minimax_exp<30u, detail::table_accuracy<detail::minimax_exp, 30u, 30u>()>;
+    using sin_table = detail::minimax_sin<30u, detail::table_accuracy<detail::minimax_sin, 30u, 30u>()>;
+    using cos_table = detail::minimax_cos<30u, detail::table_accuracy<detail::minimax_cos, 30u, 30u>()>;
+    using atanh_table = detail::minimax_atanh<30u, detail::table_accuracy<detail::minimax_atanh, 30u, 30u>()>;
+    using atan_table = detail::minimax_atan<30u, detail::table_accuracy<detail::minimax_atan, 30u, 30u>()>;
+    using cos62_table = detail::minimax_cos<62u, detail::table_accuracy<detail::minimax_cos, 62u, 62u>()>;
+    static_assert(exp_table::coefficients.size() < detail::exp_terms<std::int64_t>(30u));
+    static_assert(sin_table::coefficients.size() < detail::sin_cos_terms<std::int64_t>(30u));
+    static_assert(cos_table::coefficients.size() < detail::sin_cos_terms<std::int64_t>(30u));
+    static_assert(atanh_table::coefficients.size() < detail::log_terms(30u));
+    static_assert(atan_table::coefficients.size() < detail::atan_terms(30u));
+    static_assert(!detail::minimax_exp<31u, 31u>::available);
+    EXPECT_EQ(exp_table::coefficients[0], std::int64_t{1} << 30);
+    EXPECT_EQ(cos62_table::coefficients[0], std::int64_t{1} << 62);
+}
+
+TEST(fixed_math, kernel_terms_follow_fraction_bits)
+{
+    constexpr auto fixed32_bits = detail::ResultBits<fixed32::value_type, fixed32::fraction_bits>;
+    static_assert(fixed32_bits == fixed32::fraction_bits + detail::KernelGuardBits);
+    static_assert(detail::ResultBits<std::int32_t, 28u> == detail::WorkingBits<std::int32_t, 28u>);
+    static_assert(detail::sin_cos_terms<std::int64_t>(fixed32_bits) < detail::sin_cos_terms<std::int64_t>(30u));
+    static_assert(detail::log_terms(fixed32_bits) < detail::log_terms(30u));
+    static_assert(detail::atan_terms(fixed32_bits) < detail::atan_terms(30u));
+    using sin_table = detail::minimax_sin<30u, detail::table_accuracy<detail::minimax_sin, 30u, fixed32_bits>()>;
+    using full_sin_table = detail::minimax_sin<30u, detail::table_accuracy<detail::minimax_sin, 30u, 30u>()>;
+    static_assert(sin_table::coefficients.size() < full_sin_table::coefficients.size());
+    using atan_table = detail::minimax_atan<30u, detail::table_accuracy<detail::minimax_atan, 30u, fixed32_bits>()>;
+    using full_atan_table = detail::minimax_atan<30u, detail::table_accuracy<detail::minimax_atan, 30u, 30u>()>;
+    static_assert(atan_table::coefficients.size() < full_atan_table::coefficients.size());
+}
+
+TYPED_TEST(fixed_math_, bounded_kernels_match_outside_ties)
+{
+    // The kernels only evaluate the terms needed for ResultBits. Results are the same as
+    // from evaluating the terms for all of the working bits, except where the exact value
+    // is within 2^-KernelGuardBits units in the last place of a rounding boundary.
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    constexpr auto fb = type::fraction_bits;
+    constexpr auto q = detail::WorkingBits<value_type, fb>;
+    constexpr auto scale = detail::log_scale<value_type, fb>(detail::OneBits);
+    const auto to_ulps = std::ldexp(1.0L, static_cast<int>(fb));
+    const auto near_tie = [](long double exact) {
+        const auto distance = std::fabs(exact - std::floor(exact) - 0.5L);
+        return distance < std::ldexp(1.0L, -static_cast<int>(detail::KernelGuardBits));
+    };
+    const auto check = [&](value_type v) {
+        const auto arg = type::from_value(v);
+        const auto reduced = detail::quadrant_reduce(arg);
+        const auto r = static_cast<long double>(reduced.angle.get_value()) / to_ulps;
+        const auto sin_exact = (reduced.quadrant % 2u == 0u)? std::sin(r): std::cos(r);
+        if (!near_tie(((reduced.quadrant >= 2u)? -sin_exact: sin_exact) * to_ulps)) {
+            EXPECT_EQ((detail::sin<value_type, fb>(reduced)), (detail::sin<value_type, fb, q>(reduced))) << v;
+        }
+        const auto x = typename detail::wider<value_type>::type{std::abs(v)} << (q - fb);
+        const auto atan_exact = std::atan(std::fabs(static_cast<long double>(v)) / to_ulps);
+        if (!near_tie(atan_exact * to_ulps)) {
+            EXPECT_EQ(detail::round_shift(detail::atan_scaled<value_type, fb>(x), q - fb),
+                      detail::round_shift(detail::atan_scaled<value_type, fb, q>(x), q - fb)) << v;
+        }
+        if (v > 0) {
+            const auto log_exact = std::log(static_cast<long double>(v) / to_ulps);
+            if (!near_tie(log_exact * to_ulps)) {
+                EXPECT_EQ((detail::log<value_type, fb>(arg, scale)), (detail::log<value_type, fb, q>(arg, scale))) << v;
+            }
+        }
+    };
+    for (auto v = value_type{-(1 << 16)}; v <= value_type{1 << 16}; ++v) {
+        check(v);
+    }
+    const auto step = static_cast<value_type>(type::get_max().get_value() / 100000);
+    for (auto v = type::get_lowest().get_value(); v < type::get_max().get_value() - step; v += step) {
+        check(v);
+    }
+}
+
 TEST(fixed_math, exp_fixed32)
 {
     const auto terms = std::initializer_list<value_expect>{
@@ -194,6 +430,104 @@ TEST(fixed_math, exp_fixed32)
     }
 }
 
+TYPED_TEST(fixed_math_, exp_error_handling)
+{
+    using type = typename TestFixture::type;
+    EXPECT_TRUE(isnan(exp(type::get_nan())));
+    EXPECT_EQ(exp(type::get_positive_infinity()), type::get_positive_infinity());
+    EXPECT_EQ(exp(type::get_negative_infinity()), type(0));
+    EXPECT_EQ(exp(type::get_max()), type::get_positive_infinity());
+    EXPECT_EQ(exp(type::get_lowest()), type(0));
+    EXPECT_TRUE(isnan(exp2(type::get_nan())));
+    EXPECT_EQ(exp2(type::get_positive_infinity()), type::get_positive_infinity());
+    EXPECT_EQ(exp2(type::get_negative_infinity()), type(0));
+    EXPECT_EQ(exp2(type::get_max()), type::get_positive_infinity());
+    EXPECT_EQ(exp2(type::get_lowest()), type(0));
+    EXPECT_TRUE(isnan(expm1(type::get_nan())));
+    EXPECT_EQ(expm1(type::get_positive_infinity()), type::get_positive_infinity());
+    EXPECT_EQ(expm1(type::get_negative_infinity()), type(-1));
+    EXPECT_EQ(expm1(type::get_max()), type::get_positive_infinity());
+    EXPECT_EQ(expm1(type::get_lowest()), type(-1));
+}
+
+TYPED_TEST(fixed_math_, exp_within_half_ulp)
+{
+    using type = typename TestFixture::type;
+    const auto tolerance = static_cast<long double>(type::get_min()) / 2;
+    const auto max = static_cast<long double>(type::get_max());
+    const auto step = type::get_max().get_value() / 100000;
+    for (auto v = type::get_lowest().get_value() + 2; v < type::get_max().get_value() - step; v += step) {
+        const auto value = type::from_value(v);
+        std::ostringstream os;
+        os << "for value of " << value;
+        SCOPED_TRACE(os.str());
+        const auto x = static_cast<long double>(value);
+        for (const auto& result: {std::make_pair(exp(value), std::exp(x)),
+                                  std::make_pair(exp2(value), std::exp2(x)),
+                                  std::make_pair(expm1(value), std::expm1(x))}) {
+            if (result.second < max) {
+                EXPECT_NEAR(static_cast<long double>(result.first), result.second, tolerance);
+            }
+            else {
+                EXPECT_EQ(result.first, type::get_positive_infinity());
+            }
+        }
+    }
+}
+
+TYPED_TEST(fixed_math_, exp_large_results_within_1ulp)
+{
+    using type = typename TestFixture::type;
+    // Results here have more significant bits than the working bits...
+    const auto hi = log(type::get_max());
+    const auto lo = hi - type(8);
+    EXPECT_LE(max_ulps([](type x) { return exp(x); }, [](long double x) { return std::exp(x); }, lo, hi),
+              1.0L);
+    EXPECT_LE(max_ulps([](type x) { return expm1(x); }, [](long double x) { return std::expm1(x); }, lo, hi),
+              1.0L);
+    EXPECT_LE(max_ulps([](type x) { return exp2(x); }, [](long double x) { return std::exp2(x); },
+                       log2(type::get_max()) - type(8), log2(type::get_max())), 1.0L + 1.0L / 64);
+}
+
+TYPED_TEST(fixed_math_, exp2_exact_for_integers)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    static_assert(exp2(type(3)) == type(8));
+    static_assert(exp(type(0)) == type(1));
+    static_assert(expm1(type(0)) == type(0));
+    for (auto i = -static_cast<int>(type::fraction_bits);
+         i < static_cast<int>(type::total_bits - type::fraction_bits - 1u); ++i) {
+        const auto expected = value_type{1} << (i + static_cast<int>(type::fraction_bits));
+        EXPECT_EQ(exp2(type(i)), type::from_value(expected));
+    }
+}
+
+TYPED_TEST(fixed_math_, expm1_near_zero)
+{
+    using type = typename TestFixture::type;
+    for (auto v = -64; v <= +64; ++v) {
+        const auto value = type::from_value(v);
+        EXPECT_NEAR(double(expm1(value)), std::expm1(double(value)), double(type::get_min()));
+    }
+}
+
+TYPED_TEST(fixed_math_, log1p)
+{
+    using type = typename TestFixture::type;
+    EXPECT_TRUE(isnan(log1p(type::get_nan())));
+    EXPECT_TRUE(isnan(log1p(type(-2))));
+    EXPECT_TRUE(isnan(log1p(type::get_negative_infinity())));
+    EXPECT_EQ(log1p(type(-1)), type::get_negative_infinity());
+    EXPECT_EQ(log1p(type(0)), type(0));
+    EXPECT_EQ(log1p(type::get_positive_infinity()), type::get_positive_infinity());
+    EXPECT_EQ(log1p(type::get_max()), log(type::get_max()));
+    EXPECT_LE(max_ulps([](type x) { return log1p(x); }, [](long double x) { return std::log1p(x); },
+                       nextafter(type(-1), type(0)), type(1000)), 0.5L + 1.0L / 64);
+    EXPECT_LE(max_ulps([](type x) { return log1p(x); }, [](long double x) { return std::log1p(x); },
+                       type(-0.01), type(0.01)), 0.5L + 1.0L / 64);
+}
+
 TEST(fixed_math, intpow_fixed32)
 {
     ASSERT_NEAR(static_cast<double>(std::pow(0.0, 0)), 1.0, 0.0);
@@ -236,6 +570,60 @@ TEST(fixed_math, intpow_fixed32)
     EXPECT_NEAR(static_cast<double>(pow(fixed32(+10), -2)), std::pow(+10.0, -2), 0.01);
 }
 
+TYPED_TEST(fixed_math_, intpow_saturates)
+{
+    using type = typename TestFixture::type;
+    EXPECT_EQ(pow(type(2), 1000), type::get_positive_infinity());
+    EXPECT_EQ(pow(type(-2), 1000), type::get_positive_infinity());
+    EXPECT_EQ(pow(type(-2), 1001), type::get_negative_infinity());
+    EXPECT_EQ(pow(type(2), -1000), type(0));
+    EXPECT_EQ(pow(type(0.5), 1000), type(0));
+    EXPECT_EQ(pow(type(0.5), -1000), type::get_positive_infinity());
+    EXPECT_EQ(pow(type(-0.5), -1001), type::get_negative_infinity());
+    EXPECT_EQ(pow(type(-1), std::numeric_limits<int>::max()), type(-1));
+    EXPECT_EQ(pow(type(-1), std::numeric_limits<int>::lowest()), type(1));
+    EXPECT_EQ(pow(type(2), std::numeric_limits<int>::lowest()), type(0));
+}
+
+TYPED_TEST(fixed_math_, intpow_by_squaring)
+{
+    using type = typename TestFixture::type;
+    for (auto i = 0; i < static_cast<int>(type::total_bits - type::fraction_bits - 1u); ++i) {
+        EXPECT_EQ(pow(type(2), i), exp2(type(i)));
+        EXPECT_EQ(pow(type(-2), i), (i % 2)? -exp2(type(i)): exp2(type(i)));
+    }
+    for (const auto base: {1.1, -1.3, 2.5, 0.7}) {
+        for (auto n = -6; n <= 6; ++n) {
+            const auto value = type(base);
+            const auto expected = std::pow(double(value), n);
+            std::ostringstream os;
+            os << "for " << value << " to the power of " << n;
+            SCOPED_TRACE(os.str());
+            EXPECT_NEAR(double(pow(value, n)), expected, std::abs(expected) * 0.05);
+        }
+    }
+}
+
+TYPED_TEST(fixed_math_, compile_time_pow)
+{
+    using type = typename TestFixture::type;
+    static_assert(detail::pow_chain_length(15u) == 5u);
+    static_assert(detail::pow_chain_length(16u) == 4u);
+    static_assert(detail::pow_chain_length(27u) == 6u);
+    static_assert(pow<0>(type(3)) == type(1));
+    static_assert(pow<3>(type(2)) == type(8));
+    static_assert(pow<15>(type(-1)) == type(-1));
+    static_assert(pow<-2>(type(2)) == type(0.25));
+    EXPECT_EQ(pow<1000>(type(2)), type::get_positive_infinity());
+    EXPECT_EQ(pow<-1000>(type(2)), type(0));
+    EXPECT_EQ(pow<-1001>(type(-0.5)), type::get_negative_infinity());
+    EXPECT_EQ(pow<-1>(type(0)), type::get_positive_infinity());
+    const auto value = type(1.3);
+    EXPECT_NEAR(double(pow<7>(value)), double(pow(value, 7)), double(pow(value, 7)) * 0.001);
+    EXPECT_NEAR(double(pow<15>(value)), std::pow(double(value), 15), std::pow(double(value), 15) * 0.01);
+    EXPECT_NEAR(double(pow<-5>(value)), std::pow(double(value), -5), std::pow(double(value), -5) * 0.05);
+}
+
 TEST(fixed_math, regpow_fixed32)
 {
     ASSERT_NEAR(std::pow(0.0, 0.0), 1.0, 0.0);
@@ -270,6 +658,165 @@ TEST(fixed_math, regpow_fixed32)
               std::isnan(std::pow(-4.0, -2.3)));
 }
 
+TYPED_TEST(fixed_math_, rounding_matches_double)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    static_assert(floor(type(-1.5)) == type(-2));
+    static_assert(ceil(type(-1.5)) == type(-1));
+    static_assert(trunc(type(-1.5)) == type(-1));
+    static_assert(round(type(-1.5)) == type(-2));
+    static_assert(nearbyint(type(-1.5)) == type(-2));
+    static_assert(nearbyint(type(-2.5)) == type(-2));
+    constexpr auto one = value_type{1} << type::fraction_bits;
+    for (auto v = -5 * one; v <= 5 * one; v += one / 8) {
+        for (const auto raw: {v - 1, v, v + 1}) {
+            const auto value = type::from_value(raw);
+            const auto expected = double(value);
+            std::ostringstream os;
+            os << "for value of " << value;
+            SCOPED_TRACE(os.str());
+            EXPECT_EQ(double(trunc(value)), std::trunc(expected));
+            EXPECT_EQ(double(floor(value)), std::floor(expected));
+            EXPECT_EQ(double(ceil(value)), std::ceil(expected));
+            EXPECT_EQ(double(round(value)), std::round(expected));
+            EXPECT_EQ(double(nearbyint(value)), std::nearbyint(expected));
+            auto integral = type{};
+            const auto fraction = modf(value, &integral);
+            auto expected_integral = 0.0;
+            EXPECT_EQ(double(fraction), std::modf(expected, &expected_integral));
+            EXPECT_EQ(double(integral), expected_integral);
+        }
+    }
+}
+
+TYPED_TEST(fixed_math_, rounding_specials)
+{
+    using type = typename TestFixture::type;
+    for (const auto& function: {trunc<typename type::value_type, type::fraction_bits>,
+                                floor<typename type::value_type, type::fraction_bits>,
+                                ceil<typename type::value_type, type::fraction_bits>,
+                                round<typename type::value_type, type::fraction_bits>,
+                                nearbyint<typename type::value_type, type::fraction_bits>}) {
+        EXPECT_TRUE(isnan(function(type::get_nan())));
+        EXPECT_EQ(function(type::get_positive_infinity()), type::get_positive_infinity());
+        EXPECT_EQ(function(type::get_negative_infinity()), type::get_negative_infinity());
+    }
+    EXPECT_EQ(floor(type::get_lowest()), type::get_negative_infinity());
+    EXPECT_EQ(ceil(type::get_max()), type::get_positive_infinity());
+    EXPECT_EQ(round(type::get_max()), type::get_positive_infinity());
+    EXPECT_EQ(round(type::get_lowest()), type::get_negative_infinity());
+    EXPECT_EQ(nearbyint(type::get_max()), type::get_positive_infinity());
+    EXPECT_EQ(trunc(type::get_max()), type(static_cast<long long>(type::get_max())));
+    EXPECT_EQ(trunc(type::get_lowest()), type(static_cast<long long>(type::get_lowest())));
+    auto integral = type{};
+    EXPECT_EQ(modf(type::get_positive_infinity(), &integral), type(0));
+    EXPECT_EQ(integral, type::get_positive_infinity());
+    EXPECT_TRUE(isnan(modf(type::get_nan(), &integral)));
+    EXPECT_TRUE(isnan(integral));
+}
+
+TYPED_TEST(fixed_math_, fmod_and_remainder)
+{
+    using type = typename TestFixture::type;
+    static_assert(fmod(type(5.5), type(2)) == type(1.5));
+    static_assert(remainder(type(5.5), type(2)) == type(-0.5));
+    for (const auto x: {5.5, -5.5, 7.0, -7.0, 0.0, 3.25, -3.25, 1.0, 10.125, 6.0, -6.0}) {
+        for (const auto y: {2.0, -2.0, 0.75, -0.75, 4.0, 1.0, 0.5, 100.0}) {
+            std::ostringstream os;
+            os << "for " << x << " and " << y;
+            SCOPED_TRACE(os.str());
+            EXPECT_EQ(double(fmod(type(x), type(y))), std::fmod(x, y));
+            EXPECT_EQ(double(remainder(type(x), type(y))), std::remainder(x, y));
+        }
+    }
+    const auto inf = type::get_positive_infinity();
+    EXPECT_TRUE(isnan(fmod(type(1), type(0))));
+    EXPECT_TRUE(isnan(fmod(inf, type(1))));
+    EXPECT_TRUE(isnan(fmod(type::get_nan(), type(1))));
+    EXPECT_TRUE(isnan(fmod(type(1), type::get_nan())));
+    EXPECT_EQ(fmod(type(1.5), inf), type(1.5));
+    EXPECT_TRUE(isnan(remainder(type(1), type(0))));
+    EXPECT_TRUE(isnan(remainder(-inf, type(1))));
+    EXPECT_EQ(remainder(type(-1.5), -inf), type(-1.5));
+}
+
+TYPED_TEST(fixed_math_, ldexp_and_scalbn)
+{
+    using type = typename TestFixture::type;
+    static_assert((type(3) << 2) == type(12));
+    static_assert((type(3) >> 1) == type(1.5));
+    static_assert(ldexp(type(-0.75), 3) == type(-6));
+    EXPECT_EQ(ldexp(type(1), -1), type(0.5));
+    EXPECT_EQ(scalbn(type(-1.5), 4), type(-24));
+    EXPECT_EQ(ldexp(type(1), 1000), type::get_positive_infinity());
+    EXPECT_EQ(ldexp(type(-1), 1000), type::get_negative_infinity());
+    EXPECT_EQ(ldexp(type(1), std::numeric_limits<int>::lowest()), type(0));
+    EXPECT_EQ(ldexp(type(1), std::numeric_limits<int>::max()), type::get_positive_infinity());
+    EXPECT_EQ(ldexp(type(0), 1000), type(0));
+    EXPECT_EQ(ldexp(type::get_max(), 1), type::get_positive_infinity());
+    EXPECT_EQ(ldexp(type::get_lowest(), 1), type::get_negative_infinity());
+    EXPECT_TRUE(isnan(ldexp(type::get_nan(), 1)));
+    EXPECT_EQ(ldexp(type::get_negative_infinity(), -3), type::get_negative_infinity());
+    for (auto v = -300; v <= 300; v += 7) {
+        const auto value = type::from_value(v);
+        EXPECT_EQ(value >> 1, value / type(2));
+        EXPECT_EQ(value >> 3, value / type(8));
+        EXPECT_EQ(value << 3, value * type(8));
+        EXPECT_EQ((value << 5) >> 5, value);
+    }
+}
+
+TYPED_TEST(fixed_math_, frexp_and_ilogb)
+{
+    using type = typename TestFixture::type;
+    for (const auto x: {1.0, -1.0, 0.5, 3.0, -3.25, 0.1, 100.5, -1000.0, 0.75}) {
+        const auto value = type(x);
+        auto exp = 0;
+        auto expected_exp = 0;
+        const auto fraction = frexp(value, &exp);
+        const auto expected = std::frexp(double(value), &expected_exp);
+        std::ostringstream os;
+        os << "for " << value;
+        SCOPED_TRACE(os.str());
+        EXPECT_EQ(exp, expected_exp);
+        EXPECT_NEAR(double(fraction), expected, double(type::get_min()));
+        EXPECT_EQ(ldexp(fraction, exp), value);
+        EXPECT_EQ(ilogb(value), std::ilogb(double(value)));
+    }
+    auto exp = 1;
+    EXPECT_EQ(frexp(type(0), &exp), type(0));
+    EXPECT_EQ(exp, 0);
+    EXPECT_EQ(frexp(type::get_positive_infinity(), &exp), type::get_positive_infinity());
+    EXPECT_TRUE(isnan(frexp(type::get_nan(), &exp)));
+    EXPECT_EQ(ilogb(type(0)), FP_ILOGB0);
+    EXPECT_EQ(ilogb(type::get_nan()), FP_ILOGBNAN);
+    EXPECT_EQ(ilogb(type::get_negative_infinity()), std::numeric_limits<int>::max());
+    EXPECT_EQ(ilogb(type::get_min()), -static_cast<int>(type::fraction_bits));
+}
+
+TYPED_TEST(fixed_math_, fma)
+{
+    using type = typename TestFixture::type;
+    static_assert(fma(type(2), type(3), type(4)) == type(10));
+    const auto min = type::get_min();
+    // The separately rounded product of half the minimum with itself is zero...
+    EXPECT_EQ(fma(min, type(0.5), min), min * type(0.5) + min);
+    EXPECT_EQ(fma(min * type(3), type(0.5), -min), min);
+    EXPECT_EQ(fma(type::get_max(), type(2), -type::get_max()), type::get_max());
+    EXPECT_EQ(fma(type::get_max(), type(2), type(0)), type::get_positive_infinity());
+    EXPECT_EQ(fma(type::get_lowest(), type(2), type(0)), type::get_negative_infinity());
+    EXPECT_TRUE(isnan(fma(type::get_nan(), type(2), type(0))));
+    EXPECT_TRUE(isnan(fma(type::get_positive_infinity(), type(0), type(1))));
+    EXPECT_EQ(fma(type(1), type(1), type::get_negative_infinity()), type::get_negative_infinity());
+    for (const auto x: {1.1, -2.3, 0.01, 7.5}) {
+        for (const auto y: {0.7, -0.003, 3.25}) {
+            const auto expected = std::fma(double(type(x)), double(type(y)), double(type(0.5)));
+            EXPECT_NEAR(double(fma(type(x), type(y), type(0.5))), expected, double(min) / 2);
+        }
+    }
+}
+
 TYPED_TEST(fixed_math_, sqrt_error_handling)
 {
     using type = typename TestFixture::type;
@@ -300,6 +847,16 @@ TYPED_TEST(fixed_math_, sqrt_0_to_10000_within_1ulps)
     }
 }
 
+TYPED_TEST(fixed_math_, sqrt_correctly_rounded)
+{
+    using type = typename TestFixture::type;
+    EXPECT_LE(max_ulps([](type x) { return sqrt(x); }, [](long double x) { return std::sqrt(x); },
+                       type(0), type::get_max()), 0.5L);
+    EXPECT_LE(max_ulps([](type x) { return sqrt(x); }, [](long double x) { return std::sqrt(x); },
+                       type(0), type(2)), 0.5L);
+    EXPECT_EQ(sqrt(type::get_positive_infinity()), type::get_positive_infinity());
+}
+
 TEST(fixed_math, sqrt_fixed32)
 {
     const auto tolerance = static_cast<double>(fixed32::get_min());
@@ -341,6 +898,24 @@ TYPED_TEST(fixed_math_, hypot)
     }
 }
 
+TYPED_TEST(fixed_math_, cbrt)
+{
+    using type = typename TestFixture::type;
+    EXPECT_TRUE(isnan(cbrt(type::get_nan())));
+    EXPECT_EQ(cbrt(type::get_positive_infinity()), type::get_positive_infinity());
+    EXPECT_EQ(cbrt(type::get_negative_infinity()), type::get_negative_infinity());
+    EXPECT_EQ(cbrt(type(0)), type(0));
+    for (auto i = 1; i < 100; ++i) {
+        EXPECT_EQ(cbrt(type(i * i * i)), type(i)) << i;
+        EXPECT_EQ(cbrt(type(-i * i * i)), type(-i)) << i;
+    }
+    EXPECT_EQ(cbrt(type(0.125)), type(0.5));
+    EXPECT_LE(max_ulps([](type x) { return cbrt(x); }, [](long double x) { return std::cbrt(x); },
+                       type::get_lowest(), type::get_max()), 0.5L);
+    EXPECT_LE(max_ulps([](type x) { return cbrt(x); }, [](long double x) { return std::cbrt(x); },
+                       type(-0.01), type(0.01)), 0.5L);
+}
+
 TYPED_TEST(fixed_math_, sin_error_handling)
 {
     using type = typename TestFixture::type;
@@ -514,7 +1089,6 @@ TEST(fixed_math, sin_fixed32)
     EXPECT_NEAR(static_cast<double>(sin(fixed32(-10))), std::sin(-10), 0.015);
 }
 
-#ifdef REALNUMB_INT128
 TEST(fixed_math, sin_fixed64)
 {
     EXPECT_NEAR(static_cast<double>(sin(fixed64(0))), 0.0, 0.002);
@@ -541,7 +1115,6 @@ TEST(fixed_math, sin_fixed64)
     EXPECT_NEAR(static_cast<double>(sin(fixed64(+10))), std::sin(+10), 0.002);
     EXPECT_NEAR(static_cast<double>(sin(fixed64(-10))), std::sin(-10), 0.002);
 }
-#endif
 
 TEST(fixed_math, cos_fixed32)
 {
@@ -560,7 +1133,6 @@ TEST(fixed_math, cos_fixed32)
     EXPECT_NEAR(static_cast<double>(cos(fixed32(-10))), std::cos(-10), 0.015);
 }
 
-#ifdef REALNUMB_INT128
 TEST(fixed_math, cos_fixed64)
 {
     EXPECT_NEAR(static_cast<double>(cos(fixed64(0))), 1.0, 0.01);
@@ -577,7 +1149,6 @@ TEST(fixed_math, cos_fixed64)
     EXPECT_NEAR(static_cast<double>(cos(fixed64(+10))), std::cos(+10), 0.002);
     EXPECT_NEAR(static_cast<double>(cos(fixed64(-10))), std::cos(-10), 0.002);
 }
-#endif
 
 TYPED_TEST(fixed_math_, atan)
 {
@@ -588,6 +1159,56 @@ TYPED_TEST(fixed_math_, atan)
                 std::atan(-std::numeric_limits<double>::infinity()), 0.001);
 }
 
+TYPED_TEST(fixed_math_, atan_within_half_ulp)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    const auto to_ulps = std::ldexp(1.0L, static_cast<int>(type::fraction_bits));
+    // Results are correctly rounded except for exact values within 2^-KernelGuardBits
+    // units in the last place of a tie.
+    const auto tolerance = 0.5L + std::ldexp(1.0L, -static_cast<int>(detail::KernelGuardBits));
+    const auto step = static_cast<value_type>(type::get_max().get_value() / 100000);
+    for (auto v = type::get_lowest().get_value(); v < type::get_max().get_value() - step; v += step) {
+        const auto exact = std::atan(static_cast<long double>(v) / to_ulps);
+        const auto result = static_cast<long double>(atan(type::from_value(v)).get_value()) / to_ulps;
+        EXPECT_LE(std::fabs(result - exact) * to_ulps, tolerance) << v;
+    }
+    EXPECT_EQ(atan(type(-1)), -atan(type(1)));
+    EXPECT_EQ(atan(type::get_max()), -atan(type::get_lowest()));
+}
+
+TYPED_TEST(fixed_math_, tan)
+{
+    using type = typename TestFixture::type;
+    EXPECT_TRUE(isnan(tan(type::get_nan())));
+    EXPECT_TRUE(isnan(tan(type::get_positive_infinity())));
+    EXPECT_TRUE(isnan(tan(type::get_negative_infinity())));
+    EXPECT_EQ(tan(type(0)), type(0));
+    EXPECT_EQ(tan(type(-2)), -tan(type(2)));
+    // Near its poles, tan is accurate relative to its magnitude rather than to an ulp...
+    EXPECT_LE(max_ulps([](type x) { return tan(x); }, [](long double x) { return std::tan(x); },
+                       type(-8), type(8), 64.0L), 0.5L + 1.0L / 64);
+}
+
+TYPED_TEST(fixed_math_, asin_and_acos)
+{
+    using type = typename TestFixture::type;
+    for (const auto& value: {type::get_nan(), type::get_negative_infinity(), type::get_positive_infinity(),
+                             nextafter(type(1), type(2)), nextafter(type(-1), type(-2))}) {
+        EXPECT_TRUE(isnan(asin(value)));
+        EXPECT_TRUE(isnan(acos(value)));
+    }
+    EXPECT_EQ(asin(type(0)), type(0));
+    EXPECT_EQ(acos(type(1)), type(0));
+    EXPECT_EQ(asin(type(1)), -asin(type(-1)));
+    EXPECT_EQ(asin(type(1)), acos(type(0)));
+    EXPECT_NEAR(static_cast<double>(acos(type(-1))), pi, static_cast<double>(type::get_min()));
+    EXPECT_LE(max_ulps([](type x) { return asin(x); }, [](long double x) { return std::asin(x); },
+                       type(-1), type(1)), 0.5L + 1.0L / 64);
+    EXPECT_LE(max_ulps([](type x) { return acos(x); }, [](long double x) { return std::acos(x); },
+                       type(-1), type(1)), 0.5L + 1.0L / 64);
+}
+
 TEST(fixed_math, atan2_specials_fixed32)
 {
     EXPECT_TRUE(std::isnan(static_cast<double>(atan2(fixed32(0), fixed32(0)))));
@@ -612,6 +1233,43 @@ TEST(fixed_math, atan2_angles_fixed32)
     }
 }
 
+TYPED_TEST(fixed_math_, hyperbolic_specials)
+{
+    using type = typename TestFixture::type;
+    EXPECT_TRUE(isnan(sinh(type::get_nan())));
+    EXPECT_TRUE(isnan(cosh(type::get_nan())));
+    EXPECT_TRUE(isnan(tanh(type::get_nan())));
+    EXPECT_EQ(sinh(type::get_positive_infinity()), type::get_positive_infinity());
+    EXPECT_EQ(sinh(type::get_negative_infinity()), type::get_negative_infinity());
+    EXPECT_EQ(cosh(type::get_negative_infinity()), type::get_positive_infinity());
+    EXPECT_EQ(tanh(type::get_positive_infinity()), type(1));
+    EXPECT_EQ(tanh(type::get_negative_infinity()), type(-1));
+    EXPECT_EQ(sinh(type::get_max()), type::get_positive_infinity());
+    EXPECT_EQ(sinh(type::get_lowest()), type::get_negative_infinity());
+    EXPECT_EQ(cosh(type::get_lowest()), type::get_positive_infinity());
+    EXPECT_EQ(tanh(type::get_max()), type(1));
+    EXPECT_EQ(sinh(type(0)), type(0));
+    EXPECT_EQ(cosh(type(0)), type(1));
+    EXPECT_EQ(tanh(type(0)), type(0));
+    EXPECT_EQ(sinh(type(-3)), -sinh(type(3)));
+    EXPECT_EQ(cosh(type(-3)), cosh(type(3)));
+    EXPECT_EQ(tanh(type(-3)), -tanh(type(3)));
+}
+
+TYPED_TEST(fixed_math_, hyperbolic_within_1ulp)
+{
+    using type = typename TestFixture::type;
+    const auto hi = log(type::get_max());
+    EXPECT_LE(max_ulps([](type x) { return sinh(x); }, [](long double x) { return std::sinh(x); },
+                       -hi, hi), 1.0L);
+    EXPECT_LE(max_ulps([](type x) { return cosh(x); }, [](long double x) { return std::cosh(x); },
+                       -hi, hi), 1.0L);
+    EXPECT_LE(max_ulps([](type x) { return sinh(x); }, [](long double x) { return std::sinh(x); },
+                       type(-4), type(4)), 0.5L + 1.0L / 64);
+    EXPECT_LE(max_ulps([](type x) { return tanh(x); }, [](long double x) { return std::tanh(x); },
+                       type(-32), type(32)), 0.5L + 1.0L / 64);
+}
+
 TYPED_TEST(fixed_math_, InfinityDividedByInfinityIsNaN)
 {
     using type = typename TestFixture::type;
@@ -654,6 +1312,65 @@ TEST(fixed_math, BiggerValsIdenticallyInaccurate_fixed32)
     }
 }
 
+TEST(fixed_math, whole_domain_of_fixed8)
+{
+    using type = fixed8;
+    const auto lo = type::get_lowest();
+    const auto hi = type::get_max();
+    const auto max = static_cast<long double>(hi);
+    // With only four fraction bits, the two bits of working precision beyond them are
+    // all that these get. So some are off by more than half an ulp.
+    EXPECT_LE(max_ulps([](type x) { return sqrt(x); }, [](long double x) { return std::sqrt(x); },
+                       type(0), hi), 0.5L);
+    EXPECT_LE(max_ulps([](type x) { return cbrt(x); }, [](long double x) { return std::cbrt(x); }, lo, hi),
+              1.0L);
+    EXPECT_LE(max_ulps([](type x) { return sin(x); }, [](long double x) { return std::sin(x); }, lo, hi),
+              1.25L);
+    EXPECT_LE(max_ulps([](type x) { return cos(x); }, [](long double x) { return std::cos(x); }, lo, hi),
+              1.25L);
+    EXPECT_LE(max_ulps([](type x) { return atan(x); }, [](long double x) { return std::atan(x); }, lo, hi),
+              0.75L);
+    EXPECT_LE(max_ulps([](type x) { return exp(x); }, [](long double x) { return std::exp(x); },
+                       lo, hi, max), 0.6L);
+    EXPECT_LE(max_ulps([](type x) { return log(x); }, [](long double x) { return std::log(x); },
+                       type::get_min(), hi), 0.75L);
+    EXPECT_LE(max_ulps([](type x) { return log2(x); }, [](long double x) { return std::log2(x); },
+                       type::get_min(), hi), 1.0L);
+    EXPECT_LE(max_ulps([](type x) { return log10(x); }, [](long double x) { return std::log10(x); },
+                       type::get_min(), hi), 0.75L);
+    EXPECT_LE(max_ulps([](type x) { return tanh(x); }, [](long double x) { return std::tanh(x); }, lo, hi),
+              0.75L);
+}
+
+TEST(fixed_math, whole_domain_of_fixed16)
+{
+    using type = fixed16;
+    const auto lo = type::get_lowest();
+    const auto hi = type::get_max();
+    const auto max = static_cast<long double>(hi);
+    EXPECT_LE(max_ulps([](type x) { return sqrt(x); }, [](long double x) { return std::sqrt(x); },
+                       type(0), hi), 0.5L);
+    EXPECT_LE(max_ulps([](type x) { return sin(x); }, [](long double x) { return std::sin(x); }, lo, hi),
+              1.0L);
+    EXPECT_LE(max_ulps([](type x) { return cos(x); }, [](long double x) { return std::cos(x); }, lo, hi),
+              1.0L);
+    EXPECT_LE(max_ulps([](type x) { return atan(x); }, [](long double x) { return std::atan(x); }, lo, hi),
+              0.55L);
+    EXPECT_LE(max_ulps([](type x) { return exp(x); }, [](long double x) { return std::exp(x); },
+                       lo, hi, max), 0.75L);
+    EXPECT_LE(max_ulps([](type x) { return log(x); }, [](long double x) { return std::log(x); },
+                       type::get_min(), hi), 0.6L);
+    EXPECT_LE(max_ulps([](type x) { return log2(x); }, [](long double x) { return std::log2(x); },
+                       type::get_min(), hi), 0.6L);
+    EXPECT_LE(max_ulps([](type x) { return log10(x); }, [](long double x) { return std::log10(x); },
+                       type::get_min(), hi), 0.6L);
+    EXPECT_LE(max_ulps([](type x) { return tanh(x); }, [](long double x) { return std::tanh(x); }, lo, hi),
+              0.55L);
+    for (auto i = -8; i < 7; ++i) {
+        EXPECT_EQ(log2(type(std::ldexp(1.0, i))), type(i));
+    }
+}
+
 TEST(fixed_math, nextafter)
 {
     using fixed_32_0 = fixed<std::int32_t, 0>;
@@ -720,6 +1437,25 @@ TYPED_TEST(fixed_math_, nextafter_to_lower_is_lower)
     }
 }
 
+TYPED_TEST(fixed_math_, accuracy_tiers)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    constexpr auto fb = type::fraction_bits;
+    static_assert(detail::TierBits<precise, value_type, fb> == detail::ResultBits<value_type, fb>);
+    static_assert(detail::TierBits<balanced, value_type, fb> < detail::TierBits<precise, value_type, fb>);
+    static_assert(detail::TierBits<fast, value_type, fb> < detail::TierBits<balanced, value_type, fb>);
+    static_assert(detail::ExpTierBits<precise, value_type, fb> == detail::ExpBits<value_type, fb> + 1u);
+    static_assert(sin<fast>(type(0)) == type(0));
+    static_assert(exp<fast>(type(0)) == type(1));
+    EXPECT_TRUE(isnan(log<fast>(type(-1))));
+    EXPECT_EQ(exp<balanced>(type::get_max()), type::get_positive_infinity());
+    EXPECT_EQ(sqrt<precise>(type(4)), sqrt(type(4)));
+    expect_tier_within<type, precise>(0.0L);
+    expect_tier_within<type, balanced>(1.0L);
+    expect_tier_within<type, fast>(4.0L);
+}
+
 TYPED_TEST(fixed_math_, fpclassify)
 {
     using type = typename TestFixture::type;
@@ -729,3 +1465,250 @@ TYPED_TEST(fixed_math_, fpclassify)
     EXPECT_EQ(fpclassify(type()), FP_ZERO);
     EXPECT_EQ(fpclassify(type(1)), FP_NORMAL);
 }
+
+template <typename T>
+class fixed_math_high_: public testing::Test {
+public:
+    using type = T;
+};
+
+/// @brief 64-bit types with 32 or more fraction bits.
+/// @note These have more bits than double so they're checked against long double.
+using high_fraction_bits_types = ::testing::Types<
+    ::realnumb::fixed<std::int64_t, 32>
+    , ::realnumb::fixed<std::int64_t, 48>
+    , ::realnumb::fixed<std::int64_t, 56>
+>;
+TYPED_TEST_SUITE(fixed_math_high_, high_fraction_bits_types);
+
+TYPED_TEST(fixed_math_high_, basics)
+{
+    using type = typename TestFixture::type;
+    using value_type = typename type::value_type;
+    static_assert(type::scale_factor == value_type{1} << type::fraction_bits);
+    static_assert(type(1).get_value() == type::scale_factor);
+    static_assert(type(-2, 1u).get_value() == -2 * type::scale_factor + 1);
+    static_assert(type(3, std::uint64_t{1} << (type::fraction_bits - 1u)) == type(3.5));
+    static_assert(type(1u) == type(1));
+    static_assert(type(0.25f) * 4 == 1);
+    static_assert(type(1) / 3 * 3 != 1);
+    static_assert(log2(type(8)) == type(3));
+    static_assert(sqrt(type(16)) == type(4));
+    EXPECT_EQ(static_cast<long double>(type::get_min()), std::ldexp(1.0L, -static_cast<int>(type::fraction_bits)));
+    EXPECT_EQ(type(std::ldexp(1.0L, static_cast<int>(type::whole_bits) - 1)), type::get_positive_infinity());
+    EXPECT_EQ(type(-std::ldexp(1.0L, static_cast<int>(type::whole_bits) - 1)), type::get_negative_infinity());
+    EXPECT_EQ(static_cast<long double>(type(1.0L / 3)), std::round(std::ldexp(1.0L / 3, type::fraction_bits)) / type::scale_factor);
+}
+
+TYPED_TEST(fixed_math_high_, within_1ulp)
+{
+    using type = typename TestFixture::type;
+    const auto hi = type::get_max();
+    const auto max = static_cast<long double>(hi);
+    const auto tiny = type::get_min();
+    const auto trig = std::min(type(100), hi);
+#define EXPECT_ULPS(bound, f, lo, h, ...) \
+    EXPECT_LE(max_ulps([](type x) { return f(x); }, [](long double x) { return std::f(x); }, \
+                       lo, h, ##__VA_ARGS__), bound) << #f
+    EXPECT_ULPS(0.5L, sqrt, type(0), hi);
+    EXPECT_ULPS(0.5L, cbrt, -hi, hi);
+    EXPECT_ULPS(1.25L, sin, -trig, trig);
+    EXPECT_ULPS(1.25L, cos, -trig, trig);
+    EXPECT_ULPS(1.0L, tan, type(-1), type(1));
+    EXPECT_ULPS(4.0L, tan, type(-1.5), type(1.5));
+    EXPECT_ULPS(1.0L, atan, -hi, hi);
+    EXPECT_ULPS(1.0L, asin, type(-1), type(1));
+    EXPECT_ULPS(1.0L, acos, type(-1), type(1));
+    EXPECT_ULPS(1.0L, exp, -log(hi), log(hi), max);
+    EXPECT_ULPS(1.0L, exp2, -log2(hi), log2(hi), max);
+    EXPECT_ULPS(1.0L, expm1, type(-1), log(hi), max);
+    EXPECT_ULPS(1.0L, log, tiny, hi);
+    EXPECT_ULPS(1.0L, log2, tiny, hi);
+    EXPECT_ULPS(1.0L, log10, tiny, hi);
+    EXPECT_ULPS(1.0L, log1p, type(-0.5), hi);
+    EXPECT_ULPS(1.0L, sinh, -log(hi), log(hi), max);
+    EXPECT_ULPS(1.0L, cosh, -log(hi), log(hi), max);
+    EXPECT_ULPS(1.0L, tanh, type(-8), type(8));
+#undef EXPECT_ULPS
+    for (auto i = 0u; i < type::total_bits - 1u; ++i) {
+        const auto value = type::from_value(std::int64_t{1} << i);
+        EXPECT_EQ(log2(value), type(static_cast<int>(i) - static_cast<int>(type::fraction_bits)));
+    }
+}
+
+#ifdef REALNUMB_INT128
+namespace {
+
+/// @brief Gets the fixed128 value of the given whole part and 64 fraction bits.
+constexpr auto make_fixed128(std::int64_t whole, std::uint64_t fraction) -> fixed128
+{
+    return fixed128::from_value(static_cast<REALNUMB_INT128>(whole) * fixed128::scale_factor + fraction);
+}
+
+/// @brief Gets the difference in ulps between the given fixed128 values.
+auto ulps_apart(fixed128 a, fixed128 b) -> long double
+{
+    return std::fabs(static_cast<long double>(a.get_value() - b.get_value()));
+}
+
+} // namespace
+
+TEST(fixed_math, fixed128_pi_has_all_fraction_bits)
+{
+    static_assert(detail::FixedPi<REALNUMB_INT128, 64u> == make_fixed128(3, 0x243F6A8885A308D3u));
+    EXPECT_EQ(atan(fixed128::get_positive_infinity()), make_fixed128(1, 0x921FB54442D1846Au));
+}
+
+TEST(fixed_math, fixed128_within_1ulp)
+{
+    // Expected values are the exact results rounded to 64 fraction bits.
+    EXPECT_EQ(sqrt(fixed128(2)), make_fixed128(1, 0x6A09E667F3BCC909u));
+    EXPECT_EQ(cbrt(fixed128(2)), make_fixed128(1, 0x428A2F98D728AE22u));
+    EXPECT_LE(ulps_apart(exp(fixed128(1)), make_fixed128(2, 0xB7E151628AED2A6Bu)), 1.0L);
+    EXPECT_LE(ulps_apart(exp(fixed128(-3)), make_fixed128(0, 0x0CBED86667585765u)), 1.0L);
+    EXPECT_LE(ulps_apart(exp(fixed128(20)), make_fixed128(485165195, 0x68E80402189797F9u)), 1.0L);
+    EXPECT_LE(ulps_apart(exp2(fixed128(0.5)), make_fixed128(1, 0x6A09E667F3BCC909u)), 1.0L);
+    EXPECT_LE(ulps_apart(expm1(fixed128(0x1p-40)), make_fixed128(0, 0x0000000001000000u)), 1.0L);
+    EXPECT_LE(ulps_apart(log(fixed128(3)), make_fixed128(1, 0x193EA7AAD030A977u)), 1.0L);
+    EXPECT_LE(ulps_apart(log2(fixed128(3)), make_fixed128(1, 0x95C01A39FBD687A0u)), 1.0L);
+    EXPECT_LE(ulps_apart(log10(fixed128(3)), make_fixed128(0, 0x7A249E593F57F423u)), 1.0L);
+    EXPECT_LE(ulps_apart(sin(fixed128(1)), make_fixed128(0, 0xD76AA47848677021u)), 1.0L);
+    EXPECT_LE(ulps_apart(cos(fixed128(1)), make_fixed128(0, 0x8A51407DA8345C92u)), 1.0L);
+    EXPECT_LE(ulps_apart(sin(fixed128(-100)), make_fixed128(0, 0x81A12DBC626DC038u)), 1.0L);
+    EXPECT_LE(ulps_apart(tan(fixed128(0.5)), make_fixed128(0, 0x8BDA7ADF9A3A5219u)), 1.0L);
+    EXPECT_LE(ulps_apart(atan(fixed128(0.5)), make_fixed128(0, 0x76B19C1586ED3DA3u)), 1.0L);
+    EXPECT_LE(ulps_apart(asin(fixed128(0.5)), make_fixed128(0, 0x860A91C16B9B2C23u)), 1.0L);
+    EXPECT_LE(ulps_apart(acos(fixed128(-0.5)), make_fixed128(2, 0x182A4705AE6CB08Du)), 1.0L);
+    EXPECT_LE(ulps_apart(sinh(fixed128(2)), make_fixed128(3, 0xA079EC76DC33EDE7u)), 1.0L);
+    EXPECT_LE(ulps_apart(cosh(fixed128(2)), make_fixed128(3, 0xC31F41BE5B378526u)), 1.0L);
+    EXPECT_LE(ulps_apart(tanh(fixed128(0.5)), make_fixed128(0, 0x764D4F5D5A2BCD94u)), 1.0L);
+}
+
+TEST(fixed_math, fixed128_specials)
+{
+    static_assert(sqrt(fixed128(4)) == fixed128(2));
+    static_assert(exp(fixed128(0)) == fixed128(1));
+    EXPECT_TRUE(isnan(sqrt(fixed128(-1))));
+    EXPECT_TRUE(isnan(log(fixed128(-1))));
+    EXPECT_EQ(log(fixed128(0)), fixed128::get_negative_infinity());
+    EXPECT_EQ(log2(fixed128(1024)), fixed128(10));
+    EXPECT_EQ(exp2(fixed128(62)), fixed128(0x1p62));
+    EXPECT_EQ(exp(fixed128(44)), fixed128::get_positive_infinity());
+    EXPECT_EQ(exp(fixed128(-100)), fixed128(0));
+    EXPECT_EQ(sin(fixed128(0)), fixed128(0));
+    EXPECT_EQ(pow(fixed128(3), 20), fixed128(3486784401.0));
+    EXPECT_EQ(fma(fixed128(1.5), fixed128(-2.5), fixed128(4)), fixed128(0.25));
+    EXPECT_EQ(round(fixed128(-2.5)), fixed128(-3));
+    EXPECT_EQ(floor(fixed128(-2.5)), fixed128(-3));
+    EXPECT_EQ(ceil(fixed128(-2.5)), fixed128(-2));
+}
+#endif
+
+namespace {
+
+/// @brief Fixed type on four limbs having 192 fraction bits.
+using fixed256 = fixed<limbs<4>, 192u>;
+
+/// @brief Gets the fixed256 value of the given whole part and 192 fraction bits, the
+///   highest 64 of them first.
+constexpr auto make_fixed256(std::int64_t whole, std::uint64_t f2, std::uint64_t f1, std::uint64_t f0)
+    -> fixed256
+{
+    return fixed256::from_value(limbs<4>::from_limbs({f0, f1, f2, static_cast<std::uint64_t>(whole)}));
+}
+
+/// @brief Gets the difference in ulps between the given fixed256 values.
+auto ulps_apart(fixed256 a, fixed256 b) -> long double
+{
+    return std::fabs(static_cast<long double>(a.get_value() - b.get_value()));
+}
+
+} // namespace
+
+TEST(fixed_math, fixed256_traits)
+{
+    static_assert(is_arithmetic_v<fixed256>);
+    static_assert(std::is_trivial_v<fixed256>);
+    static_assert(std::is_same_v<detail::wider<limbs<4>>::type, limbs<8>>);
+    static_assert(detail::FixedPi<limbs<4>, 192u> == make_fixed256(3, 0x243F6A8885A308D3u, 0x13198A2E03707344u, 0xA4093822299F31D0u));
+    static_assert(sqrt(fixed256(4)) == fixed256(2));
+    static_assert(exp(fixed256(0)) == fixed256(1));
+    static_assert(static_cast<double>(fixed256(-2.5) * fixed256(0.5)) == -1.25);
+    SUCCEED();
+}
+
+TEST(fixed_math, fixed256_within_1ulp)
+{
+    // Expected values are the exact results rounded to 192 fraction bits.
+    EXPECT_EQ(sqrt(fixed256(2)), make_fixed256(1, 0x6A09E667F3BCC908u, 0xB2FB1366EA957D3Eu, 0x3ADEC1751277509Au));
+    EXPECT_LE(ulps_apart(cbrt(fixed256(2)),
+        make_fixed256(1, 0x428A2F98D728AE22u, 0x3DDAB715BE250D0Cu, 0x288F10291631FBC0u)), 1.0L);
+    EXPECT_LE(ulps_apart(exp(fixed256(1)),
+        make_fixed256(2, 0xB7E151628AED2A6Au, 0xBF7158809CF4F3C7u, 0x62E7160F38B4DA57u)), 1.0L);
+    EXPECT_LE(ulps_apart(exp(fixed256(-3)),
+        make_fixed256(0, 0x0CBED86667585764u, 0xA4130191C8408680u, 0x3A08AE39CDC318C6u)), 1.0L);
+    EXPECT_LE(ulps_apart(exp(fixed256(20)),
+        make_fixed256(485165195, 0x68E80402189797F9u, 0x599CB8B6B997AD7Bu, 0x2C69C9ECFA733D2Bu)), 1.0L);
+    EXPECT_LE(ulps_apart(log(fixed256(3)),
+        make_fixed256(1, 0x193EA7AAD030A976u, 0xA4198D55053B7CB5u, 0xBE1442D9B7E08DF0u)), 1.0L);
+    EXPECT_LE(ulps_apart(log2(fixed256(3)),
+        make_fixed256(1, 0x95C01A39FBD6879Fu, 0xA00B120A068BADD1u, 0x24F3E6A3A259B040u)), 1.0L);
+    EXPECT_LE(ulps_apart(log10(fixed256(3)),
+        make_fixed256(0, 0x7A249E593F57F423u, 0x0C0D0EA086890763u, 0x84571AB306DBEE16u)), 1.0L);
+    EXPECT_LE(ulps_apart(sin(fixed256(1)),
+        make_fixed256(0, 0xD76AA47848677020u, 0xC6E9E909C50F3C32u, 0x89E511132F518B4Eu)), 1.0L);
+    EXPECT_LE(ulps_apart(cos(fixed256(1)),
+        make_fixed256(0, 0x8A51407DA8345C91u, 0xC2466D976871BD29u, 0xA2373A894F96C3B8u)), 1.0L);
+    EXPECT_LE(ulps_apart(sin(fixed256(-100)),
+        make_fixed256(0, 0x81A12DBC626DC038u, 0x47B0AAE841F590E3u, 0x57892550CEA15742u)), 1.0L);
+    EXPECT_LE(ulps_apart(tan(fixed256(0.5)),
+        make_fixed256(0, 0x8BDA7ADF9A3A5218u, 0xBCB2403C41222664u, 0x5333BF517BD5F9BEu)), 1.0L);
+    EXPECT_LE(ulps_apart(atan(fixed256(0.5)),
+        make_fixed256(0, 0x76B19C1586ED3DA2u, 0xB7F222F65E1D4681u, 0xB70A0AC3930E6F80u)), 1.0L);
+    EXPECT_LE(ulps_apart(asin(fixed256(0.5)),
+        make_fixed256(0, 0x860A91C16B9B2C23u, 0x2DD99707AB3D688Bu, 0x70AC3405B19A884Du)), 1.0L);
+    EXPECT_LE(ulps_apart(acos(fixed256(-0.5)),
+        make_fixed256(2, 0x182A4705AE6CB08Cu, 0xB7665C1EACF5A22Du, 0xC2B0D016C66A2135u)), 1.0L);
+    EXPECT_LE(ulps_apart(sinh(fixed256(2)),
+        make_fixed256(3, 0xA079EC76DC33EDE6u, 0x9900592C4012E1DEu, 0x96EE2ADDCCFEDA90u)), 1.0L);
+    EXPECT_LE(ulps_apart(cosh(fixed256(2)),
+        make_fixed256(3, 0xC31F41BE5B378526u, 0x4FEE2EEE9A180CC2u, 0x87CBC0FB6F89A426u)), 1.0L);
+    EXPECT_LE(ulps_apart(tanh(fixed256(0.5)),
+        make_fixed256(0, 0x764D4F5D5A2BCD94u, 0x4A3B887196C234E9u, 0xF32657A0B7D69A41u)), 1.0L);
+}
+
+TEST(fixed_math, fixed256_specials)
+{
+    EXPECT_TRUE(isnan(sqrt(fixed256(-1))));
+    EXPECT_EQ(log(fixed256(0)), fixed256::get_negative_infinity());
+    EXPECT_EQ(log2(fixed256(1024)), fixed256(10));
+    EXPECT_EQ(exp2(fixed256(62)), fixed256(0x1p62));
+    EXPECT_EQ(exp(fixed256(44)), fixed256::get_positive_infinity());
+    EXPECT_EQ(pow(fixed256(3), 20), fixed256(3486784401.0));
+    EXPECT_EQ(round(fixed256(-2.5)), fixed256(-3));
+    EXPECT_EQ(floor(fixed256(-2.5)), fixed256(-3));
+    EXPECT_EQ(ceil(fixed256(-2.5)), fixed256(-2));
+}
+
+#ifdef REALNUMB_INT128
+TEST(fixed_math, fixed_limbs_matches_fixed128)
+{
+    using type = fixed<limbs<2>, 64u>;
+    const auto same = [](type a, fixed128 b) {
+        return static_cast<REALNUMB_INT128>(a.get_value()) == b.get_value();
+    };
+    for (auto v = -40.0; v <= 40.0; v += 0.173)
+    {
+        const auto a = type(v);
+        const auto b = fixed128(v);
+        EXPECT_TRUE(same(a * type(2.2), b * fixed128(2.2)));
+        EXPECT_TRUE(same(a / type(-3.3), b / fixed128(-3.3)));
+        EXPECT_TRUE(same(sqrt(a), sqrt(b)));
+        EXPECT_TRUE(same(exp(a), exp(b)));
+        EXPECT_TRUE(same(log(a), log(b)));
+        EXPECT_TRUE(same(sin(a), sin(b)));
+        EXPECT_TRUE(same(atan2(a, type(0.7)), atan2(b, fixed128(0.7))));
+        EXPECT_TRUE(same(pow(type(5.5), a), pow(fixed128(5.5), b)));
+    }
+}
+#endif
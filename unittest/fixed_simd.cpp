@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int8_t
+#include <type_traits> // for std::is_same_v
+#include <vector>
+
+#include <realnumb/fixed_simd.hpp>
+#include <realnumb/is_arithmetic.hpp>
+#include <realnumb/math.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+/// @brief Gets values covering the special values, the range limits and ordinary values.
+template <class T>
+auto interesting_values() -> std::vector<T>
+{
+    return {
+        T::get_nan(), T::get_negative_infinity(), T::get_lowest(), T::get_lowest() + T::get_min(),
+        T(-1000.5), T(-3), T(-1), T(-0.5), -T::get_min(), T(0), T::get_min(), T(0.5), T(1),
+        T(2.25), T(3), T(1000.5), T::get_max() - T::get_min(), T::get_max(), T::get_positive_infinity(),
+    };
+}
+
+/// @brief Checks that the given lane-wise operation matches the given scalar one for every
+///   pair of interesting values.
+template <class T, class SimdOp, class ScalarOp>
+void expect_lanewise(SimdOp simd_op, ScalarOp scalar_op)
+{
+    using simd = fixed_simd<T, 4>;
+    const auto values = interesting_values<T>();
+    for (const auto& a: values) {
+        for (auto j = std::size_t{0}; j < values.size(); j += 4u) {
+            auto b = std::array<T, 4>{};
+            for (auto k = std::size_t{0}; k < 4u; ++k) {
+                b[k] = values[(j + k) % values.size()];
+            }
+            const auto result = simd_op(simd(a), simd(b));
+            for (auto k = std::size_t{0}; k < 4u; ++k) {
+                EXPECT_EQ(result[k].get_value(), scalar_op(a, b[k]).get_value()) << a << ", " << b[k];
+            }
+        }
+    }
+}
+
+}
+
+TEST(fixed_simd, traits)
+{
+    using simd = fixed_simd<fixed32, 8>;
+    static_assert(simd::size() == 8u);
+    static_assert(simd::mask_type::size() == 8u);
+    static_assert(std::is_same_v<simd::value_type, fixed32>);
+    static_assert(std::is_trivially_copyable_v<simd>);
+    static_assert(is_arithmetic_v<simd>);
+    SUCCEED();
+}
+
+TEST(fixed_simd, lanes)
+{
+    const auto values = std::array<fixed32, 4>{fixed32(1), fixed32(-2), fixed32(0.5), fixed32::get_nan()};
+    const auto simd = fixed_simd<fixed32, 4>(values);
+    EXPECT_EQ(simd[0], fixed32(1));
+    EXPECT_EQ(simd[1], fixed32(-2));
+    EXPECT_EQ(simd[2], fixed32(0.5));
+    EXPECT_TRUE(simd[3].isnan());
+    auto stored = std::array<fixed32, 4>{};
+    fixed_simd<fixed32, 4>::load(values.data()).store(stored.data());
+    EXPECT_EQ(stored[1], values[1]);
+    EXPECT_EQ(decltype(simd)::from_values(simd.get_values())[2], fixed32(0.5));
+    const auto broadcast = fixed_simd<fixed32, 4>(3);
+    EXPECT_EQ(broadcast[0], fixed32(3));
+    EXPECT_EQ(broadcast[3], fixed32(3));
+}
+
+TEST(fixed_simd, arithmetic_matches_fixed32)
+{
+    using T = fixed32;
+    using simd = fixed_simd<T, 4>;
+    expect_lanewise<T>([](simd a, simd b){ return a + b; }, [](T a, T b){ return a + b; });
+    expect_lanewise<T>([](simd a, simd b){ return a - b; }, [](T a, T b){ return a - b; });
+    expect_lanewise<T>([](simd a, simd b){ return a * b; }, [](T a, T b){ return a * b; });
+    expect_lanewise<T>([](simd a, simd b){ return a / select(b != simd(0), b, simd(1)); },
+                       [](T a, T b){ return a / ((b != T(0))? b: T(1)); });
+    expect_lanewise<T>([](simd a, simd){ return -a; }, [](T a, T){ return -a; });
+}
+
+TEST(fixed_simd, comparisons_match_fixed32)
+{
+    using T = fixed32;
+    using simd = fixed_simd<T, 4>;
+    const auto to_simd = [](auto mask){ return select(mask, simd(1), simd(0)); };
+    const auto to_fixed = [](bool mask){ return mask? T(1): T(0); };
+    expect_lanewise<T>([&](simd a, simd b){ return to_simd(a == b); }, [&](T a, T b){ return to_fixed(a == b); });
+    expect_lanewise<T>([&](simd a, simd b){ return to_simd(a != b); }, [&](T a, T b){ return to_fixed(a != b); });
+    expect_lanewise<T>([&](simd a, simd b){ return to_simd(a < b); }, [&](T a, T b){ return to_fixed(a < b); });
+    expect_lanewise<T>([&](simd a, simd b){ return to_simd(a <= b); }, [&](T a, T b){ return to_fixed(a <= b); });
+    expect_lanewise<T>([&](simd a, simd b){ return to_simd(a > b); }, [&](T a, T b){ return to_fixed(a > b); });
+    expect_lanewise<T>([&](simd a, simd b){ return to_simd(a >= b); }, [&](T a, T b){ return to_fixed(a >= b); });
+}
+
+TEST(fixed_simd, masks)
+{
+    using simd = fixed_simd<fixed32, 4>;
+    const auto values = simd(std::array<fixed32, 4>{fixed32(-2), fixed32(-1), fixed32(1), fixed32(2)});
+    const auto negative = values < simd(0);
+    EXPECT_TRUE(negative[0]);
+    EXPECT_FALSE(negative[2]);
+    EXPECT_TRUE(any_of(negative));
+    EXPECT_FALSE(all_of(negative));
+    EXPECT_FALSE(none_of(negative));
+    EXPECT_TRUE(all_of(negative || !negative));
+    EXPECT_TRUE(none_of(negative && !negative));
+    const auto magnitudes = abs(values);
+    EXPECT_EQ(magnitudes[0], fixed32(2));
+    EXPECT_EQ(magnitudes[1], fixed32(1));
+    EXPECT_EQ(magnitudes[2], fixed32(1));
+    EXPECT_EQ(magnitudes[3], fixed32(2));
+}
+
+TEST(fixed_simd, arithmetic_matches_fixed16)
+{
+    using T = fixed16;
+    using simd = fixed_simd<T, 4>;
+    expect_lanewise<T>([](simd a, simd b){ return a + b; }, [](T a, T b){ return a + b; });
+    expect_lanewise<T>([](simd a, simd b){ return a - b; }, [](T a, T b){ return a - b; });
+    expect_lanewise<T>([](simd a, simd b){ return a * b; }, [](T a, T b){ return a * b; });
+    expect_lanewise<T>([](simd a, simd){ return -a; }, [](T a, T){ return -a; });
+}
+
+TEST(fixed_simd, arithmetic_matches_fixed8_exhaustively)
+{
+    // Every pair of values, including the special ones, with a vector's worth of lanes.
+    using T = fixed8;
+    using simd = fixed_simd<T, 32>;
+    auto values = std::vector<T>{};
+    for (auto v = -128; v < 128; ++v) {
+        values.push_back(T::from_value(static_cast<std::int8_t>(v)));
+    }
+    for (const auto& a: values) {
+        for (auto j = std::size_t{0}; j < values.size(); j += simd::size()) {
+            const auto b = simd::load(values.data() + j);
+            const auto sum = simd(a) + b;
+            const auto difference = simd(a) - b;
+            const auto product = simd(a) * b;
+            for (auto k = std::size_t{0}; k < simd::size(); ++k) {
+                const auto c = values[j + k];
+                ASSERT_EQ(sum[k].get_value(), (a + c).get_value()) << a << " + " << c;
+                ASSERT_EQ(difference[k].get_value(), (a - c).get_value()) << a << " - " << c;
+                ASSERT_EQ(product[k].get_value(), (a * c).get_value()) << a << " * " << c;
+            }
+        }
+    }
+}
+
+TEST(fixed_simd, arithmetic_matches_q15)
+{
+    // Every value against a spread of values, with a vector's worth of lanes.
+    using T = q15;
+    using simd = fixed_simd<T, 16>;
+    auto values = std::vector<T>{};
+    for (auto v = -32768; v < 32768; ++v) {
+        values.push_back(T::from_value(static_cast<std::int16_t>(v)));
+    }
+    for (auto i = std::size_t{0}; i < values.size(); i += 257u) {
+        const auto a = values[i];
+        for (auto j = std::size_t{0}; j < values.size(); j += simd::size()) {
+            const auto b = simd::load(values.data() + j);
+            const auto sum = simd(a) + b;
+            const auto difference = simd(a) - b;
+            const auto product = simd(a) * b;
+            const auto negation = -b;
+            for (auto k = std::size_t{0}; k < simd::size(); ++k) {
+                const auto c = values[j + k];
+                ASSERT_EQ(sum[k].get_value(), (a + c).get_value()) << a << " + " << c;
+                ASSERT_EQ(difference[k].get_value(), (a - c).get_value()) << a << " - " << c;
+                ASSERT_EQ(product[k].get_value(), (a * c).get_value()) << a << " * " << c;
+                ASSERT_EQ(negation[k].get_value(), (-c).get_value()) << c;
+            }
+        }
+    }
+}
+
+TEST(fixed_simd, arithmetic_matches_q31)
+{
+    using T = q31;
+    using simd = fixed_simd<T, 8>;
+    const auto values = std::array<T, 8>{
+        T::get_lowest(), T(-0.75), T(-0.5), -T::get_min(), T(0), T::get_min(), T(0.625), T::get_max(),
+    };
+    for (const auto& a: values) {
+        const auto sum = simd(a) + simd(values);
+        const auto difference = simd(a) - simd(values);
+        const auto product = simd(a) * simd(values);
+        const auto less = simd(a) < simd(values);
+        for (auto k = std::size_t{0}; k < simd::size(); ++k) {
+            EXPECT_EQ(sum[k].get_value(), (a + values[k]).get_value()) << a << " + " << values[k];
+            EXPECT_EQ(difference[k].get_value(), (a - values[k]).get_value()) << a << " - " << values[k];
+            EXPECT_EQ(product[k].get_value(), (a * values[k]).get_value()) << a << " * " << values[k];
+            EXPECT_EQ(less[k], a < values[k]) << a << " < " << values[k];
+        }
+    }
+}
+
+TEST(fixed_simd, arithmetic_matches_fixed64)
+{
+    using T = fixed64;
+    using simd = fixed_simd<T, 4>;
+    expect_lanewise<T>([](simd a, simd b){ return a + b; }, [](T a, T b){ return a + b; });
+    expect_lanewise<T>([](simd a, simd b){ return a - b; }, [](T a, T b){ return a - b; });
+    expect_lanewise<T>([](simd a, simd b){ return a * b; }, [](T a, T b){ return a * b; });
+}
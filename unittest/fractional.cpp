@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+
+#include <algorithm> // for std::min
+#include <cmath> // for std::floor
+#include <cstdint> // for std::int16_t
+#include <limits> // for std::numeric_limits
+#include <sstream>
+#include <type_traits> // for std::is_same_v
+
+#include <realnumb/fractional.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+/// @brief Gets the saturating rounding doubling multiply-high of the given values the long
+///   way round.
+template <class T>
+auto expected_product(T a, T b) -> T
+{
+    const auto exact = static_cast<long double>(a) * static_cast<long double>(b);
+    const auto scaled = std::floor(exact * T::scale_factor + 0.5L);
+    return T::from_value(static_cast<typename T::value_type>(
+        std::min(scaled, static_cast<long double>(T::get_max().get_value()))));
+}
+
+}
+
+TEST(fractional, traits)
+{
+    static_assert(q15::fraction_bits == 15u);
+    static_assert(q15::whole_bits == 1u);
+    static_assert(q15::scale_factor == 32768);
+    static_assert(q31::fraction_bits == 31u);
+    static_assert(q31::scale_factor == 2147483648);
+    static_assert(std::is_same_v<q15::value_type, std::int16_t>);
+    static_assert(sizeof(q15) == sizeof(std::int16_t));
+    static_assert(sizeof(q31) == sizeof(std::int32_t));
+    SUCCEED();
+}
+
+TEST(fractional, limits)
+{
+    EXPECT_EQ(q15::get_min().get_value(), 1);
+    EXPECT_EQ(q15::get_max().get_value(), 32767);
+    EXPECT_EQ(q15::get_lowest().get_value(), -32768);
+    EXPECT_EQ(static_cast<double>(q15::get_lowest()), -1.0);
+    EXPECT_EQ(static_cast<double>(q15::get_max()), 1.0 - 1.0 / 32768);
+    EXPECT_EQ(static_cast<double>(q31::get_lowest()), -1.0);
+    EXPECT_EQ(static_cast<double>(q31::get_min()), 1.0 / 2147483648);
+}
+
+TEST(fractional, conversions)
+{
+    EXPECT_EQ(q15(0.5).get_value(), 16384);
+    EXPECT_EQ(q15(-0.5).get_value(), -16384);
+    EXPECT_EQ(q15(0.3).get_value(), 9830); // 9830.4 rounds down
+    EXPECT_EQ(q15(0.7).get_value(), 22938); // 22937.6 rounds up
+    EXPECT_EQ(q15(-0.7).get_value(), -22938);
+    EXPECT_EQ(q15(1.0), q15::get_max());
+    EXPECT_EQ(q15(0.99999), q15::get_max());
+    EXPECT_EQ(q15(2.5), q15::get_max());
+    EXPECT_EQ(q15(-1.0), q15::get_lowest());
+    EXPECT_EQ(q15(-7.0), q15::get_lowest());
+    EXPECT_EQ(q15(std::numeric_limits<double>::quiet_NaN()).get_value(), 0);
+    EXPECT_EQ(q15(std::numeric_limits<double>::infinity()), q15::get_max());
+    EXPECT_EQ(q15(0).get_value(), 0);
+    EXPECT_EQ(q15(1), q15::get_max());
+    EXPECT_EQ(q15(-1), q15::get_lowest());
+    EXPECT_EQ(q31(0.25).get_value(), 536870912);
+    EXPECT_EQ(q31(1.0), q31::get_max());
+    EXPECT_EQ(static_cast<float>(q15(0.25)), 0.25f);
+}
+
+TEST(fractional, saturating_arithmetic)
+{
+    EXPECT_EQ(q15(0.25) + q15(0.5), q15(0.75));
+    EXPECT_EQ(q15(0.75) + q15(0.5), q15::get_max());
+    EXPECT_EQ(q15(-0.75) + q15(-0.5), q15::get_lowest());
+    EXPECT_EQ(q15(-0.75) - q15(0.5), q15::get_lowest());
+    EXPECT_EQ(q15(0.75) - q15(-0.5), q15::get_max());
+    EXPECT_EQ(q15(0.25) - q15(0.5), q15(-0.25));
+    EXPECT_EQ(-q15::get_lowest(), q15::get_max());
+    EXPECT_EQ(-q15::get_max(), q15::get_lowest() + q15::get_min());
+    EXPECT_EQ(-q31::get_lowest(), q31::get_max());
+    EXPECT_EQ(q31(0.75) + q31(0.5), q31::get_max());
+}
+
+TEST(fractional, multiplication)
+{
+    EXPECT_EQ(q15(0.5) * q15(0.5), q15(0.25));
+    EXPECT_EQ(q15(-0.5) * q15(0.5), q15(-0.25));
+    EXPECT_EQ(q15::get_lowest() * q15::get_lowest(), q15::get_max());
+    EXPECT_EQ(q15::get_lowest() * q15::get_max(), -q15::get_max());
+    EXPECT_EQ(q15::get_min() * q15(0.5), q15::get_min()); // half rounds up
+    EXPECT_EQ(-q15::get_min() * q15(0.5), q15(0)); // half rounds up
+    EXPECT_EQ(q31::get_lowest() * q31::get_lowest(), q31::get_max());
+    EXPECT_EQ(q31(0.5) * q31(-0.5), q31(-0.25));
+    for (auto a = -32768; a < 32768; a += 7) {
+        for (auto b = -32768; b < 32768; b += 251) {
+            const auto x = q15::from_value(static_cast<std::int16_t>(a));
+            const auto y = q15::from_value(static_cast<std::int16_t>(b));
+            ASSERT_EQ((x * y).get_value(), expected_product(x, y).get_value()) << x << " * " << y;
+        }
+    }
+}
+
+TEST(fractional, comparisons)
+{
+    EXPECT_TRUE(q15(-0.5) < q15(0.5));
+    EXPECT_TRUE(q15(0.5) > q15(-0.5));
+    EXPECT_TRUE(q15(0.5) <= q15(0.5));
+    EXPECT_TRUE(q15(0.5) >= q15(0.5));
+    EXPECT_TRUE(q15(0.5) == q15(0.5));
+    EXPECT_TRUE(q15(0.5) != q15(0.25));
+    EXPECT_TRUE(!q15(0));
+    EXPECT_TRUE(static_cast<bool>(q15::get_min()));
+}
+
+TEST(fractional, StreamOut)
+{
+    std::ostringstream os;
+    os << q15(0.5) << ' ' << q31(-0.25);
+    EXPECT_EQ(os.str(), "0.5 -0.25");
+}
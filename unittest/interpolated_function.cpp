@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint> // for std::int32_t
+#include <thread>
+#include <vector>
+
+#include <realnumb/fixed_math.hpp>
+#include <realnumb/interpolated_function.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+/// @brief Gets the greatest difference of the given interpolated function from its function
+///   over its whole domain.
+template <class Interpolated, class Function>
+auto worst_error(const Interpolated& interpolated, Function function) -> long long
+{
+    auto result = 0ll;
+    for (auto raw = interpolated.lo().get_value(); raw <= interpolated.hi().get_value(); ++raw) {
+        const auto arg = decltype(interpolated.lo())::from_value(raw);
+        const auto expected = function(arg);
+        if (expected.isfinite()) {
+            const auto difference = static_cast<long long>(interpolated(arg).get_value()) - expected.get_value();
+            result = std::max(result, (difference < 0)? -difference: difference);
+        }
+    }
+    return result;
+}
+
+}
+
+TEST(interpolated_function, fits_memory_budget)
+{
+    const auto f = interpolated_function<fixed32, &exp>{fixed32{-4}, fixed32{4}, 1024u};
+    EXPECT_LE(f.size() * sizeof(fixed32), 1024u);
+    EXPECT_GT(f.size() * 2u * sizeof(fixed32), 1024u);
+    EXPECT_EQ(f.lo(), fixed32{-4});
+    EXPECT_EQ(f.hi(), fixed32{4});
+    EXPECT_EQ(f.spacing_bits(), 5u);
+}
+
+TEST(interpolated_function, reports_max_error)
+{
+    const auto linear = interpolated_function<fixed32, &exp>{fixed32{-4}, fixed32{4}, 1024u};
+    EXPECT_EQ(linear.max_error().get_value(), worst_error(linear, [](fixed32 x){ return exp(x); }));
+    EXPECT_GT(linear.max_error(), fixed32{0});
+    const auto cubic = interpolated_function<fixed32, &exp, cubic_interpolation>{fixed32{-4}, fixed32{4}, 1024u};
+    EXPECT_EQ(cubic.max_error().get_value(), worst_error(cubic, [](fixed32 x){ return exp(x); }));
+    EXPECT_LT(cubic.max_error(), linear.max_error());
+}
+
+TEST(interpolated_function, exact_with_room_for_every_value)
+{
+    const auto f = interpolated_function<fixed32, &atan>{fixed32{-1}, fixed32{1}, 8192u};
+    EXPECT_EQ(f.spacing_bits(), 0u);
+    EXPECT_EQ(f.max_error(), fixed32{0});
+    EXPECT_EQ(worst_error(f, [](fixed32 x){ return atan(x); }), 0);
+}
+
+TEST(interpolated_function, outside_domain_calls_function)
+{
+    const auto f = interpolated_function<fixed32, &exp>{fixed32{-4}, fixed32{4}, 64u};
+    EXPECT_EQ(f(fixed32{5}), exp(fixed32{5}));
+    EXPECT_EQ(f(fixed32{-5}), exp(fixed32{-5}));
+    EXPECT_TRUE(f(fixed32::get_nan()).isnan());
+    EXPECT_EQ(f(fixed32::get_positive_infinity()), fixed32::get_positive_infinity());
+}
+
+TEST(interpolated_function, non_finite_samples_call_function)
+{
+    const auto f = interpolated_function<fixed32, &log>{fixed32{-1}, fixed32{8}, 256u};
+    EXPECT_TRUE(f(fixed32{-0.5}).isnan());
+    EXPECT_EQ(f(fixed32{0}), fixed32::get_negative_infinity());
+    EXPECT_EQ(f(fixed32::get_min()), log(fixed32::get_min()));
+    EXPECT_NEAR(static_cast<double>(f(fixed32{4})), std::log(4.0), 0.05);
+}
+
+TEST(interpolated_function, one_sample_within_range)
+{
+    // The samples after the first are past the type's max so there's just the one to
+    // extrapolate the rest from.
+    const auto lo = fixed32::from_value(fixed32::get_max().get_value() - 3);
+    const auto linear = interpolated_function<fixed32, &atan>{lo, fixed32::get_max(), 2u * sizeof(fixed32)};
+    EXPECT_EQ(linear.size(), 2u);
+    EXPECT_EQ(linear.max_error().get_value(), worst_error(linear, [](fixed32 x){ return atan(x); }));
+    EXPECT_LE(abs(linear(fixed32::get_max()) - atan(fixed32::get_max())), linear.max_error());
+    const auto cubic = interpolated_function<fixed32, &atan, cubic_interpolation>{
+        lo, fixed32::get_max(), 5u * sizeof(fixed32)};
+    EXPECT_EQ(cubic.max_error().get_value(), worst_error(cubic, [](fixed32 x){ return atan(x); }));
+    EXPECT_LE(abs(cubic(fixed32::get_max()) - atan(fixed32::get_max())), cubic.max_error());
+}
+
+TEST(interpolated_function, whole_range)
+{
+    const auto f = interpolated_function<fixed32, &atan, cubic_interpolation>{
+        fixed32::get_lowest(), fixed32::get_max()};
+    EXPECT_LE(f.size() * sizeof(fixed32), f.default_memory_budget);
+    EXPECT_EQ(f.spacing_bits(), 23u);
+    const auto step = 1ll << (f.spacing_bits() - 3u);
+    for (auto raw = static_cast<long long>(f.lo().get_value()); raw <= f.hi().get_value(); raw += step) {
+        const auto arg = fixed32::from_value(static_cast<std::int32_t>(raw));
+        EXPECT_LE(abs(f(arg) - atan(arg)), f.max_error());
+    }
+}
+
+TEST(interpolated_function, at_first_use_is_thread_safe)
+{
+    using type = interpolated_function<fixed32, &sin, cubic_interpolation, at_first_use>;
+    const auto f = type{fixed32{-4}, fixed32{4}, 512u};
+    constexpr auto num_threads = 8u;
+    auto errors = std::array<fixed32, num_threads>{};
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0u; i < num_threads; ++i) {
+        threads.emplace_back([&f, &errors, i]{ errors[i] = f.max_error(); });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    for (const auto error: errors) {
+        EXPECT_EQ(error, errors[0]);
+    }
+    EXPECT_EQ(f.max_error().get_value(), worst_error(f, [](fixed32 x){ return sin(x); }));
+}
+
+TEST(interpolated_function, fixed64_cubic_error_shrinks_with_budget)
+{
+    const auto smaller = interpolated_function<fixed64, &exp, cubic_interpolation>{fixed64{-4}, fixed64{4}, 1024u};
+    const auto larger = interpolated_function<fixed64, &exp, cubic_interpolation>{fixed64{-4}, fixed64{4}, 8192u};
+    EXPECT_LT(larger.max_error(), smaller.max_error());
+    EXPECT_LT(larger.max_error(), fixed64{0.0001});
+    EXPECT_NEAR(static_cast<double>(larger(fixed64{1})), std::exp(1.0), static_cast<double>(larger.max_error()));
+}
@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include <cstdint> // for std::int64_t
+#include <random> // for std::mt19937_64
+
+#include <realnumb/fixed.hpp>
+
+using namespace realnumb;
+
+#ifdef REALNUMB_INT128
+namespace {
+
+using int128 = REALNUMB_INT128;
+using uint128 = REALNUMB_UINT128;
+
+/// @brief Gets a pseudo random 128-bit value of a pseudo random number of bits.
+auto random_int128(std::mt19937_64& generator) -> int128
+{
+    const auto bits = static_cast<int128>((static_cast<uint128>(generator()) << 64u) | generator());
+    return bits >> (generator() % 128u);
+}
+
+/// @brief Gets the magnitude of the given value.
+auto magnitude(limbs<4> value) -> limbs<4>
+{
+    return (value < 0)? -value: value;
+}
+
+} // namespace
+#endif
+
+TEST(limbs, traits)
+{
+    static_assert(std::is_trivial_v<limbs<4>>);
+    static_assert(sizeof(limbs<4>) == 32u);
+    static_assert(limbs<4>::total_bits == 256u);
+#ifdef REALNUMB_INT128
+    static_assert(std::is_same_v<detail::wider<std::int64_t>::type, int128>);
+    static_assert(std::is_same_v<detail::wider<int128>::type, limbs<4>>);
+#else
+    static_assert(std::is_same_v<detail::wider<std::int64_t>::type, limbs<2>>);
+#endif
+    SUCCEED();
+}
+
+TEST(limbs, conversions)
+{
+    static_assert(static_cast<int>(limbs<4>{-5}) == -5);
+    static_assert(static_cast<unsigned int>(limbs<4>{-1}) == 0xFFFFFFFFu);
+    static_assert(static_cast<std::int64_t>((limbs<4>{1} << 100u) >> 90) == 1024);
+    static_assert(limbs<4>{-1}.get_limbs()[3] == ~std::uint64_t{0});
+    static_assert(limbs<4>{std::uint64_t{1} << 63}.get_limbs()[1] == 0u);
+    static_assert(limbs<4>{std::int8_t{-2}}.get_limbs()[0] == ~std::uint64_t{1});
+    static_assert(static_cast<bool>(limbs<4>{1} << 127u));
+    static_assert(!limbs<4>{});
+    static_assert(limbs<4>::from_limbs({0u, 0u, 0u, 1u}) == (limbs<4>{1} << 192u));
+    static_assert(limbs<4>{limbs<2>{-3}} == -3);
+    static_assert(limbs<2>{(limbs<4>{5} << 128u) + 7} == 7);
+    static_assert(limbs<4>{-0x1.8p100} == -(limbs<4>{3} << 99u));
+    static_assert(limbs<4>{2.75} == 2);
+    static_assert(static_cast<double>(limbs<4>{1} << 200u) == 0x1p200);
+    static_assert(static_cast<double>(-limbs<4>{5}) == -5.0);
+    // Rounds to nearest, with ties to even, rather than twice...
+    static_assert(static_cast<double>(limbs<2>::from_limbs({0x6A09E667F3BCC909u, 1u})) == 0x1.6A09E667F3BCDp64);
+    static_assert(static_cast<double>((limbs<2>{1} << 53u) + 1) == 0x1p53);
+    static_assert(static_cast<double>((limbs<2>{1} << 53u) + 3) == 0x1.0000000000002p53);
+    SUCCEED();
+}
+
+TEST(limbs, bit_width)
+{
+    static_assert(detail::bit_width(limbs<4>{}) == 0u);
+    static_assert(detail::bit_width(limbs<4>{1}) == 1u);
+    static_assert(detail::bit_width(limbs<4>{1} << 200u) == 201u);
+    static_assert(detail::bit_width((limbs<4>{1} << 254u) + 1) == 255u);
+    SUCCEED();
+}
+
+TEST(limbs, arithmetic)
+{
+    static_assert(limbs<4>{7} * -6 == -42);
+    static_assert(limbs<4>{-43} / 6 == -7);
+    static_assert(limbs<4>{-43} % 6 == -1);
+    static_assert(limbs<4>{43} % -6 == 1);
+    static_assert(limbs<4>{-43} / 8 == -5);
+    static_assert(limbs<4>{-48} / 16 == -3);
+    static_assert(limbs<4>{-43} / -8 == 5);
+    static_assert(limbs<4>{1024}.is_power_of_two());
+    static_assert(!limbs<4>{1025}.is_power_of_two());
+    static_assert(!limbs<4>{}.is_power_of_two());
+    static_assert(!(limbs<4>{1} << 255u).is_power_of_two());
+    static_assert((limbs<4>{1} << 255u) < 0);
+    static_assert(((limbs<4>{1} << 200u) - 1) / (limbs<4>{1} << 100u) == (limbs<4>{1} << 100u) - 1);
+    static_assert((limbs<4>{1} << 255u) / (limbs<4>{1} << 255u) == 1);
+    static_assert(((limbs<4>{3} << 130u) + 5) % (limbs<4>{1} << 128u) == 5);
+    EXPECT_EQ(-(limbs<4>{1} << 255u), limbs<4>{1} << 255u);
+    EXPECT_EQ(limbs<4>{-8} >> 2u, -2);
+    EXPECT_EQ(limbs<4>{-1} >> 300u, -1);
+    EXPECT_EQ(limbs<4>{1} << 300u, 0);
+}
+
+TEST(limbs, multiply_limbs)
+{
+    constexpr auto max = ~std::uint64_t{0};
+    static_assert(detail::multiply_limbs(max, max).hi == max - 1u);
+    static_assert(detail::multiply_limbs(max, max).lo == 1u);
+    static_assert(detail::multiply_limbs(std::uint64_t{1} << 63u, 2u).hi == 1u);
+    static_assert(detail::multiply_limbs(std::uint64_t{1} << 63u, 2u).lo == 0u);
+    static_assert(detail::multiply_limbs(0xFFFFFFFFu, 0xFFFFFFFFu).hi == 0u);
+    auto generator = std::mt19937_64{};
+    for (auto i = 0; i < 100000; ++i)
+    {
+        const auto a = generator() >> (generator() % 64u);
+        const auto b = generator() >> (generator() % 64u);
+        const auto product = detail::multiply_limbs(a, b);
+        const auto value = limbs<3>::from_limbs({product.lo, product.hi, 0u});
+        ASSERT_EQ(product.lo, a * b);
+        if (b != 0u)
+        {
+            ASSERT_TRUE(value / limbs<3>{b} == limbs<3>{a});
+            ASSERT_TRUE(value % limbs<3>{b} == 0);
+        }
+    }
+}
+
+#ifdef REALNUMB_INT128
+
+TEST(limbs, matches_int128)
+{
+    auto generator = std::mt19937_64{};
+    for (auto i = 0; i < 100000; ++i)
+    {
+        const auto a = random_int128(generator);
+        const auto b = random_int128(generator);
+        const auto shift = static_cast<unsigned int>(generator() % 128u);
+        const auto la = limbs<2>{a};
+        const auto lb = limbs<2>{b};
+        ASSERT_TRUE(static_cast<int128>(la + lb) == static_cast<int128>(static_cast<uint128>(a) + b));
+        ASSERT_TRUE(static_cast<int128>(la - lb) == static_cast<int128>(static_cast<uint128>(a) - b));
+        ASSERT_TRUE(static_cast<int128>(la * lb) == static_cast<int128>(static_cast<uint128>(a) * b));
+        ASSERT_TRUE(static_cast<int128>(la << shift) == static_cast<int128>(static_cast<uint128>(a) << shift));
+        ASSERT_TRUE(static_cast<int128>(la >> shift) == (a >> shift));
+        ASSERT_EQ(la < lb, a < b);
+        ASSERT_EQ(la == lb, a == b);
+        if (b != 0)
+        {
+            ASSERT_TRUE(static_cast<int128>(la / lb) == a / b);
+            ASSERT_TRUE(static_cast<int128>(la % lb) == a % b);
+        }
+        const auto power = int128{1} << (shift % 127u);
+        ASSERT_TRUE(static_cast<int128>(la / limbs<2>{power}) == a / power);
+        ASSERT_EQ(static_cast<double>(la), static_cast<double>(a));
+        ASSERT_EQ(static_cast<long double>(la), static_cast<long double>(a));
+    }
+}
+
+TEST(limbs, division_identity)
+{
+    auto generator = std::mt19937_64{};
+    for (auto i = 0; i < 100000; ++i)
+    {
+        const auto u = limbs<4>{random_int128(generator)} * random_int128(generator) + random_int128(generator);
+        const auto v = (i % 2 == 0)
+            ? limbs<4>{random_int128(generator)}
+            : limbs<4>{random_int128(generator)} * random_int128(generator);
+        if (v == 0)
+        {
+            continue;
+        }
+        const auto q = u / v;
+        const auto r = u % v;
+        ASSERT_TRUE(q * v + r == u);
+        ASSERT_TRUE(magnitude(r) < magnitude(v));
+        ASSERT_TRUE((r == 0) || ((r < 0) == (u < 0)));
+    }
+}
+#endif
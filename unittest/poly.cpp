@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath> // for std::exp
+
+#include <realnumb/poly.hpp>
+#include <realnumb/fixed_math.hpp>
+
+using namespace realnumb;
+
+TEST(poly, constexpr_support)
+{
+    constexpr auto coefficients = std::array<int, 4>{1, 2, 3, 4};
+    static_assert(poly::horner(2, coefficients) == 1 + 2 * 2 + 3 * 4 + 4 * 8);
+    static_assert(poly::estrin(2, coefficients) == 1 + 2 * 2 + 3 * 4 + 4 * 8);
+    static_assert(poly::horner(fixed32(0.5), poly::convert<fixed32>(std::array<double, 2>{1, 3})) == fixed32(2.5));
+    SUCCEED();
+}
+
+TEST(poly, horner_and_estrin_agree)
+{
+    constexpr auto coefficients = std::array<long long, 7>{3, -1, 4, -1, 5, -9, 2};
+    for (auto x = -10ll; x <= 10ll; ++x) {
+        auto expected = 0ll;
+        for (auto i = coefficients.size(); i > 0u; --i) {
+            expected = expected * x + coefficients[i - 1u];
+        }
+        EXPECT_EQ(poly::horner(x, coefficients), expected);
+        EXPECT_EQ(poly::estrin(x, coefficients), expected);
+        EXPECT_EQ(poly::estrin(x, std::array<long long, 1>{5}), 5);
+        EXPECT_EQ(poly::estrin(x, std::array<long long, 2>{5, 1}), 5 + x);
+        EXPECT_EQ(poly::estrin(x, std::array<long long, 3>{5, 1, 2}), 5 + x + 2 * x * x);
+    }
+}
+
+TEST(poly, exp_maclaurin_double)
+{
+    constexpr auto coefficients = std::array<double, 10>{
+        1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120,
+        1.0 / 720, 1.0 / 5040, 1.0 / 40320, 1.0 / 362880};
+    for (auto x = -0.5; x <= 0.5; x += 0.125) {
+        EXPECT_NEAR(poly::horner(x, coefficients), std::exp(x), 1e-9);
+        EXPECT_NEAR(poly::estrin(x, coefficients), std::exp(x), 1e-9);
+        EXPECT_NEAR(poly::horner(x, coefficients, poly::fused_multiply_add{}), std::exp(x), 1e-9);
+        EXPECT_NEAR(poly::estrin(x, coefficients, poly::fused_multiply_add{}), std::exp(x), 1e-9);
+    }
+}
+
+TEST(poly, fixed_coefficients)
+{
+    constexpr auto coefficients = poly::convert<fixed64>(std::array<long double, 6>{
+        1.0L, 1.0L, 1.0L / 2, 1.0L / 6, 1.0L / 24, 1.0L / 120});
+    for (auto x = -0.25; x <= 0.25; x += 0.125) {
+        const auto value = fixed64(x);
+        EXPECT_NEAR(double(poly::horner(value, coefficients)), std::exp(x), 0.00001);
+        EXPECT_NEAR(double(poly::estrin(value, coefficients)), std::exp(x), 0.00001);
+        EXPECT_NEAR(double(poly::horner(value, coefficients, poly::fused_multiply_add{})),
+                    std::exp(x), 0.00001);
+    }
+}
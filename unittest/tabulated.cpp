@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint> // for std::int16_t
+#include <type_traits> // for std::is_same_v
+#include <thread>
+#include <vector>
+
+#include <realnumb/fixed_math.hpp>
+#include <realnumb/tabulated.hpp>
+
+using namespace realnumb;
+
+namespace {
+
+/// @brief Checks that the given tabulated function matches the given function for every value.
+template <class Tabulated, class Function>
+auto mismatches(const Tabulated& tabulated, Function function) -> int
+{
+    auto result = 0;
+    for (auto v = -32768; v < 32768; ++v) {
+        const auto arg = fixed16::from_value(static_cast<std::int16_t>(v));
+        const auto expected = function(arg);
+        const auto actual = tabulated(arg);
+        if (actual.get_value() != expected.get_value()) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+/// @brief Function cheap enough to tabulate at compile time.
+constexpr auto half(fixed16 arg) noexcept -> fixed16
+{
+    return arg >> 1;
+}
+
+}
+
+TEST(tabulated, traits)
+{
+    static_assert(tabulated<fixed16, &sin>::size == 65536u);
+    static_assert(sizeof(tabulated<fixed16, &sin>::table_type) == 128u * 1024u);
+    static_assert(std::is_same_v<tabulated<fixed16, &sin>::value_type, fixed16>);
+    SUCCEED();
+}
+
+TEST(tabulated, at_first_use_matches_function)
+{
+    EXPECT_EQ(mismatches(tabulated<fixed16, &sin>{}, [](fixed16 x){ return sin(x); }), 0);
+    EXPECT_EQ(mismatches(tabulated<fixed16, &exp>{}, [](fixed16 x){ return exp(x); }), 0);
+    EXPECT_EQ(mismatches(tabulated<fixed16, &log>{}, [](fixed16 x){ return log(x); }), 0);
+    EXPECT_EQ(mismatches(tabulated<fixed16, &sqrt>{}, [](fixed16 x){ return sqrt(x); }), 0);
+}
+
+TEST(tabulated, at_compile_time_matches_function)
+{
+    using compiled = tabulated<fixed16, &half, at_compile_time>;
+    EXPECT_EQ(mismatches(compiled{}, half), 0);
+    EXPECT_EQ(&compiled::table(), &compiled::table());
+}
+
+TEST(tabulated, special_values)
+{
+    const auto function = tabulated<fixed16, &atan>{};
+    EXPECT_TRUE(function(fixed16::get_nan()).isnan());
+    EXPECT_EQ(function(fixed16{0}), fixed16{0});
+    EXPECT_EQ(function(fixed16::get_positive_infinity()), atan(fixed16::get_positive_infinity()));
+    EXPECT_EQ(function(fixed16::get_negative_infinity()), atan(fixed16::get_negative_infinity()));
+}
+
+TEST(tabulated, at_first_use_is_thread_safe)
+{
+    constexpr auto num_threads = 8u;
+    auto tables = std::array<const tabulated<fixed16, &cos>::table_type*, num_threads>{};
+    auto threads = std::vector<std::thread>{};
+    for (auto i = 0u; i < num_threads; ++i) {
+        threads.emplace_back([&tables, i]{ tables[i] = &tabulated<fixed16, &cos>::table(); });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    for (const auto table: tables) {
+        EXPECT_EQ(table, tables[0]);
+    }
+    EXPECT_EQ(mismatches(tabulated<fixed16, &cos>{}, [](fixed16 x){ return cos(x); }), 0);
+}
@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath> // for std::sin, std::cos, std::exp, std::atan
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int16_t, std::int32_t, std::int64_t
+#include <type_traits> // for std::is_same_v
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#endif
+
+#include <realnumb/fixed.hpp>
+#include <realnumb/fixed_simd.hpp>
+#include <realnumb/taylor_series.hpp>
+
+using namespace realnumb;
+
+TEST(taylor_series, reciprocal_factorials)
+{
+    constexpr auto doubles = taylor_series::detail::reciprocal_factorials<double, 25>();
+    static_assert(doubles[0] == 1.0);
+    static_assert(doubles[1] == 1.0);
+    static_assert(doubles[2] == 0.5);
+    EXPECT_DOUBLE_EQ(doubles[5], 1.0 / 120);
+    EXPECT_DOUBLE_EQ(doubles[24], 1.0 / 6.2044840173323943936e23);
+    constexpr auto fixeds = taylor_series::detail::reciprocal_factorials<fixed32, 25>();
+    static_assert(fixeds[0] == std::int32_t{1} << 30);
+    static_assert(fixeds[3] == ((std::int32_t{1} << 30) + 3) / 6);
+    EXPECT_EQ(fixeds[12], 2); // 2^30 / 12! is about 2.24
+    EXPECT_EQ(fixeds[13], 0);
+    // These have more fraction bits than long double has significand bits everywhere...
+    constexpr auto wides = taylor_series::detail::reciprocal_factorials<fixed<std::int64_t, 39>, 25>();
+    static_assert(wides[3] == ((std::int64_t{1} << 62) + 3) / 6);
+    static_assert(wides[20] == 2); // 2^62 / 20! is about 1.90
+    static_assert(wides[21] == 0);
+}
+
+TEST(taylor_series, reciprocals)
+{
+    constexpr auto doubles = taylor_series::detail::reciprocals<double, 8>();
+    static_assert(doubles[0] == 0.0);
+    static_assert(doubles[1] == 1.0);
+    static_assert(doubles[4] == 0.25);
+    constexpr auto fixeds = taylor_series::detail::reciprocals<fixed32, 8>();
+    static_assert(fixeds[2] == std::int32_t{1} << 29);
+    static_assert(fixeds[3] == ((std::int32_t{1} << 30) + 1) / 3);
+}
+
+TEST(taylor_series, coefficient_multiply_rounds_to_nearest)
+{
+    using coefficient = taylor_series::detail::coefficient<fixed32>;
+    constexpr auto reciprocals = taylor_series::detail::reciprocals<fixed32, 4>();
+    const auto half = reciprocals[2];
+    const auto third = reciprocals[3];
+    EXPECT_EQ(coefficient::multiply(fixed32(3), third), fixed32(1));
+    EXPECT_EQ(coefficient::multiply(fixed32(-3), third), fixed32(-1));
+    EXPECT_EQ(coefficient::multiply(fixed32::from_value(1), half), fixed32::from_value(1));
+    EXPECT_EQ(coefficient::multiply(fixed32::from_value(-1), half), fixed32::from_value(-1));
+    EXPECT_EQ(coefficient::multiply(fixed32::get_positive_infinity(), third), fixed32::get_positive_infinity());
+    EXPECT_TRUE(coefficient::multiply(fixed32::get_nan(), third).isnan());
+}
+
+TEST(taylor_series, double_past_thirteen_terms)
+{
+    for (auto x = -3.0; x <= 3.0; x += 0.125) {
+        EXPECT_NEAR(taylor_series::sin<20>(x), std::sin(x), 1e-15) << x;
+        EXPECT_NEAR(taylor_series::cos<20>(x), std::cos(x), 1e-15) << x;
+        EXPECT_NEAR(taylor_series::exp<40>(x), std::exp(x), 1e-14 * std::exp(x)) << x;
+    }
+}
+
+TEST(taylor_series, fixed32)
+{
+    constexpr auto tolerance = 3.0 / (1 << fixed32::fraction_bits);
+    for (auto x = -3.0; x <= 3.0; x += 0.125) {
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<8>(fixed32(x))), std::sin(x), tolerance) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<8>(fixed32(x))), std::cos(x), tolerance) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<20>(fixed32(x))), std::exp(x), tolerance * std::fmax(1.0, std::exp(x))) << x;
+    }
+}
+
+TEST(taylor_series, fixed32_atan)
+{
+    // Eight terms are enough where the magnitude is at most a half, and past two where
+    // the series gets the reciprocal. The series converges too slowly in between.
+    constexpr auto ulp = 1.0 / (1 << fixed32::fraction_bits);
+    for (auto v = -(1 << (fixed32::fraction_bits - 1u)); v <= 1 << (fixed32::fraction_bits - 1u); ++v) {
+        const auto x = fixed32::from_value(v);
+        EXPECT_NEAR(static_cast<double>(taylor_series::atan<8>(x)), std::atan(static_cast<double>(x)), 0.6 * ulp) << x;
+    }
+    for (auto v = 2 << fixed32::fraction_bits; v <= 64 << fixed32::fraction_bits; ++v) {
+        for (const auto x: {fixed32::from_value(v), fixed32::from_value(-v)}) {
+            EXPECT_NEAR(static_cast<double>(taylor_series::atan<8>(x)), std::atan(static_cast<double>(x)), 0.6 * ulp) << x;
+        }
+    }
+}
+
+TEST(taylor_series, working_types)
+{
+    static_assert(std::is_same_v<taylor_series::detail::working<double>::type, double>);
+    static_assert(std::is_same_v<taylor_series::detail::working<fixed16>::type, fixed<std::int32_t, 22>>);
+    static_assert(std::is_same_v<taylor_series::detail::working<fixed32>::type, fixed<std::int64_t, 39>>);
+    static_assert(std::is_same_v<taylor_series::detail::working<fixed_simd<fixed32, 4>>::type,
+                                 fixed_simd<fixed<std::int64_t, 39>, 4>>);
+    using working = taylor_series::detail::working<fixed32>;
+    EXPECT_EQ(working::from(working::to(fixed32(-2.5))), fixed32(-2.5));
+    EXPECT_EQ(working::from(working::to(fixed32::get_max())), fixed32::get_max());
+    EXPECT_EQ(working::from(working::to(fixed32::get_positive_infinity())), fixed32::get_positive_infinity());
+    EXPECT_EQ(working::from(working::to(fixed32::get_negative_infinity())), fixed32::get_negative_infinity());
+    EXPECT_TRUE(working::from(working::to(fixed32::get_nan())).isnan());
+    EXPECT_EQ(working::from(working::type(1e9)), fixed32::get_positive_infinity());
+}
+
+TEST(taylor_series, fixed32_rounds_once)
+{
+    // Evaluating in the working type rather than rounding every term to fixed32 keeps
+    // results within a little more than half an ulp.
+    constexpr auto ulp = 1.0 / (1 << fixed32::fraction_bits);
+    for (auto v = -(3 << fixed32::fraction_bits); v <= 3 << fixed32::fraction_bits; ++v) {
+        const auto x = fixed32::from_value(v);
+        const auto d = static_cast<double>(x);
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<8>(x)), std::sin(d), 0.6 * ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<8>(x)), std::cos(d), 0.6 * ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<20>(x)), std::exp(d), 0.6 * ulp) << x;
+    }
+}
+
+TEST(taylor_series, default_tier_is_precise)
+{
+    // The precise tier's results are within half an ulp and 2^-12 of one.
+    constexpr auto ulp = 1.0 / (1 << fixed32::fraction_bits);
+    constexpr auto bound = (0.5 + 0x1p-12) * ulp;
+    for (auto v = -(3 << fixed32::fraction_bits); v <= 3 << fixed32::fraction_bits; ++v) {
+        const auto x = fixed32::from_value(v);
+        const auto d = static_cast<double>(x);
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<8>(x)), std::sin(d), bound) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<8>(x)), std::cos(d), bound) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<20>(x)), std::exp(d), bound) << x;
+        EXPECT_EQ(taylor_series::sin<8>(x), (taylor_series::sin<8, precise>(x))) << x;
+    }
+}
+
+TEST(taylor_series, tiers_within_bounds_of_precise)
+{
+    constexpr auto ulp = 1.0 / (1 << fixed32::fraction_bits);
+    for (auto v = -(3 << fixed32::fraction_bits); v <= 3 << fixed32::fraction_bits; ++v) {
+        const auto x = fixed32::from_value(v);
+        const auto sin = static_cast<double>(taylor_series::sin<8>(x));
+        const auto cos = static_cast<double>(taylor_series::cos<8>(x));
+        const auto exp = static_cast<double>(taylor_series::exp<20>(x));
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<8, balanced>(x)), sin, ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<8, balanced>(x)), cos, ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<20, balanced>(x)), exp, ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<8, fast>(x)), sin, 4 * ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<8, fast>(x)), cos, 4 * ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<20, fast>(x)), exp, 4 * ulp) << x;
+    }
+}
+
+TEST(taylor_series, fixed32_round_each_step)
+{
+    // Rounding every term to fixed32 is faster but gives errors of a couple of ulps for
+    // sin and cos, and of about 20 for exp.
+    using taylor_series::round_each_step;
+    constexpr auto ulp = 1.0 / (1 << fixed32::fraction_bits);
+    for (auto v = -(1 << fixed32::fraction_bits); v <= 1 << fixed32::fraction_bits; ++v) {
+        const auto x = fixed32::from_value(v);
+        const auto d = static_cast<double>(x);
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<8, round_each_step>(x)), std::sin(d), 2 * ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<8, round_each_step>(x)), std::cos(d), 2 * ulp) << x;
+    }
+    for (auto v = -(3 << fixed32::fraction_bits); v <= 3 << fixed32::fraction_bits; ++v) {
+        const auto x = fixed32::from_value(v);
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<20, round_each_step>(x)), std::exp(static_cast<double>(x)), 24 * ulp) << x;
+    }
+}
+
+TEST(taylor_series, fixed16_rounds_once)
+{
+    // The powers of larger angles saturate the working type before their terms get small.
+    constexpr auto ulp = 1.0 / (1 << fixed16::fraction_bits);
+    for (auto v = -(3 << (fixed16::fraction_bits - 1u)); v <= 3 << (fixed16::fraction_bits - 1u); ++v) {
+        const auto x = fixed16::from_value(static_cast<std::int16_t>(v));
+        const auto d = static_cast<double>(x);
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<8>(x)), std::sin(d), 0.6 * ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<8>(x)), std::cos(d), 0.6 * ulp) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<20>(x)), std::exp(d), 0.6 * ulp) << x;
+    }
+}
+
+TEST(taylor_series, many_fraction_bits_round_once)
+{
+    // The working types' guard bits come from the wider type's headroom, whatever the
+    // fixed type's number of fraction bits.
+    using fixed48 = fixed<std::int64_t, 48>;
+    static_assert(taylor_series::detail::working<fixed48>::guard_bits == 62u);
+    constexpr auto ulp48 = 0x1p-48;
+    for (auto x = -1.5; x <= 1.5; x += 0.0625) {
+        const auto value = fixed48(x);
+        const auto d = static_cast<double>(value);
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<12>(value)), std::sin(d), 0.6 * ulp48) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<12>(value)), std::cos(d), 0.6 * ulp48) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<40>(value)), std::exp(d), 0.6 * ulp48 * std::fmax(1.0, std::exp(d))) << x;
+    }
+    // The working type of this has just six integer bits, so the powers of larger
+    // arguments saturate it before their terms get small.
+    using fixed28 = fixed<std::int32_t, 28>;
+    static_assert(taylor_series::detail::working<fixed28>::guard_bits == 30u);
+    constexpr auto ulp28 = 0x1p-28;
+    for (auto x = -1.0; x <= 1.0; x += 0.0625) {
+        const auto value = fixed28(x);
+        const auto d = static_cast<double>(value);
+        EXPECT_NEAR(static_cast<double>(taylor_series::sin<12>(value)), std::sin(d), 0.6 * ulp28) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::cos<12>(value)), std::cos(d), 0.6 * ulp28) << x;
+        EXPECT_NEAR(static_cast<double>(taylor_series::exp<30>(value)), std::exp(d), 0.6 * ulp28) << x;
+    }
+}
+
+TEST(taylor_series, fixed_simd_matches_fixed32)
+{
+    using simd = fixed_simd<fixed32, 8>;
+    for (auto x = -3.0; x <= 3.0; x += 0.25) {
+        auto values = std::array<fixed32, simd::size()>{};
+        for (auto i = std::size_t{0}; i < simd::size(); ++i) {
+            values[i] = fixed32(x + static_cast<double>(i) / 32);
+        }
+        const auto sin = taylor_series::sin<8>(simd(values));
+        const auto cos = taylor_series::cos<8>(simd(values));
+        const auto exp = taylor_series::exp<20>(simd(values));
+        const auto atan = taylor_series::atan<8>(simd(values));
+        for (auto i = std::size_t{0}; i < simd::size(); ++i) {
+            EXPECT_EQ(sin[i], taylor_series::sin<8>(values[i])) << values[i];
+            EXPECT_EQ(cos[i], taylor_series::cos<8>(values[i])) << values[i];
+            EXPECT_EQ(exp[i], taylor_series::exp<20>(values[i])) << values[i];
+            EXPECT_EQ(atan[i], taylor_series::atan<8>(values[i])) << values[i];
+        }
+        using taylor_series::round_each_step;
+        const auto stepped_cos = taylor_series::cos<8, round_each_step>(simd(values));
+        const auto stepped_exp = taylor_series::exp<20, round_each_step>(simd(values));
+        for (auto i = std::size_t{0}; i < simd::size(); ++i) {
+            EXPECT_EQ(stepped_cos[i], (taylor_series::cos<8, round_each_step>(values[i]))) << values[i];
+            EXPECT_EQ(stepped_exp[i], (taylor_series::exp<20, round_each_step>(values[i]))) << values[i];
+        }
+    }
+}
+
+#if __has_include(<experimental/simd>)
+TEST(taylor_series, experimental_simd_matches_float)
+{
+    using simd = std::experimental::native_simd<float>;
+    for (auto x = -3.0f; x <= 3.0f; x += 0.25f) {
+        const auto values = simd([x](auto i){ return x + static_cast<float>(i) / 64; });
+        const auto sin = taylor_series::sin<10>(values);
+        const auto cos = taylor_series::cos<10>(values);
+        const auto exp = taylor_series::exp<30>(values);
+        const auto atan = taylor_series::atan<20>(values);
+        for (auto i = std::size_t{0}; i < simd::size(); ++i) {
+            EXPECT_EQ(sin[i], taylor_series::sin<10>(float{values[i]})) << values[i];
+            EXPECT_EQ(cos[i], taylor_series::cos<10>(float{values[i]})) << values[i];
+            EXPECT_EQ(exp[i], taylor_series::exp<30>(float{values[i]})) << values[i];
+            EXPECT_EQ(atan[i], taylor_series::atan<20>(float{values[i]})) << values[i];
+        }
+    }
+}
+#endif
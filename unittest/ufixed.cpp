@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <cmath> // for std::floor
+#include <cstdint> // for std::uint16_t
+#include <limits> // for std::numeric_limits
+#include <sstream>
+
+#include <realnumb/ufixed.hpp>
+
+using namespace realnumb;
+
+TEST(ufixed, traits)
+{
+    static_assert(ufixed8::fraction_bits == 4u);
+    static_assert(ufixed8::whole_bits == 4u);
+    static_assert(ufixed16::scale_factor == 256u);
+    static_assert(ufixed32::fraction_bits == fixed32::fraction_bits);
+    static_assert(ufixed64::fraction_bits == fixed64::fraction_bits);
+    static_assert(sizeof(ufixed16) == sizeof(std::uint16_t));
+    static_assert(ufixed<std::uint16_t, 16>::scale_factor == 65536u);
+    SUCCEED();
+}
+
+TEST(ufixed, limits)
+{
+    EXPECT_EQ(ufixed16::get_lowest().get_value(), 0u);
+    EXPECT_EQ(ufixed16::get_min().get_value(), 1u);
+    EXPECT_EQ(ufixed16::get_max().get_value(), 65533u);
+    EXPECT_EQ(ufixed16::get_positive_infinity().get_value(), 65534u);
+    EXPECT_EQ(ufixed16::get_nan().get_value(), 65535u);
+    EXPECT_EQ(static_cast<double>(ufixed8::get_max()), 15.8125);
+    EXPECT_GT(static_cast<double>(ufixed16::get_max()), static_cast<double>(fixed16::get_max()) * 2);
+    EXPECT_TRUE(ufixed16::get_nan().isnan());
+    EXPECT_FALSE(ufixed16::get_positive_infinity().isfinite());
+    EXPECT_TRUE(ufixed16::get_max().isfinite());
+    EXPECT_TRUE(std::isnan(static_cast<double>(ufixed16::get_nan())));
+    EXPECT_EQ(static_cast<double>(ufixed16::get_positive_infinity()), std::numeric_limits<double>::infinity());
+}
+
+TEST(ufixed, conversions)
+{
+    EXPECT_EQ(ufixed16(1.5).get_value(), 384u);
+    EXPECT_EQ(ufixed16(200.25).get_value(), 51264u);
+    EXPECT_EQ(ufixed16(-1.5), ufixed16(0));
+    EXPECT_EQ(ufixed16(-std::numeric_limits<double>::infinity()), ufixed16(0));
+    EXPECT_EQ(ufixed16(256.0), ufixed16::get_positive_infinity());
+    EXPECT_TRUE(ufixed16(std::numeric_limits<double>::quiet_NaN()).isnan());
+    EXPECT_EQ(ufixed16(3).get_value(), 768u);
+    EXPECT_EQ(ufixed16(3u).get_value(), 768u);
+    EXPECT_EQ(ufixed16(-3), ufixed16(0));
+    EXPECT_EQ(ufixed16(255), ufixed16(255.0));
+    EXPECT_EQ(ufixed16(256), ufixed16::get_positive_infinity());
+    EXPECT_EQ(ufixed16(70000u), ufixed16::get_positive_infinity());
+    EXPECT_EQ(static_cast<unsigned int>(ufixed16(200.75)), 200u);
+    EXPECT_EQ(static_cast<int>(ufixed8(15.5)), 15);
+    EXPECT_EQ(static_cast<float>(ufixed32(0.25)), 0.25f);
+}
+
+TEST(ufixed, converts_between_formats)
+{
+    EXPECT_EQ(ufixed32(ufixed16(200.25)), ufixed32(200.25));
+    EXPECT_EQ(ufixed16(ufixed32(200.25)), ufixed16(200.25));
+    EXPECT_EQ(ufixed8(ufixed16(3.03125)).get_value(), 49u); // half rounds up
+    EXPECT_EQ(ufixed8(ufixed16(100)), ufixed8::get_positive_infinity());
+    EXPECT_TRUE(ufixed8(ufixed16::get_nan()).isnan());
+    EXPECT_EQ(ufixed32(ufixed16::get_positive_infinity()), ufixed32::get_positive_infinity());
+}
+
+TEST(ufixed, converts_to_and_from_fixed)
+{
+    EXPECT_EQ(ufixed16(fixed16(100.5)), ufixed16(100.5));
+    EXPECT_EQ(ufixed16(fixed32(100.5)), ufixed16(100.5));
+    EXPECT_EQ(ufixed16(fixed16(-3)), ufixed16(0));
+    EXPECT_EQ(ufixed16(fixed16::get_negative_infinity()), ufixed16(0));
+    EXPECT_EQ(ufixed16(fixed16::get_positive_infinity()), ufixed16::get_positive_infinity());
+    EXPECT_EQ(ufixed16(fixed32(300)), ufixed16::get_positive_infinity());
+    EXPECT_TRUE(ufixed16(fixed16::get_nan()).isnan());
+    EXPECT_EQ(static_cast<fixed16>(ufixed16(100.5)), fixed16(100.5));
+    EXPECT_EQ(static_cast<fixed32>(ufixed16(200.25)), fixed32(200.25));
+    EXPECT_EQ(static_cast<fixed16>(ufixed16(200)), fixed16::get_positive_infinity());
+    EXPECT_EQ(static_cast<fixed8>(ufixed16(3.03125)).get_value(), 49); // half rounds up
+    EXPECT_TRUE(static_cast<fixed16>(ufixed16::get_nan()).isnan());
+    EXPECT_EQ(static_cast<fixed16>(ufixed16::get_positive_infinity()), fixed16::get_positive_infinity());
+}
+
+TEST(ufixed, arithmetic)
+{
+    EXPECT_EQ(ufixed16(1.5) + ufixed16(2.25), ufixed16(3.75));
+    EXPECT_EQ(ufixed16(200) + ufixed16(100), ufixed16::get_positive_infinity());
+    EXPECT_EQ(ufixed16(3.75) - ufixed16(1.5), ufixed16(2.25));
+    EXPECT_EQ(ufixed16(1.5) - ufixed16(3.75), ufixed16(0));
+    EXPECT_EQ(ufixed16(1.5) * ufixed16(2.5), ufixed16(3.75));
+    EXPECT_EQ(ufixed16(20) * ufixed16(20), ufixed16::get_positive_infinity());
+    EXPECT_EQ(ufixed16::get_min() * ufixed16(0.5), ufixed16::get_min()); // half rounds up
+    EXPECT_EQ(ufixed16(3.75) / ufixed16(1.5), ufixed16(2.5));
+    EXPECT_EQ(ufixed16(1) / ufixed16(3), ufixed16::from_value(85u));
+    EXPECT_EQ(ufixed16(2) / ufixed16(3), ufixed16::from_value(171u));
+    EXPECT_EQ(ufixed16(200) / ufixed16(0.5), ufixed16::get_positive_infinity());
+    EXPECT_EQ(ufixed16(7.5) % ufixed16(2), ufixed16(1.5));
+    EXPECT_EQ(ufixed32(100000) * ufixed32(40), ufixed32(4000000));
+}
+
+TEST(ufixed, ufixed64_arithmetic)
+{
+    // These products and dividends need all 128 bits of the wider type or of the limbs
+    // type standing in for it...
+    const auto max = ufixed64::get_max();
+    EXPECT_EQ(ufixed64(1.5) * ufixed64(2.5), ufixed64(3.75));
+    EXPECT_EQ(ufixed64(1000000) * ufixed64(1000000), ufixed64(1000000000000));
+    EXPECT_EQ(ufixed64(2000000) * ufixed64(1000000), ufixed64::get_positive_infinity());
+    EXPECT_EQ(max * ufixed64(1), max);
+    EXPECT_EQ(max * max, ufixed64::get_positive_infinity());
+    EXPECT_EQ((max * ufixed64(0.5)).get_value(), 0x7FFFFFFFFFFFFFFFu); // half rounds up
+    EXPECT_EQ(ufixed64(1) / ufixed64(3), ufixed64::from_value(5592405u));
+    EXPECT_EQ(ufixed64(2) / ufixed64(3), ufixed64::from_value(11184811u));
+    EXPECT_EQ(ufixed64(1000000000000) / ufixed64(1000000), ufixed64(1000000));
+    EXPECT_EQ(max / ufixed64(1), max);
+    EXPECT_EQ(max / ufixed64(0.5), ufixed64::get_positive_infinity());
+}
+
+TEST(ufixed, special_values)
+{
+    const auto inf = ufixed16::get_positive_infinity();
+    const auto nan = ufixed16::get_nan();
+    EXPECT_TRUE((nan + ufixed16(1)).isnan());
+    EXPECT_EQ(inf + ufixed16(1), inf);
+    EXPECT_EQ(inf - ufixed16(1), inf);
+    EXPECT_EQ(ufixed16(1) - inf, ufixed16(0));
+    EXPECT_TRUE((inf - inf).isnan());
+    EXPECT_EQ(inf * ufixed16(2), inf);
+    EXPECT_TRUE((inf * ufixed16(0)).isnan());
+    EXPECT_EQ(ufixed16(1) / ufixed16(0), inf);
+    EXPECT_TRUE((ufixed16(0) / ufixed16(0)).isnan());
+    EXPECT_EQ(ufixed16(1) / inf, ufixed16(0));
+    EXPECT_TRUE((inf / inf).isnan());
+    EXPECT_FALSE(nan == nan);
+    EXPECT_FALSE(nan < ufixed16(1));
+}
+
+TEST(ufixed, multiplication_matches_rounded_product)
+{
+    using T = ufixed8;
+    for (auto a = 0u; a < 254u; ++a) {
+        for (auto b = 0u; b < 254u; ++b) {
+            const auto x = T::from_value(static_cast<std::uint8_t>(a));
+            const auto y = T::from_value(static_cast<std::uint8_t>(b));
+            const auto exact = std::floor((static_cast<double>(x) * static_cast<double>(y)) * 16 + 0.5);
+            const auto expected = (exact > 253)? T::get_positive_infinity(): T::from_value(static_cast<std::uint8_t>(exact));
+            ASSERT_EQ((x * y).get_value(), expected.get_value()) << x << " * " << y;
+        }
+    }
+}
+
+TEST(ufixed, shifts)
+{
+    EXPECT_EQ(ufixed16(1.5) << 2, ufixed16(6));
+    EXPECT_EQ(ufixed16(6) >> 2, ufixed16(1.5));
+    EXPECT_EQ(ufixed16(6) << -2, ufixed16(1.5));
+    EXPECT_EQ(ufixed16::get_min() >> 1, ufixed16::get_min()); // half rounds up
+    EXPECT_EQ(ufixed16(100) << 2, ufixed16::get_positive_infinity());
+    EXPECT_EQ(ufixed16(1) << 100, ufixed16::get_positive_infinity());
+    EXPECT_EQ(ufixed16(0) << 100, ufixed16(0));
+    EXPECT_EQ(ufixed16(200) >> 16, ufixed16(1) >> 8);
+    EXPECT_EQ(ufixed16(200) >> 100, ufixed16(0));
+    EXPECT_TRUE((ufixed16::get_nan() << 1).isnan());
+}
+
+TEST(ufixed, comparisons)
+{
+    EXPECT_TRUE(ufixed16(0.5) < ufixed16(200));
+    EXPECT_TRUE(ufixed16(200) > ufixed16(0.5));
+    EXPECT_TRUE(ufixed16(0.5) <= ufixed16(0.5));
+    EXPECT_TRUE(ufixed16(0.5) >= ufixed16(0.5));
+    EXPECT_TRUE(ufixed16(0.5) != ufixed16(0.25));
+    EXPECT_TRUE(ufixed16::get_max() < ufixed16::get_positive_infinity());
+    EXPECT_TRUE(!ufixed16(0));
+    EXPECT_TRUE(static_cast<bool>(ufixed16::get_min()));
+}
+
+TEST(ufixed, StreamOut)
+{
+    std::ostringstream os;
+    os << ufixed16(200.25) << ' ' << ufixed32(0.5);
+    EXPECT_EQ(os.str(), "200.25 0.5");
+}